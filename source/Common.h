@@ -62,6 +62,7 @@ typedef std::vector<uint64_t> UInt64Vec;
 #define PHASENAME_PUTBUCKETACL  "PUTBACL"
 #define PHASENAME_GETBUCKETACL  "GETBACL"
 #define PHASENAME_S3MPUCOMPLETE "MPUCOMPL"
+#define PHASENAME_REPLAY        "REPLAY"
 
 // special S3 metadata phases for multiple metadata operation types
 #define PHASENAME_GETOBJECTMETADATA     "GETOBJMD"
@@ -88,7 +89,7 @@ typedef std::vector<uint64_t> UInt64Vec;
  * (Only exact matches are assumed to be compatible, that's why this can differ from the program
  * version.)
  */
-#define HTTP_PROTOCOLVERSION	"3.1.3"
+#define HTTP_PROTOCOLVERSION	"3.1.10"
 
 /**
  * Default access mode bits for new files.
@@ -194,6 +195,7 @@ enum BenchPhase
     BenchPhase_PUT_S3_BUCKET_MD,
     BenchPhase_DEL_S3_BUCKET_MD,
 	BenchPhase_S3MPUCOMPLETE,
+	BenchPhase_REPLAY, // replay of ops log
 };
 
 
@@ -234,6 +236,7 @@ typedef std::vector<BenchPathInfo> BenchPathInfoVec;
 #define HTTPCLIENTPATH_PREPAREPHASE             "/preparephase"
 #define HTTPCLIENTPATH_STARTPHASE               "/startphase"
 #define HTTPCLIENTPATH_INTERRUPTPHASE           "/interruptphase"
+#define HTTPCLIENTPATH_RATELIMIT                "/ratelimit"
 
 #define MAKE_SERVER_PATH(path)                  "^" path "$"
 #define HTTPSERVERPATH_INFO                     MAKE_SERVER_PATH(HTTPCLIENTPATH_INFO)
@@ -244,6 +247,7 @@ typedef std::vector<BenchPathInfo> BenchPathInfoVec;
 #define HTTPSERVERPATH_PREPAREPHASE             MAKE_SERVER_PATH(HTTPCLIENTPATH_PREPAREPHASE)
 #define HTTPSERVERPATH_STARTPHASE               MAKE_SERVER_PATH(HTTPCLIENTPATH_STARTPHASE)
 #define HTTPSERVERPATH_INTERRUPTPHASE           MAKE_SERVER_PATH(HTTPCLIENTPATH_INTERRUPTPHASE)
+#define HTTPSERVERPATH_RATELIMIT                MAKE_SERVER_PATH(HTTPCLIENTPATH_RATELIMIT)
 
 
 // http service transferred parameters (used as http GET parameters or in json document)
@@ -283,18 +287,54 @@ typedef std::vector<BenchPathInfo> BenchPathInfoVec;
 #define XFER_STATS_LAT_PREFIX_ENTRIES			"Entries_"
 #define XFER_STATS_LAT_PREFIX_IOPS_RWMIXREAD	"IOPSRWMixRead_"
 #define XFER_STATS_LAT_PREFIX_ENTRIES_RWMIXREAD	"EntriesRWMixRead_"
-#define XFER_STATS_LATMICROSECTOTAL				"LatMicroSecTotal"
+#define XFER_STATS_LAT_PREFIX_IOPS_RESP			"IOPSResp_"
+#define XFER_STATS_LAT_PREFIX_ENTRIES_RESP		"EntriesResp_"
+#define XFER_STATS_LAT_PREFIX_FILELAT			"FileLat_" // followed by FileLatType name
+#define XFER_STATS_LATNANOSECTOTAL				"LatNanoSecTotal"
 #define XFER_STATS_LATNUMVALUES					"LatNumValues"
-#define XFER_STATS_LATMINMICROSEC				"LatMinMicroSec"
-#define XFER_STATS_LATMAXMICROSEC				"LatMaxMicroSec"
-#define XFER_STATS_LATHISTOLIST					"LatHistoList"
-#define XFER_STATS_LATHISTOLIST_ITEM			"LatHistoList.item"
+#define XFER_STATS_LATMINNANOSEC				"LatMinNanoSec"
+#define XFER_STATS_LATMAXNANOSEC				"LatMaxNanoSec"
+#define XFER_STATS_LATHISTODIGITS				"LatHistoDigits"
+#define XFER_STATS_LATHISTOCOUNTS				"LatHistoCounts"
+#define XFER_STATS_LIVELATHISTO_IOPS			"LiveIOLatHisto"
+#define XFER_STATS_LIVELATHISTO_IOPS_RWMIXREAD	"LiveIOLatHistoRWMixRead"
+#define XFER_STATS_LIVELATHISTO_ENTRIES			"LiveEntLatHisto"
+#define XFER_STATS_LIVELATHISTO_ENTRIES_RWMIXREAD	"LiveEntLatHistoRWMixRead"
 #define XFER_STATS_CPUUTIL_STONEWALL			"CPUUtilStoneWall"
 #define XFER_STATS_CPUUTIL						"CPUUtil"
+#define XFER_STATS_IOBATCH_NUMSUBMITCALLS		"IOBatchNumSubmitCalls"
+#define XFER_STATS_IOBATCH_NUMSUBMITTEDIOS		"IOBatchNumSubmittedIOs"
+#define XFER_STATS_IOBATCH_NUMREAPCALLS			"IOBatchNumReapCalls"
+#define XFER_STATS_IOBATCH_NUMREAPEDIOS			"IOBatchNumReapedIOs"
+#define XFER_STATS_OPENLOOP_NUMOPS				"OpenLoopNumOps"
+#define XFER_STATS_OPENLOOP_NUMLATEOPS			"OpenLoopNumLateOps"
+#define XFER_STATS_OPENLOOP_MAXBACKLOG			"OpenLoopMaxBacklog"
+#define XFER_STATS_SLOWOPSLIST					"SlowOpsList"
+#define XFER_STATS_SLOWOPSLIST_ITEM				"SlowOpsList.item"
+#define XFER_STATS_SLOWOP_LATNS					"LatNS"
+#define XFER_STATS_SLOWOP_STARTUSEC				"StartUSec"
+#define XFER_STATS_SLOWOP_OFFSET				"Offset"
+#define XFER_STATS_SLOWOP_LENGTH				"Length"
+#define XFER_STATS_SLOWOP_WORKERRANK			"WorkerRank"
+#define XFER_STATS_SLOWOP_OPNAME				"OpName"
+#define XFER_STATS_SLOWOP_PATH					"Path"
+#define XFER_STATS_RES_CPUUSERUSEC				"ResCPUUserUSec"
+#define XFER_STATS_RES_CPUSYSUSEC				"ResCPUSysUSec"
+#define XFER_STATS_RES_NUMVOLCTXSW				"ResNumVolCtxSw"
+#define XFER_STATS_RES_NUMINVOLCTXSW			"ResNumInvolCtxSw"
+#define XFER_STATS_RES_NUMMINORFAULTS			"ResNumMinorFaults"
+#define XFER_STATS_RES_NUMMAJORFAULTS			"ResNumMajorFaults"
+#define XFER_STATS_RES_PEAKRSSKIB				"ResPeakRSSKiB"
 
 #define XFER_START_BENCHID						XFER_STATS_BENCHID
 #define XFER_START_BENCHPHASECODE				XFER_STATS_BENCHPHASECODE
 
 #define XFER_INTERRUPT_QUIT						"quit"
 
+#define XFER_RATELIMIT_BENCHID					XFER_STATS_BENCHID
+#define XFER_RATELIMIT_READBPS					"ReadBps"
+#define XFER_RATELIMIT_READIOPS					"ReadIOPS"
+#define XFER_RATELIMIT_WRITEBPS					"WriteBps"
+#define XFER_RATELIMIT_WRITEIOPS				"WriteIOPS"
+
 #endif /* COMMON_H_ */
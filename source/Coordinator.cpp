@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2020-2025 Sven Breuner and elbencho contributors
 // SPDX-License-Identifier: GPL-3.0-only
 
+#include <algorithm>
 #include <chrono>
 #include <client_http.hpp>
 #include <csignal>
@@ -92,7 +93,15 @@ int Coordinator::main()
 		{
 			waitForUserDefinedStartTime();
 
-			runBenchmarks();
+			runPreconditioning();
+
+			if(progArgs.getSLOLatUSec() )
+				runSLOSearch();
+			else
+			if(progArgs.getIsSweep() )
+				runSweep();
+			else
+				runBenchmarks();
 		}
 
 		// signal workers to self-terminate
@@ -292,11 +301,9 @@ void Coordinator::runSyncAndDropCaches()
 }
 
 /**
- * Run coordinated benchmarks through workers according to user selection.
- *
- * @throw WorkerException on worker error; ProgException on main thread error.
+ * Get the bench phases selected by the user in the order in which they should run.
  */
-void Coordinator::runBenchmarks()
+std::vector<BenchPhase> Coordinator::getEnabledBenchPhasesVec()
 {
 	struct BenchPhaseConfig
 	{
@@ -325,6 +332,7 @@ void Coordinator::runBenchmarks()
 		BenchPhaseConfig { BenchPhase_LISTOBJECTS, progArgs.getRunListObjPhase() },
 		BenchPhaseConfig { BenchPhase_LISTOBJPARALLEL, progArgs.getRunListObjParallelPhase() },
 		BenchPhaseConfig { BenchPhase_READFILES, progArgs.getRunReadPhase() },
+		BenchPhaseConfig { BenchPhase_REPLAY, progArgs.getRunReplayPhase() },
         BenchPhaseConfig { BenchPhase_DEL_S3_OBJECT_MD, progArgs.getRunS3DelObjectMetadata() },
         BenchPhaseConfig { BenchPhase_MULTIDELOBJ, progArgs.getRunMultiDelObjPhase() },
 		BenchPhaseConfig { BenchPhase_DELETEFILES, progArgs.getRunDeleteFilesPhase() },
@@ -343,6 +351,133 @@ void Coordinator::runBenchmarks()
 			enabledBenchPhasesVec.push_back(benchPhaseConfig.benchPhase);
 	}
 
+	return enabledBenchPhasesVec;
+}
+
+/**
+ * Run the given bench phases once, including sync/drop caches phases, inter-phase delay and hosts
+ * rotation.
+ *
+ * @throw WorkerException on worker error; ProgException on main thread error.
+ */
+void Coordinator::runBenchmarkPhases(const std::vector<BenchPhase>& benchPhasesVec)
+{
+	runSyncAndDropCaches();
+
+	for(unsigned benchPhaseIdx=0; benchPhaseIdx < benchPhasesVec.size(); benchPhaseIdx++)
+	{
+		// run actual test phase
+		runBenchmarkPhase(benchPhasesVec[benchPhaseIdx] );
+
+		// run special "sync" and "drop caches" phases
+		runSyncAndDropCaches();
+
+		if(benchPhaseIdx < (benchPhasesVec.size() - 1) )
+		{
+			// delay between phases
+			if(progArgs.getNextPhaseDelaySecs() )
+				sleep(progArgs.getNextPhaseDelaySecs() );
+
+			// rotate hosts (which requires new prep phase for ranks)
+			rotateHosts();
+		}
+	}
+}
+
+/**
+ * Precondition block devices or large files before the benchmark phases: Write the full dataset
+ * sequentially the user-defined number of times and afterwards run a random write soak until IOPS
+ * and latency reached steady state or the soak time limit expired. The results of each pass get
+ * printed as normal write phase results.
+ *
+ * This is a no-op if the user didn't request preconditioning.
+ *
+ * @throw WorkerException on worker error; ProgException on main thread error.
+ */
+void Coordinator::runPreconditioning()
+{
+	if(!progArgs.getPrecondNumFills() && !progArgs.getPrecondSoakSecs() )
+		return;
+
+	const bool origUseRandomOffsets = progArgs.getUseRandomOffsets();
+	const bool origDoInfiniteIOLoop = progArgs.getDoInfiniteIOLoop();
+	const size_t origTimeLimitSecs = progArgs.getTimeLimitSecs();
+
+	statistics.printPhaseResultsTableHeader();
+
+	if(progArgs.getPrecondNumFills() )
+	{
+		restartWorkersWithIOPattern(false, false, 0);
+
+		for(unsigned fillIndex = 0; fillIndex < progArgs.getPrecondNumFills(); fillIndex++)
+		{
+			LOGGER(Log_NORMAL, "[Preconditioning: Sequential fill " <<
+				(fillIndex+1) << " of " << progArgs.getPrecondNumFills() << "...]" << std::endl);
+
+			runBenchmarkPhase(BenchPhase_CREATEFILES);
+		}
+	}
+
+	if(progArgs.getPrecondSoakSecs() )
+	{
+		restartWorkersWithIOPattern(true, true, progArgs.getPrecondSoakSecs() );
+
+		LOGGER(Log_NORMAL, "[Preconditioning: Random write soak until steady state, max " <<
+			progArgs.getPrecondSoakSecs() << "s...]" << std::endl);
+
+		statistics.startSteadyStateDetection();
+
+		try
+		{
+			runBenchmarkPhase(BenchPhase_CREATEFILES);
+		}
+		catch(ProgTimeLimitException& e)
+		{ // soak time limit or steady state ended the phase, so not the end of the benchmark
+			WorkersSharedData::isPhaseTimeExpired = false;
+		}
+
+		statistics.stopSteadyStateDetection();
+
+		const SteadyStateDetector& detector = statistics.getSteadyStateDetector();
+
+		if(detector.getIsSteady() )
+			LOGGER(Log_NORMAL, "[Preconditioning: Steady state reached after " <<
+				detector.getNumRounds() << " rounds. "
+				"Window average IOPS: " << (uint64_t)detector.getWindowAvgIOPS() << "]" <<
+				std::endl);
+		else
+			LOGGER(Log_NORMAL, "NOTE: Preconditioning soak time limit expired before steady "
+				"state was reached. Completed rounds: " << detector.getNumRounds() << std::endl);
+	}
+
+	restartWorkersWithIOPattern(origUseRandomOffsets, origDoInfiniteIOLoop, origTimeLimitSecs);
+}
+
+/**
+ * Restart workers with a different IO pattern and phase time limit, e.g. for preconditioning.
+ */
+void Coordinator::restartWorkersWithIOPattern(bool useRandomOffsets, bool doInfiniteIOLoop,
+	size_t timeLimitSecs)
+{
+	stopWorkers();
+
+	progArgs.setIOPatternValues(useRandomOffsets, doInfiniteIOLoop);
+	progArgs.setTimeLimitSecs(timeLimitSecs);
+
+	workerManager.prepareThreads();
+
+	if(!progArgs.getHostsVec().empty() )
+		workerManager.checkServiceBenchPathInfos();
+}
+
+/**
+ * Run coordinated benchmarks through workers according to user selection.
+ *
+ * @throw WorkerException on worker error; ProgException on main thread error.
+ */
+void Coordinator::runBenchmarks()
+{
+	const std::vector<BenchPhase> enabledBenchPhasesVec = getEnabledBenchPhasesVec();
 
 	for(size_t iterationIndex = 0; iterationIndex < progArgs.getIterations(); iterationIndex++)
 	{
@@ -352,29 +487,272 @@ void Coordinator::runBenchmarks()
 
 		statistics.printPhaseResultsTableHeader();
 
-		runSyncAndDropCaches();
+		runBenchmarkPhases(enabledBenchPhasesVec);
+	}
+}
 
-		for(unsigned benchPhaseIdx=0; benchPhaseIdx < enabledBenchPhasesVec.size(); benchPhaseIdx++)
-		{
-			// run actual test phase
-			runBenchmarkPhase(enabledBenchPhasesVec[benchPhaseIdx] );
+/**
+ * Parameter sweep: Run the selected phases for all combinations of file size, block size, thread
+ * count and IO depth (in this nesting order, so IO depth is the innermost loop) in a single
+ * invocation. Workers get restarted with the new values for each combination, which reuses the
+ * service instances and the open benchmark paths of local runs. Results of all combinations go to
+ * a single results table and a summary table gets printed at the end.
+ *
+ * With a plateau percentage, the remaining IO depths of a thread count and the remaining thread
+ * counts of a block and file size get skipped when throughput stops increasing.
+ *
+ * An expired phase time limit only ends the current combination (like it ends all further phases
+ * of a normal run), so the sweep continues with the next combination. On errors or interruption,
+ * the summary of the combinations done so far gets printed before the exception is passed on.
+ *
+ * @throw WorkerException on worker error; ProgException on main thread error.
+ */
+void Coordinator::runSweep()
+{
+	statistics.printPhaseResultsTableHeader();
+
+	try
+	{
+		runSweepCombinations();
+	}
+	catch(...)
+	{
+		statistics.setSweepCombinationNum(0);
+		statistics.printSweepSummary();
+
+		throw;
+	}
+
+	statistics.setSweepCombinationNum(0);
+
+	statistics.printSweepSummary();
+}
+
+/**
+ * Run all combinations of a parameter sweep. See runSweep().
+ *
+ * @throw WorkerException on worker error; ProgException on main thread error.
+ */
+void Coordinator::runSweepCombinations()
+{
+	const std::vector<BenchPhase> enabledBenchPhasesVec = getEnabledBenchPhasesVec();
+	size_t combinationNum = 0;
 
-			// run special "sync" and "drop caches" phases
-			runSyncAndDropCaches();
+	for(uint64_t fileSize : progArgs.getSweepFileSizesVec() )
+	{
+		for(uint64_t blockSize : progArgs.getSweepBlockSizesVec() )
+		{
+			uint64_t bestPerSec = 0; // best of all thread counts for this block and file size
 
-			if(benchPhaseIdx < (enabledBenchPhasesVec.size() - 1) )
+			for(uint64_t numThreads : progArgs.getSweepNumThreadsVec() )
 			{
-				// delay between phases
-				if(progArgs.getNextPhaseDelaySecs() )
-					sleep(progArgs.getNextPhaseDelaySecs() );
+				uint64_t threadsBestPerSec = 0; // best of all IO depths for this thread count
+
+				for(uint64_t ioDepth : progArgs.getSweepIODepthsVec() )
+				{
+					combinationNum++;
+
+					// workers were prepared with the 1st combination, later ones need a restart
+					if(combinationNum > 1)
+					{
+						if(progArgs.getNextPhaseDelaySecs() )
+							sleep(progArgs.getNextPhaseDelaySecs() );
+
+						stopWorkers();
+
+						progArgs.setSweepValues(numThreads, ioDepth, blockSize, fileSize);
+
+						workerManager.prepareThreads();
+
+						if(!progArgs.getHostsVec().empty() )
+							workerManager.checkServiceBenchPathInfos();
+					}
 
-				// rotate hosts (which requires new prep phase for ranks)
-				rotateHosts();
+					statistics.setSweepCombinationNum(combinationNum);
+
+					try
+					{
+						for(size_t iterationIndex = 0; iterationIndex < progArgs.getIterations();
+							iterationIndex++)
+							runBenchmarkPhases(enabledBenchPhasesVec);
+					}
+					catch(ProgTimeLimitException& e)
+					{ /* phase time limit ends the remaining phases and iterations of this
+						combination, not the sweep */
+						LOGGER(Log_VERBOSE, "Phase time limit expired. Skipping remaining "
+							"phases of sweep combination " << combinationNum << "." << std::endl);
+
+						WorkersSharedData::isPhaseTimeExpired = false;
+					}
+
+					const uint64_t perSec = statistics.getSweepCombinationPerSec(combinationNum);
+					const bool isPlateau = isSweepPlateau(threadsBestPerSec, perSec);
+
+					threadsBestPerSec = std::max(threadsBestPerSec, perSec);
+
+					if(isPlateau)
+					{
+						LOGGER(Log_NORMAL, "NOTE: Throughput plateau reached. Skipping remaining "
+							"IO depths for " << numThreads << " threads." << std::endl);
+						break;
+					}
+				}
+
+				const bool isPlateau = isSweepPlateau(bestPerSec, threadsBestPerSec);
+
+				bestPerSec = std::max(bestPerSec, threadsBestPerSec);
+
+				if(isPlateau)
+				{
+					LOGGER(Log_NORMAL, "NOTE: Throughput plateau reached. Skipping remaining "
+						"thread counts for this block size and file size." << std::endl);
+					break;
+				}
 			}
 		}
 	}
 }
 
+/**
+ * Check if a parameter sweep reached a throughput plateau.
+ *
+ * @prevBestPerSec best throughput of the previous values on the current sweep axis (0 if none).
+ * @newPerSec throughput of the new value.
+ * @return true if a plateau percentage was given by the user and the new value doesn't improve the
+ * 	previous best by at least this percentage.
+ */
+bool Coordinator::isSweepPlateau(uint64_t prevBestPerSec, uint64_t newPerSec)
+{
+	if(!progArgs.getSweepPlateauPercent() || !prevBestPerSec)
+		return false;
+
+	return (newPerSec * 100) < (prevBestPerSec * (100 + progArgs.getSweepPlateauPercent() ) );
+}
+
+/**
+ * Latency SLO capacity search: Find the highest IOPS at which the user-defined latency percentile
+ * stays below the user-defined target by running the selected read or write phase repeatedly with
+ * different total IOPS limits or IO depths. The first step runs without limit (or at the user-given
+ * IO depth) to find the upper bound, the following steps do a binary search below it.
+ *
+ * Each step is a normal benchmark phase with its own results in the console, CSV and JSON output.
+ * The phase time limit applies to each step and doesn't end the search. At the end, the curve of all
+ * steps and the found capacity get printed.
+ *
+ * @throw WorkerException on worker error; ProgException on main thread error.
+ */
+void Coordinator::runSLOSearch()
+{
+	const bool isRateSearch = (progArgs.getSLOSearchType() == ARG_SLOSEARCH_RATE);
+	const BenchPhase benchPhase = progArgs.getRunReadPhase() ?
+		BenchPhase_READFILES : BenchPhase_CREATEFILES;
+	const uint64_t minSearchValue = progArgs.getHostsVec().empty() ?
+		1 : progArgs.getHostsVec().size(); // global limit must be at least 1 per host
+
+	SLOSearchStepVec stepsVec;
+
+	// rate limits of search steps are totals for all threads and hosts
+	if(isRateSearch)
+		progArgs.setLimitScope(progArgs.getHostsVec().empty() ?
+			ARG_LIMITSCOPE_HOST : ARG_LIMITSCOPE_GLOBAL);
+
+	statistics.printPhaseResultsTableHeader();
+
+	// first step at max: unlimited rate or user-given IO depth
+
+	uint64_t lowerValue = 0; // highest value that met the SLO so far (0 if none)
+	uint64_t upperValue = isRateSearch ? 0 : progArgs.getIODepth(); // lowest that didn't meet SLO
+
+	const SLOSearchStep firstStep = runSLOSearchStep(benchPhase, upperValue, stepsVec);
+
+	if(isRateSearch)
+		upperValue = firstStep.iopsPerSec;
+
+	const uint64_t resolution = isRateSearch ?
+		std::max<uint64_t>(1, upperValue * SLOSEARCH_RESOLUTION_PCT / 100) : 1;
+
+	// binary search between the highest value that met the SLO and the lowest that didn't
+
+	while(!firstStep.sloMet &&
+		(stepsVec.size() < progArgs.getSLOSearchMaxSteps() ) &&
+		( (upperValue - lowerValue) > resolution) )
+	{
+		const uint64_t searchValue = std::max(minSearchValue,
+			lowerValue + ( (upperValue - lowerValue) / 2) );
+
+		if(progArgs.getNextPhaseDelaySecs() )
+			sleep(progArgs.getNextPhaseDelaySecs() );
+
+		const SLOSearchStep step = runSLOSearchStep(benchPhase, searchValue, stepsVec);
+
+		if(step.sloMet)
+			lowerValue = searchValue;
+		else
+			upperValue = searchValue;
+
+		if(searchValue == minSearchValue)
+			break; // can't go lower
+	}
+
+	// capacity is the highest throughput of all steps that met the SLO
+
+	const SLOSearchStep* capacityStep = NULL;
+
+	for(const SLOSearchStep& step : stepsVec)
+	{
+		if(step.sloMet && (!capacityStep || (step.iopsPerSec > capacityStep->iopsPerSec) ) )
+			capacityStep = &step;
+	}
+
+	statistics.printSLOSearchSummary(stepsVec, capacityStep);
+}
+
+/**
+ * Run a single step of the latency SLO capacity search. Workers get restarted with the new
+ * setting for all steps except the first.
+ *
+ * @benchPhase the read or write phase to run.
+ * @searchValue total IOPS limit (0 for unlimited) or IO depth for this step.
+ * @inoutStepsVec previous steps; the result of this step will be added at the end.
+ * @return result of this step.
+ */
+SLOSearchStep Coordinator::runSLOSearchStep(BenchPhase benchPhase, uint64_t searchValue,
+	SLOSearchStepVec& inoutStepsVec)
+{
+	if(progArgs.getSLOSearchType() == ARG_SLOSEARCH_IODEPTH)
+		progArgs.setIODepth(searchValue);
+	else
+	if(benchPhase == BenchPhase_READFILES)
+		progArgs.setLimitReadIOPS(searchValue);
+	else
+		progArgs.setLimitWriteIOPS(searchValue);
+
+	// restart workers to apply new settings (incl. new prep phase for service hosts)
+	if(!inoutStepsVec.empty() )
+	{
+		stopWorkers();
+		workerManager.prepareThreads();
+	}
+
+	statistics.setSLOSearchStep(inoutStepsVec.size() + 1, searchValue);
+
+	try
+	{
+		runSyncAndDropCaches();
+		runBenchmarkPhase(benchPhase);
+	}
+	catch(ProgTimeLimitException& e)
+	{ // phase time limit defines the duration of each step, so not the end of the search here
+		WorkersSharedData::isPhaseTimeExpired = false;
+	}
+
+	inoutStepsVec.push_back(statistics.getSLOSearchStep() );
+
+	statistics.setSLOSearchStep(0, 0);
+
+	return inoutStepsVec.back();
+}
+
 /**
  * Stop and restart all workers after inter-phase hosts rotation. This is necessary because we need
  * to run the prep phase again to update the worker ranks.
@@ -388,6 +766,22 @@ void Coordinator::rotateHosts()
 		(progArgs.getBenchMode() == BenchMode_NETBENCH) )
 		return;
 
+	stopWorkers();
+
+	progArgs.rotateHosts();
+
+	/* note: workerManager.prepareThreads() blocks signal interrupt signals for spawned threads
+		so we don't need to reset signal handlers here. */
+
+	workerManager.prepareThreads();
+}
+
+/**
+ * Stop and delete all workers, so that they can be restarted with changed settings through
+ * workerManager.prepareThreads().
+ */
+void Coordinator::stopWorkers()
+{
 	workerManager.interruptAndNotifyWorkers();
 	workerManager.joinAllThreads();
 	workerManager.cleanupWorkersAfterPhaseDone();
@@ -398,13 +792,6 @@ void Coordinator::rotateHosts()
 		std::cerr << LoggerBase::getErrHistory();
 		LoggerBase::clearErrHistory();
 	}
-
-	progArgs.rotateHosts();
-
-	/* note: workerManager.prepareThreads() blocks signal interrupt signals for spawned threads
-		so we don't need to reset signal handlers here. */
-
-	workerManager.prepareThreads();
 }
 
 /**
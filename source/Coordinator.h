@@ -33,8 +33,20 @@ class Coordinator
 		void checkInterruptionBetweenPhases();
 		void runBenchmarkPhase(BenchPhase newBenchPhase);
 		void runSyncAndDropCaches();
+		std::vector<BenchPhase> getEnabledBenchPhasesVec();
+		void runBenchmarkPhases(const std::vector<BenchPhase>& benchPhasesVec);
+		void runPreconditioning();
+		void restartWorkersWithIOPattern(bool useRandomOffsets, bool doInfiniteIOLoop,
+			size_t timeLimitSecs);
 		void runBenchmarks();
+		void runSweep();
+		void runSweepCombinations();
+		bool isSweepPlateau(uint64_t prevBestPerSec, uint64_t newPerSec);
+		void runSLOSearch();
+		SLOSearchStep runSLOSearchStep(BenchPhase benchPhase, uint64_t searchValue,
+			SLOSearchStepVec& inoutStepsVec);
 		void rotateHosts();
+		void stopWorkers();
 };
 
 #endif /* COORDINATOR_H_ */
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef FILELATSTATS_H_
+#define FILELATSTATS_H_
+
+#include <boost/property_tree/ptree.hpp>
+#include "Common.h"
+#include "LatencyHistogram.h"
+
+namespace bpt = boost::property_tree;
+
+/**
+ * Steps of a file-level operation in dir mode, for which latency is recorded separately.
+ */
+enum FileLatType
+{
+	FileLat_OPEN = 0, // open incl. prep (e.g. truncate, preallocation, mmap)
+	FileLat_STAT, // inline stat after open
+	FileLat_FIRSTBYTE, // from start of data transfer to completion of the first I/O
+	FileLat_XFER, // whole data transfer of the file
+	FileLat_CLOSE, // close incl. unmap
+	FileLat_NUMTYPES, // number of types (not a valid type)
+};
+
+
+/**
+ * Latency breakdown of file-level operations in dir mode ("--filelat"), so that metadata latency
+ * (open/close) can be told apart from data latency (first byte/transfer). The entries latency
+ * histogram of the worker only covers the sum of all these steps.
+ *
+ * Only updated by the owning worker thread, so values are only valid at the end of a phase.
+ */
+class FileLatStats
+{
+	public:
+		void reset(unsigned significantDigits)
+		{
+			for(LatencyHistogram& latHisto : latHistos)
+				latHisto.reset(significantDigits, false);
+		}
+
+		void resetTotals()
+		{
+			for(LatencyHistogram& latHisto : latHistos)
+				latHisto.resetTotals();
+		}
+
+		void addLatency(FileLatType type, uint64_t latencyNanoSec)
+		{
+			latHistos[type].addLatency(latencyNanoSec);
+		}
+
+		FileLatStats& operator+=(const FileLatStats& rhs)
+		{
+			for(unsigned type = 0; type < FileLat_NUMTYPES; type++)
+				latHistos[type] += rhs.latHistos[type];
+
+			return *this;
+		}
+
+		bool hasValues() const
+		{
+			for(const LatencyHistogram& latHisto : latHistos)
+				if(latHisto.getNumStoredValues() )
+					return true;
+
+			return false;
+		}
+
+		void getAsPropertyTreeForService(bpt::ptree& outTree) const
+		{
+			for(unsigned type = 0; type < FileLat_NUMTYPES; type++)
+				latHistos[type].getAsPropertyTreeForService(outTree,
+					std::string(XFER_STATS_LAT_PREFIX_FILELAT) + getTypeName( (FileLatType)type) +
+					"_");
+		}
+
+		void setFromPropertyTreeForService(bpt::ptree& tree)
+		{
+			for(unsigned type = 0; type < FileLat_NUMTYPES; type++)
+				latHistos[type].setFromPropertyTreeForService(tree,
+					std::string(XFER_STATS_LAT_PREFIX_FILELAT) + getTypeName( (FileLatType)type) +
+					"_");
+		}
+
+		/**
+		 * @return short name of type for result output, e.g. "open".
+		 */
+		static const char* getTypeName(FileLatType type)
+		{
+			static const char* const typeNames[FileLat_NUMTYPES] =
+				{"open", "stat", "1st_byte", "xfer", "close"};
+
+			return typeNames[type];
+		}
+
+		/**
+		 * @return label of type for console latency result lines, e.g. "Open".
+		 */
+		static const char* getTypeLabel(FileLatType type)
+		{
+			static const char* const typeLabels[FileLat_NUMTYPES] =
+				{"Open", "Stat", "1st byte", "Xfer", "Close"};
+
+			return typeLabels[type];
+		}
+
+	private:
+		LatencyHistogram latHistos[FileLat_NUMTYPES]; // index is FileLatType
+
+		// inliners
+	public:
+		const LatencyHistogram& getLatHisto(FileLatType type) const { return latHistos[type]; }
+};
+
+#endif /* FILELATSTATS_H_ */
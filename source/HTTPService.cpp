@@ -226,3 +226,32 @@ void HTTPService::checkPortAvailable()
 	close(sockFD);
 }
 
+
+/**
+ * Update the limits of the host-wide rate limiters during a running phase, e.g. when the master
+ * rebalances the host shares of a global limit.
+ *
+ * Updates for a different benchmark than the current one are ignored, because they can be late
+ * arrivals from the previous phase.
+ */
+void HTTPService::setRateLimits(const std::string& benchID, uint64_t readBps, uint64_t readIOPS,
+	uint64_t writeBps, uint64_t writeIOPS)
+{
+	WorkersSharedData& workersSharedData = workerManager.getWorkersSharedData();
+
+	std::unique_lock<std::mutex> lock(workersSharedData.mutex); // L O C K (scoped)
+
+	if(benchID != buuids::to_string(workersSharedData.currentBenchID) )
+	{
+		Logger(Log_DEBUG) << "Ignoring rate limit update for different benchmark ID. " <<
+			"BenchID: " << benchID << std::endl;
+		return;
+	}
+
+	Logger(Log_VERBOSE) << "Updating rate limits. " <<
+		"Read: " << readBps << " B/s, " << readIOPS << " IOPS; "
+		"Write: " << writeBps << " B/s, " << writeIOPS << " IOPS" << std::endl;
+
+	workersSharedData.readRateLimiter.setLimits(readBps, readIOPS);
+	workersSharedData.writeRateLimiter.setLimits(writeBps, writeIOPS);
+}
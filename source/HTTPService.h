@@ -27,6 +27,8 @@ class HTTPService
 
 		void daemonize();
 		void checkPortAvailable();
+		void setRateLimits(const std::string& benchID, uint64_t readBps, uint64_t readIOPS,
+			uint64_t writeBps, uint64_t writeIOPS);
 };
 
 #endif /* HTTPSERVICE_H_ */
@@ -144,6 +144,7 @@ void HTTPServiceSWS::defineServerResources(HttpServer& server)
     defineServerResourcePreparePhase(server);
     defineServerResourceStartPhase(server);
     defineServerResourceInterruptPhase(server);
+    defineServerResourceRateLimit(server);
     defineServerResourceErrorHandler(server);
 }
 
@@ -213,6 +214,8 @@ void HTTPServiceSWS::defineServerResourceStatus(HttpServer& server)
 
 		bpt::ptree tree;
 
+		workerManager.checkPhaseWarmupEnd(); // (resets worker stats after warmup period)
+
 		statistics.updateLiveCPUUtil();
 
 		statistics.getLiveStatsAsPropertyTreeForService(tree);
@@ -639,6 +642,51 @@ void HTTPServiceSWS::defineServerResourceInterruptPhase(HttpServer& server)
 	};
 }
 
+/**
+ * Define the HTTPSERVERPATH_RATELIMIT resource.
+ */
+void HTTPServiceSWS::defineServerResourceRateLimit(HttpServer& server)
+{
+	// update host share of global rate limit during a running phase
+	server.resource[HTTPSERVERPATH_RATELIMIT]["GET"] =
+		[&, this](std::shared_ptr<HttpServer::Response> response,
+			std::shared_ptr<HttpServer::Request> request)
+	{
+		Logger(Log_VERBOSE) << "HTTP: " << request->path << "?" <<
+			request->query_string << std::endl;
+
+		std::stringstream stream;
+
+		auto query_fields = request->parse_query_string();
+
+		std::string benchID;
+		uint64_t limitsArray[4]; // read bps, read iops, write bps, write iops
+		const char* limitParamsArray[4] = {XFER_RATELIMIT_READBPS, XFER_RATELIMIT_READIOPS,
+			XFER_RATELIMIT_WRITEBPS, XFER_RATELIMIT_WRITEIOPS};
+
+		auto iter = query_fields.find(XFER_RATELIMIT_BENCHID);
+		if(iter != query_fields.end() )
+			benchID = iter->second;
+
+		for(unsigned i = 0; i < 4; i++)
+		{
+			iter = query_fields.find(limitParamsArray[i] );
+			if(iter != query_fields.end() )
+				limitsArray[i] = std::stoull(iter->second);
+			else
+			{ // all limits are required parameters
+				stream << "Missing parameter: " << limitParamsArray[i];
+				response->write(Web::StatusCode::client_error_bad_request, stream);
+				return;
+			}
+		}
+
+		setRateLimits(benchID, limitsArray[0], limitsArray[1], limitsArray[2], limitsArray[3] );
+
+		response->write(""); // empty response to set success status code
+	};
+}
+
 /**
  * Define the http server error handler.
  */
@@ -35,6 +35,7 @@ class HTTPServiceSWS : public HTTPService
         void defineServerResourcePreparePhase(HttpServer& server);
         void defineServerResourceStartPhase(HttpServer& server);
         void defineServerResourceInterruptPhase(HttpServer& server);
+        void defineServerResourceRateLimit(HttpServer& server);
         void defineServerResourceErrorHandler(HttpServer& server);
 };
 
@@ -122,6 +122,8 @@ void HTTPServiceUWS::defineServerResources(uWS::App& uWSApp)
 
 			bpt::ptree tree;
 
+			workerManager.checkPhaseWarmupEnd(); // (resets worker stats after warmup period)
+
 			statistics.updateLiveCPUUtil();
 
 			statistics.getLiveStatsAsPropertyTreeForService(tree);
@@ -580,6 +582,42 @@ void HTTPServiceUWS::defineServerResources(uWS::App& uWSApp)
 			us_listen_socket_close(0 /*ssl*/, globalListenSocket);
 		}
 	});
+
+	// update host share of global rate limit during a running phase
+	uWSApp.get(HTTPCLIENTPATH_RATELIMIT,
+		[&](uWS::HttpResponse<false>* res, uWS::HttpRequest* req)
+	{
+		logReqAndError(res, std::string(req->getUrl() ), std::string(req->getQuery() ) );
+
+		std::stringstream stream;
+
+		std::string benchID;
+		uint64_t limitsArray[4]; // read bps, read iops, write bps, write iops
+		const char* limitParamsArray[4] = {XFER_RATELIMIT_READBPS, XFER_RATELIMIT_READIOPS,
+			XFER_RATELIMIT_WRITEBPS, XFER_RATELIMIT_WRITEIOPS};
+
+		std::string_view benchIDParam = req->getQuery(XFER_RATELIMIT_BENCHID);
+		if(!benchIDParam.empty() )
+			benchID = std::string(benchIDParam);
+
+		for(unsigned i = 0; i < 4; i++)
+		{
+			std::string_view limitParam = req->getQuery(limitParamsArray[i] );
+			if(!limitParam.empty() )
+				limitsArray[i] = std::stoull(std::string(limitParam) );
+			else
+			{ // all limits are required parameters
+				stream << "Missing parameter: " << limitParamsArray[i];
+				res->writeStatus("400 Bad Request");
+				res->end(stream.str() );
+				return;
+			}
+		}
+
+		setRateLimits(benchID, limitsArray[0], limitsArray[1], limitsArray[2], limitsArray[3] );
+
+		res->end(""); // empty response to set success status code
+	});
 }
 
 /**
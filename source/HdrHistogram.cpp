@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include "HdrHistogram.h"
+#include "ProgException.h"
+
+/**
+ * Set up the bucket layout and allocate counters. All previously recorded values get dropped.
+ *
+ * @significantDigits number of significant decimal digits to preserve for recorded values.
+ * @highestTrackableValue larger values will be stored as this value.
+ * @throw ProgException if significantDigits is out of range.
+ */
+void HdrHistogram::init(unsigned significantDigits, uint64_t highestTrackableValue)
+{
+	if( (significantDigits < HDRHISTO_MIN_SIGNIFICANT_DIGITS) ||
+		(significantDigits > HDRHISTO_MAX_SIGNIFICANT_DIGITS) )
+		throw ProgException("Number of significant digits for latency histogram out of range. "
+			"Given value: " + std::to_string(significantDigits) + "; "
+			"Range: " + std::to_string(HDRHISTO_MIN_SIGNIFICANT_DIGITS) + "-" +
+			std::to_string(HDRHISTO_MAX_SIGNIFICANT_DIGITS) );
+
+	const uint64_t largestValueWithSingleUnitResolution = 2 * std::pow(10, significantDigits);
+	const unsigned subBucketCountMagnitude =
+		std::ceil(std::log2(largestValueWithSingleUnitResolution) );
+	const uint64_t subBucketCount = 1ULL << subBucketCountMagnitude;
+
+	this->significantDigits = significantDigits;
+	this->highestTrackableValue = std::max(highestTrackableValue, subBucketCount);
+	this->subBucketHalfCountMagnitude = subBucketCountMagnitude - 1;
+	this->subBucketHalfCount = subBucketCount / 2;
+	this->subBucketMask = subBucketCount - 1;
+
+	counts.assign(getCountsIndex(this->highestTrackableValue) + 1, 0);
+	totalCount = 0;
+}
+
+/**
+ * Set all counters to zero. Keeps the configuration from init().
+ */
+void HdrHistogram::reset()
+{
+	std::fill(counts.begin(), counts.end(), 0);
+	totalCount = 0;
+}
+
+/**
+ * Record the same value multiple times.
+ */
+void HdrHistogram::recordValues(uint64_t value, uint64_t count)
+{
+	if(value > highestTrackableValue)
+		value = highestTrackableValue;
+
+	counts[getCountsIndex(value)] += count;
+	totalCount += count;
+}
+
+/**
+ * Get the upper bound of values for the given percentage of recorded values, e.g. 99.9 for the
+ * value that 99.9% of recorded values are smaller than or equal to.
+ *
+ * @return upper bound of the sub-bucket that contains the given percentile; 0 if no values were
+ * 	recorded.
+ */
+uint64_t HdrHistogram::getValueAtPercentile(double percentage) const
+{
+	if(!totalCount)
+		return 0;
+
+	const double clampedPercentage = std::min(std::max(percentage, 0.0), 100.0);
+	const uint64_t countAtPercentile = std::max( (uint64_t)1,
+		(uint64_t)std::ceil( (clampedPercentage / 100) * totalCount) );
+
+	uint64_t countSoFar = 0;
+
+	for(size_t index = 0; index < counts.size(); index++)
+	{
+		countSoFar += counts[index];
+
+		if(countSoFar >= countAtPercentile)
+			return std::min(getHighestEquivalentValue(getValueFromIndex(index) ),
+				highestTrackableValue);
+	}
+
+	return highestTrackableValue; // should never happen
+}
+
+/**
+ * Get non-zero counters in a compact string format for service transfer. Format is
+ * "index:count index:count ...".
+ */
+std::string HdrHistogram::getCountsStr() const
+{
+	std::ostringstream stream;
+
+	for(size_t index = 0; index < counts.size(); index++)
+	{
+		if(!counts[index] )
+			continue;
+
+		if(stream.tellp() )
+			stream << " ";
+
+		stream << index << ":" << counts[index];
+	}
+
+	return stream.str();
+}
+
+/**
+ * Set counters from a string that was generated by getCountsStr(). The configuration has to be set
+ * via init() before calling this.
+ *
+ * @throw ProgException on invalid string.
+ */
+void HdrHistogram::setCountsFromStr(const std::string& countsStr)
+{
+	std::istringstream stream(countsStr);
+	std::string itemStr;
+
+	reset();
+
+	while(stream >> itemStr)
+	{
+		const size_t separatorPos = itemStr.find(':');
+
+		if(separatorPos == std::string::npos)
+			throw ProgException("Invalid latency histogram item: " + itemStr);
+
+		const size_t index = std::stoull(itemStr.substr(0, separatorPos) );
+		const uint64_t count = std::stoull(itemStr.substr(separatorPos + 1) );
+
+		if(index >= counts.size() )
+			throw ProgException("Latency histogram item index out of range: " + itemStr + "; "
+				"Number of counters: " + std::to_string(counts.size() ) );
+
+		counts[index] += count;
+		totalCount += count;
+	}
+}
+
+/**
+ * Add the values of rhs. If rhs has a different configuration, its values are re-recorded with
+ * the resolution of this histogram. An uninitialized histogram inherits the configuration of rhs.
+ */
+HdrHistogram& HdrHistogram::operator+=(const HdrHistogram& rhs)
+{
+	if(!rhs.significantDigits)
+		return *this; // rhs not initialized, so nothing to add
+
+	if(!significantDigits)
+		init(rhs.significantDigits, rhs.highestTrackableValue);
+
+	if( (significantDigits == rhs.significantDigits) &&
+		(highestTrackableValue == rhs.highestTrackableValue) )
+	{ // same layout => fast path
+		for(size_t index = 0; index < counts.size(); index++)
+			counts[index] += rhs.counts[index];
+
+		totalCount += rhs.totalCount;
+
+		return *this;
+	}
+
+	for(size_t index = 0; index < rhs.counts.size(); index++)
+	{
+		if(rhs.counts[index] )
+			recordValues(rhs.getValueFromIndex(index), rhs.counts[index] );
+	}
+
+	return *this;
+}
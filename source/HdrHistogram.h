@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef HDRHISTOGRAM_H_
+#define HDRHISTOGRAM_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Common.h"
+
+#define HDRHISTO_MIN_SIGNIFICANT_DIGITS		1
+#define HDRHISTO_MAX_SIGNIFICANT_DIGITS		3 // higher values would need MBs per histogram
+
+
+/**
+ * High dynamic range histogram, based on the HdrHistogram design by Gil Tene.
+ *
+ * Values are stored in buckets with exponentially growing size (powers of 2), each of which is
+ * split into linear sub-buckets. The number of sub-buckets is defined by the number of
+ * significant decimal digits, so that the relative error of any recorded value is less than
+ * 1/10^significantDigits across the whole range. E.g. for 2 significant digits, a value of 9500
+ * is stored with a resolution of 64, so that 9000 and 10000 can be told apart.
+ *
+ * Values larger than the highest trackable value are stored in the highest bucket.
+ *
+ * A histogram is unusable for recording until init() was called. Unused histograms can be merged
+ * with an initialized histogram via operator+=, in which case they inherit the configuration.
+ */
+class HdrHistogram
+{
+	public:
+		void init(unsigned significantDigits, uint64_t highestTrackableValue);
+		void reset();
+
+		uint64_t getValueAtPercentile(double percentage) const;
+		std::string getCountsStr() const;
+		void setCountsFromStr(const std::string& countsStr);
+
+		HdrHistogram& operator+=(const HdrHistogram& rhs);
+
+	private:
+		unsigned significantDigits{0}; // 0 means not initialized
+		uint64_t highestTrackableValue{0};
+		unsigned subBucketHalfCountMagnitude{0}; // log2 of subBucketHalfCount
+		uint64_t subBucketHalfCount{0}; // number of sub-buckets in each bucket except the 1st
+		uint64_t subBucketMask{0}; // values smaller than this are stored in the 1st bucket
+		uint64_t totalCount{0}; // number of all recorded values
+		std::vector<uint64_t> counts; // bucket and sub-bucket counters
+
+		void recordValues(uint64_t value, uint64_t count);
+
+		// inliners
+	public:
+		void recordValue(uint64_t value)
+		{
+			IF_UNLIKELY(value > highestTrackableValue)
+				value = highestTrackableValue;
+
+			counts[getCountsIndex(value)]++;
+			totalCount++;
+		}
+
+		unsigned getSignificantDigits() const { return significantDigits; }
+		uint64_t getHighestTrackableValue() const { return highestTrackableValue; }
+		uint64_t getTotalCount() const { return totalCount; }
+		size_t getCountsLen() const { return counts.size(); }
+		uint64_t getCountAtIndex(size_t index) const { return counts[index]; }
+
+		/**
+		 * Get the highest value that is stored in the same sub-bucket as the given value. This is
+		 * the upper bound of all recorded values that are counted in this sub-bucket.
+		 */
+		uint64_t getHighestEquivalentValue(uint64_t value) const
+		{
+			const unsigned bucketIndex = getBucketIndex(value);
+			const uint64_t subBucketIndex = value >> bucketIndex;
+
+			const unsigned rangeMagnitude = (subBucketIndex > subBucketMask) ?
+				(bucketIndex + 1) : bucketIndex;
+
+			return (subBucketIndex << bucketIndex) + (1ULL << rangeMagnitude) - 1;
+		}
+
+		/**
+		 * Get the lowest value that is stored in the counts element of the given index.
+		 */
+		uint64_t getValueFromIndex(size_t index) const
+		{
+			int64_t bucketIndex = (int64_t)(index >> subBucketHalfCountMagnitude) - 1;
+			uint64_t subBucketIndex = (index & (subBucketHalfCount - 1) ) + subBucketHalfCount;
+
+			if(bucketIndex < 0)
+			{ // lower half of 1st bucket
+				subBucketIndex -= subBucketHalfCount;
+				bucketIndex = 0;
+			}
+
+			return subBucketIndex << bucketIndex;
+		}
+
+	private:
+		unsigned getBucketIndex(uint64_t value) const
+		{
+			// (value | mask) is never 0, so clz is safe here
+			const unsigned pow2Ceiling = 64 - __builtin_clzll(value | subBucketMask);
+
+			return pow2Ceiling - (subBucketHalfCountMagnitude + 1);
+		}
+
+		size_t getCountsIndex(uint64_t value) const
+		{
+			const unsigned bucketIndex = getBucketIndex(value);
+			const uint64_t subBucketIndex = value >> bucketIndex;
+
+			return ( (size_t)(bucketIndex + 1) << subBucketHalfCountMagnitude) +
+				(subBucketIndex - subBucketHalfCount);
+		}
+};
+
+#endif /* HDRHISTOGRAM_H_ */
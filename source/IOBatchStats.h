@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef IOBATCHSTATS_H_
+#define IOBATCHSTATS_H_
+
+#include <boost/property_tree/ptree.hpp>
+#include "Common.h"
+
+namespace bpt = boost::property_tree;
+
+/**
+ * Counters for async I/O submission and completion reaping calls (libaio & io_uring) to calculate
+ * the average number of I/Os that were handled per call.
+ *
+ * Only updated by the owning worker thread, so values are only valid at the end of a phase.
+ */
+struct IOBatchStats
+{
+	uint64_t numSubmitCalls{0}; // number of io_submit/io_uring_submit calls
+	uint64_t numSubmittedIOs{0}; // number of I/Os submitted through numSubmitCalls
+	uint64_t numReapCalls{0}; // number of io_getevents/io_uring wait calls that returned events
+	uint64_t numReapedIOs{0}; // number of completions reaped through numReapCalls
+
+	void setToZero()
+	{
+		numSubmitCalls = 0;
+		numSubmittedIOs = 0;
+		numReapCalls = 0;
+		numReapedIOs = 0;
+	}
+
+	/**
+	 * Average number of I/Os per submit call. (0 if nothing was submitted.)
+	 */
+	double getAvgSubmitBatch() const
+	{
+		return numSubmitCalls ? ( (double)numSubmittedIOs / numSubmitCalls) : 0;
+	}
+
+	/**
+	 * Average number of completions per reap call. (0 if nothing was reaped.)
+	 */
+	double getAvgReapBatch() const
+	{
+		return numReapCalls ? ( (double)numReapedIOs / numReapCalls) : 0;
+	}
+
+	IOBatchStats& operator+=(const IOBatchStats& rhs)
+	{
+		numSubmitCalls += rhs.numSubmitCalls;
+		numSubmittedIOs += rhs.numSubmittedIOs;
+		numReapCalls += rhs.numReapCalls;
+		numReapedIOs += rhs.numReapedIOs;
+
+		return *this;
+	}
+
+	void getAsPropertyTreeForService(bpt::ptree& outTree) const
+	{
+		outTree.put(XFER_STATS_IOBATCH_NUMSUBMITCALLS, numSubmitCalls);
+		outTree.put(XFER_STATS_IOBATCH_NUMSUBMITTEDIOS, numSubmittedIOs);
+		outTree.put(XFER_STATS_IOBATCH_NUMREAPCALLS, numReapCalls);
+		outTree.put(XFER_STATS_IOBATCH_NUMREAPEDIOS, numReapedIOs);
+	}
+
+	void setFromPropertyTreeForService(bpt::ptree& tree)
+	{
+		numSubmitCalls = tree.get<uint64_t>(XFER_STATS_IOBATCH_NUMSUBMITCALLS);
+		numSubmittedIOs = tree.get<uint64_t>(XFER_STATS_IOBATCH_NUMSUBMITTEDIOS);
+		numReapCalls = tree.get<uint64_t>(XFER_STATS_IOBATCH_NUMREAPCALLS);
+		numReapedIOs = tree.get<uint64_t>(XFER_STATS_IOBATCH_NUMREAPEDIOS);
+	}
+};
+
+#endif /* IOBATCHSTATS_H_ */
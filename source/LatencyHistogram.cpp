@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: 2020-2025 Sven Breuner and elbencho contributors
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
 // SPDX-License-Identifier: GPL-3.0-only
 
 #include "LatencyHistogram.h"
@@ -14,6 +14,7 @@ void LatencyHistogram::getAsPropertyTreeForJSONFile(bpt::ptree& outTree,
 
     bpt::ptree subtree;
     double bucketRangeStartMicroSec = 0;
+    UInt64Vec buckets;
 
     if(getHistogramExceeded() )
     { // can't show histogram
@@ -24,6 +25,8 @@ void LatencyHistogram::getAsPropertyTreeForJSONFile(bpt::ptree& outTree,
          return;
     }
 
+    getOutputBuckets(buckets);
+
     for(size_t bucketIndex = 0; bucketIndex < LATHISTO_NUMBUCKETS; bucketIndex++)
     {
         const uint64_t rangeMatchCount = buckets[bucketIndex];
@@ -68,13 +71,13 @@ void LatencyHistogram::getAsPropertyTreeForJSONFile(bpt::ptree& outTree,
 void LatencyHistogram::getAsPropertyTreeForService(bpt::ptree& outTree, std::string prefixStr) const
 {
 	outTree.put(prefixStr + XFER_STATS_LATNUMVALUES, numStoredValues);
-	outTree.put(prefixStr + XFER_STATS_LATMICROSECTOTAL, numMicroSecTotal);
-	outTree.put(prefixStr + XFER_STATS_LATMINMICROSEC, minMicroSecLat);
-	outTree.put(prefixStr + XFER_STATS_LATMAXMICROSEC, maxMicroSecLat);
+	outTree.put(prefixStr + XFER_STATS_LATNANOSECTOTAL, numNanoSecTotal);
+	outTree.put(prefixStr + XFER_STATS_LATMINNANOSEC, minNanoSecLat);
+	outTree.put(prefixStr + XFER_STATS_LATMAXNANOSEC, maxNanoSecLat);
 
-	// add histogram buckets
-	for(size_t bucketIndex = 0; bucketIndex < LATHISTO_NUMBUCKETS; bucketIndex++)
-		outTree.add(prefixStr + XFER_STATS_LATHISTOLIST_ITEM, buckets[bucketIndex] );
+	// add non-zero HDR histogram counters
+	outTree.put(prefixStr + XFER_STATS_LATHISTODIGITS, hdrHisto.getSignificantDigits() );
+	outTree.put(prefixStr + XFER_STATS_LATHISTOCOUNTS, hdrHisto.getCountsStr() );
 }
 
 /**
@@ -83,15 +86,47 @@ void LatencyHistogram::getAsPropertyTreeForService(bpt::ptree& outTree, std::str
 void LatencyHistogram::setFromPropertyTreeForService(bpt::ptree& tree, std::string prefixStr)
 {
 	numStoredValues = tree.get<size_t>(prefixStr + XFER_STATS_LATNUMVALUES);
-	numMicroSecTotal = tree.get<size_t>(prefixStr + XFER_STATS_LATMICROSECTOTAL);
-	minMicroSecLat = tree.get<size_t>(prefixStr + XFER_STATS_LATMINMICROSEC);
-	maxMicroSecLat = tree.get<size_t>(prefixStr + XFER_STATS_LATMAXMICROSEC);
+	numNanoSecTotal = tree.get<uint64_t>(prefixStr + XFER_STATS_LATNANOSECTOTAL);
+	minNanoSecLat = tree.get<uint64_t>(prefixStr + XFER_STATS_LATMINNANOSEC);
+	maxNanoSecLat = tree.get<uint64_t>(prefixStr + XFER_STATS_LATMAXNANOSEC);
+
+	// set HDR histogram counters
+	const unsigned significantDigits = tree.get<unsigned>(prefixStr + XFER_STATS_LATHISTODIGITS);
+
+	if(hdrHisto.getSignificantDigits() != significantDigits)
+		hdrHisto.init(significantDigits, LATHISTO_MAXNANOSEC);
+
+	hdrHisto.setCountsFromStr(tree.get<std::string>(prefixStr + XFER_STATS_LATHISTOCOUNTS) );
+}
+
+/**
+ * Group the HDR histogram counters into microsecond log2 buckets for human-readable output.
+ *
+ * @outBuckets will be resized to LATHISTO_NUMBUCKETS.
+ */
+void LatencyHistogram::getOutputBuckets(UInt64Vec& outBuckets) const
+{
+	outBuckets.assign(LATHISTO_NUMBUCKETS, 0);
 
-	// add histogram buckets
-	size_t bucketIndex = 0;
-	for(bpt::ptree::value_type& bucketItem : tree.get_child(prefixStr + XFER_STATS_LATHISTOLIST) )
+	for(size_t index = 0; index < hdrHisto.getCountsLen(); index++)
 	{
-		buckets[bucketIndex] = bucketItem.second.get_value<size_t>();
-		bucketIndex++;
+		const uint64_t count = hdrHisto.getCountAtIndex(index);
+
+		if(!count)
+			continue;
+
+		const uint64_t latencyMicroSec = hdrHisto.getValueFromIndex(index) / 1000;
+		size_t bucketIndex;
+
+		// log2(0) does not exist, so special case
+		if(!latencyMicroSec)
+			bucketIndex = 0;
+		else
+			bucketIndex = std::log2(latencyMicroSec) * LATHISTO_BUCKETFRACTION;
+
+		if(bucketIndex >= LATHISTO_NUMBUCKETS)
+			bucketIndex = LATHISTO_NUMBUCKETS-1;
+
+		outBuckets[bucketIndex] += count;
 	}
 }
@@ -8,102 +8,199 @@
 #include <cmath>
 #include <vector>
 
+#include "HdrHistogram.h"
 #include "ProgArgs.h"
 #include "workers/WorkersSharedData.h"
 
-#define LATHISTO_BUCKETFRACTION		4 // log2 1/n increments between buckets (4 means 1/4=0.25)
+#define LATHISTO_BUCKETFRACTION		4 /* log2 1/n increments between buckets of histogram output
+										(4 means 1/4=0.25) */
 #define LATHISTO_MAXLOG2MICROSEC	28 /* n here means max microsec lat in histogram is
 										(2^n)-(1/LATHISTO_BUCKETFRACTION) */
 #define LATHISTO_NUMBUCKETS			(LATHISTO_MAXLOG2MICROSEC*LATHISTO_BUCKETFRACTION) /* number of
-										available buckets */
+										buckets for histogram output */
+#define LATHISTO_MAXNANOSEC			( (1ULL << LATHISTO_MAXLOG2MICROSEC) * 1000) /* highest
+										trackable latency in HDR histogram */
 
 /**
  * A histogram for operation latency.
  *
- * Organized in microsecond log2 buckets starting and log2(0) and using 1/LATHISTO_BUCKETFRACTION
- * increments between buckets. This means the precision is less for higher latencies. For 2^28
- * microsec (268seconds) buckets with 0.25 (1/4) increments we have 112(=28*(1/0.25) ) buckets.
+ * Latencies are recorded in nanoseconds in a high dynamic range histogram (HdrHistogram), which
+ * preserves the given number of significant digits across the whole range up to 2^28 microsec
+ * (268 seconds), so that percentiles are not quantized to coarse steps.
+ *
+ * For the human-readable histogram output, the values are grouped into microsecond log2 buckets
+ * starting at log2(0) and using 1/LATHISTO_BUCKETFRACTION increments between buckets. For 2^28
+ * microsec buckets with 0.25 (1/4) increments we have 112(=28*(1/0.25) ) output buckets.
  *
  * Min/max/avg functions can always be used after latencies have been added. Histogram and
  * percentile functions should only be used after checking getHistogramExceeded().
+ *
+ * For live percentiles, the recording worker thread additionally writes into one of two interval
+ * histograms. The live stats thread requests a switch to the other interval histogram and drains
+ * the retired one once the worker acknowledged the switch on its next recorded value, so that no
+ * lock is needed on the hot path. As a consequence, the drained interval values lag behind by one
+ * live stats interval.
  */
 class LatencyHistogram
 {
 	public:
-		LatencyHistogram() : buckets(LATHISTO_NUMBUCKETS, 0) {}
-
 		void getAsPropertyTreeForJSONFile(bpt::ptree& outTree, std::string subtreeKey) const;
 		void getAsPropertyTreeForService(bpt::ptree& outTree, std::string prefixStr) const;
 		void setFromPropertyTreeForService(bpt::ptree& tree, std::string prefixStr);
 
 	private:
 		uint64_t numStoredValues{0}; // number of all values stored in all buckets
-		uint64_t numMicroSecTotal{0}; // sum of all values stored in all buckets in microseconds
-		uint64_t minMicroSecLat{(size_t)~0}; // min measured lat val (~0 so any 1st val is smaller)
-		uint64_t maxMicroSecLat{0}; // max measured latency value
-		std::vector<uint64_t> buckets; // buckets represent counters for latency categories
+		uint64_t numNanoSecTotal{0}; // sum of all values stored in all buckets in nanoseconds
+		uint64_t minNanoSecLat{(size_t)~0}; // min measured lat val (~0 so any 1st val is smaller)
+		uint64_t maxNanoSecLat{0}; // max measured latency value
+		HdrHistogram hdrHisto; // counters for latency values (not initialized until reset() )
 		std::atomic_uint64_t numStoredValuesLive{0}; // for live stats
-		std::atomic_uint64_t numMicroSecsTotalLive{0}; // for live stats
+		std::atomic_uint64_t numNanoSecsTotalLive{0}; // for live stats
+
+		bool liveHistosEnabled{false}; // true if liveHistos are initialized for live percentiles
+		HdrHistogram liveHistos[2]; // interval histograms for live percentiles (double-buffered)
+		std::atomic_uint64_t liveEpochRequested{0}; // liveHistos index selector set by stats thread
+		std::atomic_uint64_t liveEpochAcked{0}; // liveEpochRequested value in use by worker thread
+		uint64_t liveEpochDrained{0}; // last epoch for which the retired liveHisto was drained
+
+		void getOutputBuckets(UInt64Vec& outBuckets) const;
 
 		// inliners
 	public:
-		void addLatency(uint64_t latencyMicroSec)
+		void addLatency(uint64_t latencyNanoSec)
 		{
 			// note: live stats update is not atomic across the two vals, but that's negleticable
 			numStoredValuesLive++;
-			numMicroSecsTotalLive += latencyMicroSec;
+			numNanoSecsTotalLive += latencyNanoSec;
 
 			numStoredValues++;
-			numMicroSecTotal += latencyMicroSec;
+			numNanoSecTotal += latencyNanoSec;
 
-			IF_UNLIKELY(latencyMicroSec < minMicroSecLat)
-				minMicroSecLat = latencyMicroSec;
+			IF_UNLIKELY(latencyNanoSec < minNanoSecLat)
+				minNanoSecLat = latencyNanoSec;
 
-			IF_UNLIKELY(latencyMicroSec > maxMicroSecLat)
-				maxMicroSecLat = latencyMicroSec;
+			IF_UNLIKELY(latencyNanoSec > maxNanoSecLat)
+				maxNanoSecLat = latencyNanoSec;
 
-			size_t bucketIndex;
+			hdrHisto.recordValue(latencyNanoSec);
 
-			// log2(0) does not exist, so special case
-			IF_UNLIKELY(!latencyMicroSec)
-				bucketIndex = 0;
-			else
-				bucketIndex = std::log2(latencyMicroSec) * LATHISTO_BUCKETFRACTION;
+			if(liveHistosEnabled)
+			{
+				const uint64_t liveEpoch = liveEpochRequested.load(std::memory_order_acquire);
 
-			IF_UNLIKELY(bucketIndex >= LATHISTO_NUMBUCKETS)
-				bucketIndex = LATHISTO_NUMBUCKETS-1;
+				IF_UNLIKELY(liveEpoch != liveEpochAcked.load(std::memory_order_relaxed) )
+					liveEpochAcked.store(liveEpoch, std::memory_order_release);
 
-			buckets[bucketIndex]++;
+				liveHistos[liveEpoch % 2].recordValue(latencyNanoSec);
+			}
 		}
 
 		size_t getNumStoredValues() const { return numStoredValues; }
-		size_t getMinMicroSecLat() const { return minMicroSecLat; }
-		size_t getMaxMicroSecLat() const { return maxMicroSecLat; }
+		size_t getMinMicroSecLat() const { return minNanoSecLat / 1000; }
+		size_t getMaxMicroSecLat() const { return maxNanoSecLat / 1000; }
+		uint64_t getMinNanoSecLat() const { return minNanoSecLat; }
+		uint64_t getMaxNanoSecLat() const { return maxNanoSecLat; }
 
 		void addAndResetAverageLiveMicroSec(
 			uint64_t& outNumStoredValues, uint64_t& outNumMicroSecsTotal)
 		{
 			outNumStoredValues += numStoredValuesLive;
-			outNumMicroSecsTotal += numMicroSecsTotalLive;
+			outNumMicroSecsTotal += numNanoSecsTotalLive / 1000;
 
 			numStoredValuesLive = 0;
-			numMicroSecsTotalLive = 0;
+			numNanoSecsTotalLive = 0;
+		}
+
+		/**
+		 * Add the interval histogram that the worker retired with its last acknowledged switch to
+		 * outHisto and request the next switch. Only to be called by the live stats thread.
+		 *
+		 * @outHisto may be uninitialized, in which case it inherits the layout of the live histos.
+		 */
+		void addAndSwitchLiveHisto(HdrHistogram& outHisto)
+		{
+			if(!liveHistosEnabled)
+				return;
+
+			const uint64_t requestedEpoch = liveEpochRequested.load(std::memory_order_relaxed);
+
+			if(liveEpochAcked.load(std::memory_order_acquire) != requestedEpoch)
+				return; // worker still records into the other histo (e.g. waiting for slow I/O)
+
+			if(liveEpochDrained != requestedEpoch)
+			{ // worker switched since our last visit, so the other histo is retired now
+				HdrHistogram& retiredHisto = liveHistos[(requestedEpoch + 1) % 2];
+
+				outHisto += retiredHisto;
+				retiredHisto.reset();
+
+				liveEpochDrained = requestedEpoch;
+			}
+
+			liveEpochRequested.store(requestedEpoch + 1, std::memory_order_release);
 		}
 
 		size_t getAverageMicroSec() const
 		{
-			return numStoredValues ? (numMicroSecTotal / numStoredValues) : 0;
+			return numStoredValues ? (numNanoSecTotal / numStoredValues / 1000) : 0;
 		}
 
-		void reset()
+		uint64_t getAverageNanoSec() const
 		{
-			for(size_t bucketIndex = 0; bucketIndex < LATHISTO_NUMBUCKETS; bucketIndex++)
-				buckets[bucketIndex] = 0;
+			return numStoredValues ? (numNanoSecTotal / numStoredValues) : 0;
+		}
+
+		/**
+		 * Note: Not thread-safe, so live stats thread must not call addAndSwitchLiveHisto()
+		 * concurrently.
+		 *
+		 * @significantDigits number of significant digits for HDR histogram; the histogram gets
+		 * 	reallocated if this differs from the previous value.
+		 * @enableLiveHistos true to also record into interval histograms for live percentiles.
+		 */
+		void reset(unsigned significantDigits, bool enableLiveHistos)
+		{
+			if(hdrHisto.getSignificantDigits() != significantDigits)
+				hdrHisto.init(significantDigits, LATHISTO_MAXNANOSEC);
+			else
+				hdrHisto.reset();
+
+			for(HdrHistogram& liveHisto : liveHistos)
+			{
+				if(!enableLiveHistos)
+					liveHisto = HdrHistogram(); // release memory
+				else
+				if(liveHisto.getSignificantDigits() != significantDigits)
+					liveHisto.init(significantDigits, LATHISTO_MAXNANOSEC);
+				else
+					liveHisto.reset();
+			}
+
+			liveHistosEnabled = enableLiveHistos;
+			liveEpochRequested = 0;
+			liveEpochAcked = 0;
+			liveEpochDrained = 0;
 
 			numStoredValues = 0;
-			numMicroSecTotal = 0;
-			minMicroSecLat = ~0; // ~0 so that any 1st measured value is smaller
-			maxMicroSecLat = 0;
+			numNanoSecTotal = 0;
+			minNanoSecLat = ~0; // ~0 so that any 1st measured value is smaller
+			maxNanoSecLat = 0;
+		}
+
+		/**
+		 * Reset all recorded values except for the live stats values, e.g. at the end of a warmup
+		 * period. Only to be called by the recording worker thread. The live stats thread can
+		 * continue to call addAndResetAverageLiveMicroSec() and addAndSwitchLiveHisto()
+		 * concurrently.
+		 */
+		void resetTotals()
+		{
+			hdrHisto.reset();
+
+			numStoredValues = 0;
+			numNanoSecTotal = 0;
+			minNanoSecLat = ~0; // ~0 so that any 1st measured value is smaller
+			maxNanoSecLat = 0;
 		}
 
 		std::string getHistogramStr() const
@@ -113,6 +210,9 @@ class LatencyHistogram
 
 			std::ostringstream stream;
 			double log2BucketSize = 1.0 / LATHISTO_BUCKETFRACTION;
+			UInt64Vec buckets;
+
+			getOutputBuckets(buckets);
 
 			for(size_t bucketIndex = 0; bucketIndex < LATHISTO_NUMBUCKETS; bucketIndex++)
 			{
@@ -135,31 +235,16 @@ class LatencyHistogram
 		/**
 		 * Get the upper latency bound for a given percentage of values.
 		 *
-		 * @return upper latency bound in microseconds.
+		 * @return upper latency bound in microseconds (with fraction for sub-microsec precision).
 		 */
 		double getPercentile(double percentage) const
 		{
-			size_t numValuesSoFar = 0;
-			double log2BucketSize = 1.0 / LATHISTO_BUCKETFRACTION;
-
-			for(size_t bucketIndex = 0; bucketIndex < LATHISTO_NUMBUCKETS; bucketIndex++)
-			{
-				numValuesSoFar += buckets[bucketIndex];
-
-				double percentileSoFar = (double)numValuesSoFar / numStoredValues;
-
-				if(percentileSoFar >= (percentage/100) )
-				{ // we added enough buckets for given percentage
-					double bucketMicroSec = pow(2, (bucketIndex+1)*log2BucketSize);
-					return bucketMicroSec;
-				}
-			}
-
-			return 0; // should never happen
+			return hdrHisto.getValueAtPercentile(percentage) / 1000.0;
 		}
 
 		/**
-		 * Get lat percentile as string with precision=1 for results < 10 and precision=0 otherwise.
+		 * Get lat percentile as string with 3 significant digits (but at least precision=0), so
+		 * that e.g. 9.25us and 9.75us can be told apart.
 		 */
 		std::string getPercentileStr(double percentage) const
 		{
@@ -167,7 +252,10 @@ class LatencyHistogram
 
 			std::ostringstream stream;
 
-			stream << std::fixed << std::setprecision(percentile < 10 ? 1 : 0) << percentile;
+			const int precision = (percentile < 1) ? 3 : (percentile < 10) ? 2 :
+				(percentile < 100) ? 1 : 0;
+
+			stream << std::fixed << std::setprecision(precision) << percentile;
 
 			return stream.str();
 		}
@@ -179,22 +267,21 @@ class LatencyHistogram
 		 */
 		bool getHistogramExceeded() const
 		{
-			return buckets[LATHISTO_NUMBUCKETS-1] ? true : false;
+			return (maxNanoSecLat >= LATHISTO_MAXNANOSEC);
 		}
 
 		LatencyHistogram& operator+=(const LatencyHistogram& rhs)
 		{
-			for(size_t bucketIndex = 0; bucketIndex < LATHISTO_NUMBUCKETS; bucketIndex++)
-				buckets[bucketIndex] += rhs.buckets[bucketIndex];
+			hdrHisto += rhs.hdrHisto;
 
 			numStoredValues += rhs.numStoredValues;
-			numMicroSecTotal += rhs.numMicroSecTotal;
+			numNanoSecTotal += rhs.numNanoSecTotal;
 
-			if(rhs.minMicroSecLat < minMicroSecLat)
-				minMicroSecLat = rhs.minMicroSecLat;
+			if(rhs.minNanoSecLat < minNanoSecLat)
+				minNanoSecLat = rhs.minNanoSecLat;
 
-			if(rhs.maxMicroSecLat > maxMicroSecLat)
-				maxMicroSecLat = rhs.maxMicroSecLat;
+			if(rhs.maxNanoSecLat > maxNanoSecLat)
+				maxNanoSecLat = rhs.maxNanoSecLat;
 
 			return *this;
 		}
@@ -5,6 +5,7 @@
 #define LIVELATENCY_H_
 
 #include "Common.h"
+#include "HdrHistogram.h"
 
 /**
  * Struct for live latency variables.
@@ -23,6 +24,12 @@ struct LiveLatency
 	uint64_t numAvgEntriesLatReadMixValues; // number of values included in sum below (for avg calc)
 	uint64_t avgEntriesLatReadMixMicrosSecsSum; // sum of all numValues workers
 
+	// interval histograms for live percentiles (uninitialized if live percentiles are disabled)
+	HdrHistogram ioLatHisto;
+	HdrHistogram ioLatReadMixHisto;
+	HdrHistogram entriesLatHisto;
+	HdrHistogram entriesLatReadMixHisto;
+
 	void setToZero()
 	{
 		numAvgIOLatValues = 0;
@@ -36,6 +43,11 @@ struct LiveLatency
 
 		numAvgEntriesLatReadMixValues = 0;
 		avgEntriesLatReadMixMicrosSecsSum = 0;
+
+		ioLatHisto.reset();
+		ioLatReadMixHisto.reset();
+		entriesLatHisto.reset();
+		entriesLatReadMixHisto.reset();
 	}
 
 	/**
@@ -54,6 +66,11 @@ struct LiveLatency
 
 		outSumLat.numAvgEntriesLatReadMixValues += numAvgEntriesLatReadMixValues;
 		outSumLat.avgEntriesLatReadMixMicrosSecsSum += avgEntriesLatReadMixMicrosSecsSum;
+
+		outSumLat.ioLatHisto += ioLatHisto;
+		outSumLat.ioLatReadMixHisto += ioLatReadMixHisto;
+		outSumLat.entriesLatHisto += entriesLatHisto;
+		outSumLat.entriesLatReadMixHisto += entriesLatReadMixHisto;
 	}
 
 	/**
@@ -46,13 +46,20 @@ struct LiveOps
 		outLiveOps.numIOPSDone = UnitTk::getPerSecFromUSec(numIOPSDone, elapsedUsec);
 	}
 
+	/**
+	 * Difference to older values. Counters which are lower than the older value were reset at the
+	 * end of the warmup period in the meantime, so their current value is the difference.
+	 */
 	LiveOps operator-(const LiveOps& other) const
     {
 		LiveOps result;
 
-		result.numEntriesDone = numEntriesDone - other.numEntriesDone;
-		result.numBytesDone = numBytesDone - other.numBytesDone;
-		result.numIOPSDone = numIOPSDone - other.numIOPSDone;
+		result.numEntriesDone = (numEntriesDone >= other.numEntriesDone) ?
+			(numEntriesDone - other.numEntriesDone) : numEntriesDone;
+		result.numBytesDone = (numBytesDone >= other.numBytesDone) ?
+			(numBytesDone - other.numBytesDone) : numBytesDone;
+		result.numIOPSDone = (numIOPSDone >= other.numIOPSDone) ?
+			(numIOPSDone - other.numIOPSDone) : numIOPSDone;
 
         return result;
     }
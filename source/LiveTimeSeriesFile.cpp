@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <unistd.h>
+#include "LiveTimeSeriesFile.h"
+#include "ProgException.h"
+
+namespace bpt = boost::property_tree;
+
+static_assert(sizeof(LiveTimeSeriesFileHeader) == 16, "Unexpected time-series file header size");
+static_assert(sizeof(LiveTimeSeriesRecordHeader) == 8, "Unexpected time-series record hdr size");
+static_assert(sizeof(LiveTimeSeriesPhase) == 112, "Unexpected time-series phase record size");
+static_assert(sizeof(LiveTimeSeriesSample) == 104, "Unexpected time-series sample record size");
+
+/**
+ * Open file for appending. Writes the file header if the file is empty, otherwise checks that the
+ * existing header is compatible.
+ *
+ * @throw ProgException on error.
+ */
+void LiveTimeSeriesFile::openFile(const std::string& path)
+{
+	this->path = path;
+
+	fd = open(path.c_str(), O_RDWR | O_APPEND | O_CREAT, MKFILE_MODE);
+	if(fd == -1)
+		throw ProgException("Unable to open live time-series file: " + path + "; "
+			"SysErr: " + strerror(errno) );
+
+	LiveTimeSeriesFileHeader fileHeader;
+	memset(&fileHeader, 0, sizeof(fileHeader) );
+
+	ssize_t readRes = pread(fd, &fileHeader, sizeof(fileHeader), 0);
+
+	if(readRes == 0)
+	{ // new file => write header
+		memcpy(fileHeader.magic, LIVETIMESERIES_MAGIC, sizeof(fileHeader.magic) );
+		fileHeader.version = LIVETIMESERIES_VERSION;
+		fileHeader.byteOrderMark = LIVETIMESERIES_BYTEORDERMARK;
+
+		ssize_t writeRes = write(fd, &fileHeader, sizeof(fileHeader) );
+		if(writeRes != sizeof(fileHeader) )
+			throw ProgException("Unable to write header to live time-series file: " + path);
+
+		return;
+	}
+
+	if( (readRes != sizeof(fileHeader) ) ||
+		memcmp(fileHeader.magic, LIVETIMESERIES_MAGIC, sizeof(fileHeader.magic) ) ||
+		(fileHeader.version != LIVETIMESERIES_VERSION) ||
+		(fileHeader.byteOrderMark != LIVETIMESERIES_BYTEORDERMARK) )
+		throw ProgException("Existing file is not a compatible live time-series file: " + path);
+}
+
+void LiveTimeSeriesFile::closeFile()
+{
+	if(fd == -1)
+		return;
+
+	flush();
+
+	close(fd);
+	fd = -1;
+}
+
+/**
+ * Add the record for the start of a new phase to the buffer.
+ */
+void LiveTimeSeriesFile::addPhase(const std::string& phaseName, const std::string& benchLabel,
+	uint32_t numWorkers, bool isMasterMode, uint64_t startEpochMS)
+{
+	LiveTimeSeriesPhase phase;
+	memset(&phase, 0, sizeof(phase) );
+
+	phase.startEpochMS = startEpochMS;
+	phase.numWorkers = numWorkers;
+	phase.isMasterMode = isMasterMode;
+
+	// (memset above ensures zero termination)
+	strncpy(phase.phaseName, phaseName.c_str(), sizeof(phase.phaseName) - 1);
+	strncpy(phase.benchLabel, benchLabel.c_str(), sizeof(phase.benchLabel) - 1);
+
+	addRecord(LIVETIMESERIES_RECORD_PHASE, &phase, sizeof(phase) );
+}
+
+/**
+ * Add a sample record to the buffer.
+ */
+void LiveTimeSeriesFile::addSample(const LiveTimeSeriesSample& sample)
+{
+	addRecord(LIVETIMESERIES_RECORD_SAMPLE, &sample, sizeof(sample) );
+}
+
+void LiveTimeSeriesFile::addRecord(uint16_t type, const void* payload, uint32_t payloadLen)
+{
+	LiveTimeSeriesRecordHeader recordHeader;
+	memset(&recordHeader, 0, sizeof(recordHeader) );
+
+	recordHeader.type = type;
+	recordHeader.payloadLen = payloadLen;
+
+	const size_t oldBufLen = recordBuf.size();
+
+	recordBuf.resize(oldBufLen + sizeof(recordHeader) + payloadLen);
+
+	memcpy(&recordBuf[oldBufLen], &recordHeader, sizeof(recordHeader) );
+	memcpy(&recordBuf[oldBufLen + sizeof(recordHeader)], payload, payloadLen);
+}
+
+/**
+ * Write buffered records to file. Write errors are ignored like for the live CSV file, because
+ * they shouldn't abort the benchmark.
+ */
+void LiveTimeSeriesFile::flush()
+{
+	if( (fd == -1) || recordBuf.empty() )
+		return;
+
+	ssize_t writeRes = write(fd, recordBuf.data(), recordBuf.size() );
+
+	if(writeRes) {} // only exists to mute compiler warning about unused write() result
+
+	recordBuf.clear(); // (keeps capacity for next interval)
+}
+
+/**
+ * Convert a live time-series file to JSON lines, i.e. one JSON object per phase or sample record.
+ * Sample lines contain the phase name and the absolute time, so that they can be processed
+ * independently.
+ *
+ * @outStream where to write the JSON lines.
+ * @throw ProgException if the file cannot be read or is not a valid time-series file.
+ */
+void LiveTimeSeriesFile::convertToJSON(const std::string& path, std::ostream& outStream)
+{
+	std::ifstream fileStream(path, std::ios::binary);
+	if(!fileStream)
+		throw ProgException("Unable to open live time-series file: " + path);
+
+	LiveTimeSeriesFileHeader fileHeader;
+
+	if(!fileStream.read( (char*)&fileHeader, sizeof(fileHeader) ) ||
+		memcmp(fileHeader.magic, LIVETIMESERIES_MAGIC, sizeof(fileHeader.magic) ) )
+		throw ProgException("Not a live time-series file: " + path);
+
+	if(fileHeader.byteOrderMark != LIVETIMESERIES_BYTEORDERMARK)
+		throw ProgException("Live time-series file was written on a host with different byte "
+			"order: " + path);
+
+	if(fileHeader.version != LIVETIMESERIES_VERSION)
+		throw ProgException("Unsupported live time-series file version: " +
+			std::to_string(fileHeader.version) + "; File: " + path);
+
+	LiveTimeSeriesPhase phase;
+	memset(&phase, 0, sizeof(phase) );
+
+	std::vector<char> payloadBuf;
+	LiveTimeSeriesRecordHeader recordHeader;
+
+	while(fileStream.read( (char*)&recordHeader, sizeof(recordHeader) ) )
+	{
+		payloadBuf.resize(recordHeader.payloadLen);
+
+		if(!fileStream.read(payloadBuf.data(), recordHeader.payloadLen) )
+			throw ProgException("Live time-series file ends with incomplete record: " + path);
+
+		bpt::ptree tree;
+
+		if( (recordHeader.type == LIVETIMESERIES_RECORD_PHASE) &&
+			(recordHeader.payloadLen >= sizeof(phase) ) )
+		{
+			memcpy(&phase, payloadBuf.data(), sizeof(phase) );
+
+			tree.put("record", "phase");
+			tree.put("phase", phase.phaseName);
+			tree.put("label", phase.benchLabel);
+			tree.put("start_epoch_ms", phase.startEpochMS);
+			tree.put("num_workers", phase.numWorkers);
+			tree.put("worker_type", phase.isMasterMode ? "host" : "thread");
+		}
+		else
+		if( (recordHeader.type == LIVETIMESERIES_RECORD_SAMPLE) &&
+			(recordHeader.payloadLen >= sizeof(LiveTimeSeriesSample) ) )
+		{
+			LiveTimeSeriesSample sample;
+			memcpy(&sample, payloadBuf.data(), sizeof(sample) );
+
+			tree.put("record", "sample");
+			tree.put("phase", phase.phaseName);
+			tree.put("epoch_ms", phase.startEpochMS + sample.elapsedMS);
+			tree.put("elapsed_ms", sample.elapsedMS);
+
+			if(sample.workerIndex == LIVETIMESERIES_WORKER_TOTAL)
+				tree.put("worker", "total");
+			else
+				tree.put("worker", sample.workerIndex);
+
+			if(sample.mixType == LIVETIMESERIES_MIX_READ)
+				tree.put("mix", "read");
+
+			if(sample.cpuUtilPercent != LIVETIMESERIES_UNKNOWN_U16)
+				tree.put("cpu_util", sample.cpuUtilPercent);
+
+			if(sample.numActiveThreads != LIVETIMESERIES_UNKNOWN_U32)
+				tree.put("active_threads", sample.numActiveThreads);
+
+			tree.put("bytes_done", sample.numBytesDone);
+			tree.put("iops_done", sample.numIOPSDone);
+			tree.put("entries_done", sample.numEntriesDone);
+			tree.put("bytes_per_sec", sample.bytesPerSec);
+			tree.put("iops_per_sec", sample.iopsPerSec);
+			tree.put("entries_per_sec", sample.entriesPerSec);
+
+			const char* percentileKeys[] = {"p50", "p99", "p99_9"};
+
+			if(sample.ioLatAvgMicroSec != LIVETIMESERIES_UNKNOWN_U32)
+				tree.put("io_lat_us.avg", sample.ioLatAvgMicroSec);
+
+			for(size_t i = 0; i < 3; i++)
+				if(sample.ioLatPercentilesMicroSec[i] != LIVETIMESERIES_UNKNOWN_U32)
+					tree.put(std::string("io_lat_us.") + percentileKeys[i],
+						sample.ioLatPercentilesMicroSec[i] );
+
+			if(sample.entriesLatAvgMicroSec != LIVETIMESERIES_UNKNOWN_U32)
+				tree.put("entries_lat_us.avg", sample.entriesLatAvgMicroSec);
+
+			for(size_t i = 0; i < 3; i++)
+				if(sample.entriesLatPercentilesMicroSec[i] != LIVETIMESERIES_UNKNOWN_U32)
+					tree.put(std::string("entries_lat_us.") + percentileKeys[i],
+						sample.entriesLatPercentilesMicroSec[i] );
+		}
+		else
+			continue; // unknown record type (e.g. from newer version) => skip
+
+		bpt::write_json(outStream, tree, false);
+	}
+}
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef LIVETIMESERIESFILE_H_
+#define LIVETIMESERIESFILE_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Common.h"
+
+#define LIVETIMESERIES_MAGIC			"ELBTSF01" // 8 bytes at start of file (without '\0')
+#define LIVETIMESERIES_VERSION			1
+#define LIVETIMESERIES_BYTEORDERMARK	0x01020304 // to detect files from other architectures
+#define LIVETIMESERIES_WORKER_TOTAL		0xFFFFFFFF // workerIndex of total/aggregate samples
+#define LIVETIMESERIES_UNKNOWN_U16		0xFFFF // value not available (e.g. per-thread cpu util)
+#define LIVETIMESERIES_UNKNOWN_U32		0xFFFFFFFF // value not available
+
+#define LIVETIMESERIES_RECORD_PHASE		1 // payload is LiveTimeSeriesPhase
+#define LIVETIMESERIES_RECORD_SAMPLE	2 // payload is LiveTimeSeriesSample
+
+#define LIVETIMESERIES_MIX_NONE			0 // not an rwmix phase or rwmix write values
+#define LIVETIMESERIES_MIX_READ			1 // rwmix read values
+
+
+/**
+ * File header. Followed by records, each of which starts with a LiveTimeSeriesRecordHeader. All
+ * values are in native byte order of the writing host, see byteOrderMark.
+ */
+struct LiveTimeSeriesFileHeader
+{
+	char magic[8]; // LIVETIMESERIES_MAGIC
+	uint32_t version; // LIVETIMESERIES_VERSION
+	uint32_t byteOrderMark; // LIVETIMESERIES_BYTEORDERMARK
+};
+
+/**
+ * Header of each record. Readers skip records of unknown type based on payloadLen.
+ */
+struct LiveTimeSeriesRecordHeader
+{
+	uint16_t type; // LIVETIMESERIES_RECORD_...
+	uint16_t reserved;
+	uint32_t payloadLen; // number of bytes following this header
+};
+
+/**
+ * Start of a new benchmark phase. All following samples belong to this phase.
+ */
+struct LiveTimeSeriesPhase
+{
+	uint64_t startEpochMS; // phase start time in milliseconds since the epoch
+	uint32_t numWorkers; // number of worker threads (standalone) or service hosts (master)
+	uint32_t isMasterMode; // 1 if workers are service hosts, 0 if workers are threads
+	char phaseName[32]; // zero-terminated
+	char benchLabel[64]; // zero-terminated (truncated if longer)
+};
+
+/**
+ * Values of a single live stats interval for all workers (total) or a single worker. Done values
+ * are counted from the phase start (or from the end of the warmup period), per-sec values and
+ * latencies are for the interval since the previous sample.
+ */
+struct LiveTimeSeriesSample
+{
+	uint64_t elapsedMS; // time since phase start
+	uint32_t workerIndex; // thread rank or service host index; LIVETIMESERIES_WORKER_TOTAL
+	uint16_t mixType; // LIVETIMESERIES_MIX_...
+	uint16_t cpuUtilPercent; // LIVETIMESERIES_UNKNOWN_U16 if not available
+	uint32_t numActiveThreads; // LIVETIMESERIES_UNKNOWN_U32 if not available
+	uint32_t reserved;
+	uint64_t numBytesDone;
+	uint64_t numIOPSDone;
+	uint64_t numEntriesDone;
+	uint64_t bytesPerSec;
+	uint64_t iopsPerSec;
+	uint64_t entriesPerSec;
+	uint32_t ioLatAvgMicroSec; // LIVETIMESERIES_UNKNOWN_U32 if no values in interval
+	uint32_t ioLatPercentilesMicroSec[3]; // p50, p99, p99.9; UNKNOWN if live percentiles disabled
+	uint32_t entriesLatAvgMicroSec; // LIVETIMESERIES_UNKNOWN_U32 if no values in interval
+	uint32_t entriesLatPercentilesMicroSec[3]; // p50, p99, p99.9; see ioLatPercentilesMicroSec
+};
+
+
+/**
+ * Binary time-series file for live statistics. Fixed-size records per interval avoid the
+ * formatting overhead of the live CSV file, so that short intervals and many workers remain cheap.
+ * Records of an interval get buffered and written with a single write() call.
+ */
+class LiveTimeSeriesFile
+{
+	public:
+		~LiveTimeSeriesFile()
+		{
+			closeFile();
+		}
+
+		void openFile(const std::string& path);
+		void closeFile();
+		void addPhase(const std::string& phaseName, const std::string& benchLabel,
+			uint32_t numWorkers, bool isMasterMode, uint64_t startEpochMS);
+		void addSample(const LiveTimeSeriesSample& sample);
+		void flush();
+
+		static void convertToJSON(const std::string& path, std::ostream& outStream);
+
+	private:
+		std::string path;
+		int fd{-1};
+		std::vector<char> recordBuf; // records of the current interval (written by flush() )
+
+		void addRecord(uint16_t type, const void* payload, uint32_t payloadLen);
+
+	// inliners
+	public:
+		bool isOpen() const { return (fd != -1); }
+};
+
+#endif /* LIVETIMESERIESFILE_H_ */
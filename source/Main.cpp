@@ -3,9 +3,12 @@
 
 #include <cstdlib>
 #include <exception>
+#include <iostream>
 #include "Coordinator.h"
+#include "LiveTimeSeriesFile.h"
 #include "Logger.h"
 #include "ProgArgs.h"
+#include "toolkits/OpsLogger.h"
 
 /**
  * Parse command line args, check if we just need to print help and otherwise leave the rest to the
@@ -29,6 +32,18 @@ int main(int argc, char** argv)
 			return EXIT_SUCCESS;
 		}
 
+		if(progArgs.hasUserRequestedLiveBinConversion() )
+		{
+			LiveTimeSeriesFile::convertToJSON(progArgs.getLiveBinToJSONPath(), std::cout);
+			return EXIT_SUCCESS;
+		}
+
+		if(progArgs.hasUserRequestedOpsLogConversion() )
+		{
+			OpsLogger::convertBinaryToJSON(progArgs.getOpsLogToJSONPath(), std::cout);
+			return EXIT_SUCCESS;
+		}
+
 		time_t waittimeSec = progArgs.getStartTime() ? progArgs.getStartTime() - time(NULL) : 0;
 
 		// print original command line
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef OPENLOOPSTATS_H_
+#define OPENLOOPSTATS_H_
+
+#include <algorithm>
+#include <boost/property_tree/ptree.hpp>
+#include "Common.h"
+
+namespace bpt = boost::property_tree;
+
+/**
+ * Counters for open-loop load generation to report how far workers fell behind their arrival
+ * schedule.
+ *
+ * Only updated by the owning worker thread, so values are only valid at the end of a phase.
+ */
+struct OpenLoopStats
+{
+	uint64_t numOps{0}; // number of ops issued according to the arrival schedule
+	uint64_t numLateOps{0}; // ops issued when at least one more op was already due
+	uint64_t maxBacklog{0}; // max number of ops that were due but not issued yet
+
+	void setToZero()
+	{
+		numOps = 0;
+		numLateOps = 0;
+		maxBacklog = 0;
+	}
+
+	/**
+	 * Percentage of ops that were issued behind schedule. (0 if no ops were issued.)
+	 */
+	double getLatePercent() const
+	{
+		return numOps ? ( (100.0 * numLateOps) / numOps) : 0;
+	}
+
+	/**
+	 * Note: maxBacklog is the max of all workers, not the sum.
+	 */
+	OpenLoopStats& operator+=(const OpenLoopStats& rhs)
+	{
+		numOps += rhs.numOps;
+		numLateOps += rhs.numLateOps;
+		maxBacklog = std::max(maxBacklog, rhs.maxBacklog);
+
+		return *this;
+	}
+
+	void getAsPropertyTreeForService(bpt::ptree& outTree) const
+	{
+		outTree.put(XFER_STATS_OPENLOOP_NUMOPS, numOps);
+		outTree.put(XFER_STATS_OPENLOOP_NUMLATEOPS, numLateOps);
+		outTree.put(XFER_STATS_OPENLOOP_MAXBACKLOG, maxBacklog);
+	}
+
+	void setFromPropertyTreeForService(bpt::ptree& tree)
+	{
+		numOps = tree.get<uint64_t>(XFER_STATS_OPENLOOP_NUMOPS);
+		numLateOps = tree.get<uint64_t>(XFER_STATS_OPENLOOP_NUMLATEOPS);
+		maxBacklog = tree.get<uint64_t>(XFER_STATS_OPENLOOP_MAXBACKLOG);
+	}
+};
+
+#endif /* OPENLOOPSTATS_H_ */
@@ -16,13 +16,16 @@
 
 #include "ProgArgs.h"
 #include "Common.h"
+#include "HdrHistogram.h"
 #include "Logger.h"
 #include "PathStore.h"
 #include "ProgException.h"
+#include "SteadyStateDetector.h"
 #include "toolkits/FileTk.h"
 #include "toolkits/HashTk.h"
 #include "toolkits/NumaTk.h"
 #include "toolkits/random/RandAlgoSelectorTk.h"
+#include "toolkits/RateLimiter.h"
 #include "toolkits/S3Tk.h"
 #include "toolkits/StringTk.h"
 #include "toolkits/SystemTk.h"
@@ -148,7 +151,8 @@ ProgArgs::ProgArgs(int argc, char** argv) :
 
     LoggerBase::setFilterLevel( (LogLevel)logLevel);
 
-    if(hasUserRequestedHelp() || hasUserRequestedVersion() )
+    if(hasUserRequestedHelp() || hasUserRequestedVersion() ||
+        hasUserRequestedLiveBinConversion() || hasUserRequestedOpsLogConversion() )
         return;
 
     bpo::options_description configFileOptions;
@@ -260,10 +264,28 @@ void ProgArgs::defineAllowedArgs()
 			"When GPUs are given then the CUDA default (\"XORWOW\") random generator will be "
 			"used and this value is ignored. "
 			"(Default: " RANDALGO_FAST_STR ")")
+/*bl*/	(ARG_BLOCKVARPOOL_LONG, bpo::value(&this->blockVarPoolSize),
+			"Number of different random blocks to pre-generate per worker thread for writes with "
+			"\"--" ARG_BLOCKVARIANCE_LONG "\". Writes then rotate through these blocks instead of "
+			"refilling the I/O buffer with random data before each write, which saves CPU "
+			"cycles at high throughput. To keep written data non-dedupable, a new random 64bit "
+			"value is placed into each 4KiB of the random part of a block before it gets reused. "
+			"Memory usage per thread is this number times block size. Must be at least the "
+			"value of \"--" ARG_IODEPTH_LONG "\". Only for file and block device mode. "
+			"(Default: 0 for disabled)")
 /*bl*/	(ARG_BLOCKVARIANCE_LONG, bpo::value(&this->blockVariancePercent),
 			"Block variance percentage. Defines the percentage of each block that will be refilled "
 			"with random data between writes. This can be used to defeat "
 			"compression/deduplication. (Default: 100; Range: 0-100)")
+/*co*/	(ARG_COMPRESSRATIO_LONG, bpo::value(&this->compressRatio),
+			"Target compression ratio for written data, e.g. \"2\" for 2:1 or \"3.5\" for 3.5:1. "
+			"Instead of fully random data, blocks will consist of random data and repeated parts "
+			"of the same 4KiB, so that LZ-based compression (e.g. lz4, zstd, deflate) achieves "
+			"approximately the given ratio also when each 4KiB is compressed independently. "
+			"The random data comes from the \"--" ARG_BLOCKVARIANCEALGO_LONG "\" algorithm. "
+			"Use \"--" ARG_DRYRUN_LONG "\" to see the ratio for generated data based on a "
+			"built-in lz4-like estimator. Requires \"--" ARG_BLOCKVARIANCE_LONG " 100\". "
+			"(Default: 0 for random data)")
 /*c*/	(ARG_CONFIGFILE_LONG "," ARG_CONFIGFILE_SHORT, bpo::value(&this->configFilePath),
 			"Path to benchmark configuration file. All command line options starting with "
 			"double dashes can be used as \"OPTIONNAME=VALUE\" in the config file. Multiple "
@@ -282,7 +304,9 @@ void ProgArgs::defineAllowedArgs()
 			"(Hint: See 'lscpu' for available CPU cores.)")
 #endif // COREBIND_SUPPORT
 /*cp*/	(ARG_CPUUTIL_LONG, bpo::bool_switch(&this->showCPUUtilization),
-			"Show CPU utilization in phase stats results.")
+			"Show CPU utilization in phase stats results. This also shows the CPU time, context "
+			"switches and page faults of the worker threads, the peak memory usage of the "
+			"process and the CPU time per IO and per GB transferred.")
 /*cs*/  (ARG_CSVFILE_LONG, bpo::value(&this->resFilePathCSV),
             "Path to file for end results in csv format. This way, results can be imported e.g. "
             "into MS Excel. If the file exists, results will be appended. (See also \"--"
@@ -300,6 +324,28 @@ void ProgArgs::defineAllowedArgs()
 /*cu*/	(ARG_CUHOSTBUFREG_LONG, bpo::bool_switch(&this->useCuHostBufReg),
 			"Pin host memory buffers and register with CUDA for faster transfer to/from GPU.")
 #endif
+/*de*/	(ARG_DEDUPECHUNK_LONG, bpo::value(&this->dedupeChunkSizeOrigStr),
+			"Granularity of duplicate data for \"--" ARG_DEDUPEPERCENT_LONG "\", typically the "
+			"dedupe block size of the storage system. Block size needs to be a multiple of this. "
+			"(Default: 4K)")
+/*de*/	(ARG_DEDUPEPERCENT_LONG, bpo::value(&this->dedupePercent),
+			"Percentage of written data chunks (see \"--" ARG_DEDUPECHUNK_LONG "\") that "
+			"are exact duplicates of chunks that were written earlier. The resulting dedupe ratio "
+			"is 100/(100-pct), e.g. 50 for 2:1. The data is generated from the seed given via "
+			"\"--" ARG_DEDUPESEED_LONG "\", so it is the same for repeated runs. "
+			"Can be combined with \"--" ARG_COMPRESSRATIO_LONG "\". "
+			"Requires \"--" ARG_BLOCKVARIANCE_LONG " 100\". (Default: 0; Range: 0-99)")
+/*de*/	(ARG_DEDUPESCOPE_LONG, bpo::value(&this->dedupeScopeOrigStr),
+			"Which earlier written chunks can be duplicated for \"--" ARG_DEDUPEPERCENT_LONG "\". "
+			"\"" ARG_DEDUPESCOPE_THREAD_NAME "\": chunks written by the same worker thread, "
+			"which includes chunks in the same file and in other files of this thread. "
+			"\"" ARG_DEDUPESCOPE_HOST_NAME "\": chunks written by any worker thread of the same "
+			"host. "
+			"\"" ARG_DEDUPESCOPE_GLOBAL_NAME "\": chunks written by any worker thread on any of "
+			"the given service hosts. (Default: " ARG_DEDUPESCOPE_THREAD_NAME ")")
+/*de*/	(ARG_DEDUPESEED_LONG, bpo::value(&this->dedupeSeed),
+			"Seed for data generation with \"--" ARG_DEDUPEPERCENT_LONG "\". Runs with the same "
+			"seed and same number of threads and hosts write the same data. (Default: 0)")
 /*D*/	(ARG_DELETEDIRS_LONG "," ARG_DELETEDIRS_SHORT, bpo::bool_switch(&this->runDeleteDirsPhase),
 			"Delete directories.")
 /*d*/	(ARG_CREATEDIRS_LONG "," ARG_CREATEDIRS_SHORT, bpo::bool_switch(&this->runCreateDirsPhase),
@@ -334,6 +380,12 @@ void ProgArgs::defineAllowedArgs()
 /*fa*/	(ARG_FADVISE_LONG, bpo::value(&this->fadviseFlagsOrigStr),
 			"Provide file access hints via fadvise(). This value is a comma-separated list of the "
 			"following flags: seq, rand, willneed, dontneed, noreuse.")
+/*fi*/	(ARG_FILELAT_LONG, bpo::bool_switch(&this->showFileLatBreakdown),
+			"Show latency breakdown of file write/read phases in dir mode: open, inline stat "
+			"(see \"--" ARG_STATFILESINLINE_LONG "\"), time to first byte, data transfer and "
+			"close. Shows the average of each step in phase results and min/avg/max, percentiles "
+			"and histogram based on the \"--" ARG_LATENCY_LONG "\" options. Helps to tell "
+			"metadata latency apart from data latency for small file workloads.")
 /*fl*/  (ARG_FLOCK_LONG, bpo::value(&this->flockTypeOrigStr),
             "Use POSIX file locks around each file read/write operation. Possible values: "
             "\"range\" to lock the specific range of each IO operation, \"full\" to lock the "
@@ -387,9 +439,27 @@ void ProgArgs::defineAllowedArgs()
             "workload. Terminate this via ctrl+c or by using \"--" ARG_TIMELIMITSECS_LONG "\".")
 /*in*/	(ARG_INTERRUPT_LONG, bpo::bool_switch(&this->interruptServices),
 			"Interrupt current benchmark phase on given service mode hosts.")
+/*io*/	(ARG_IOBATCHMIN_LONG, bpo::value(&this->ioBatchMin),
+			"Minimum number of completed async I/Os to wait for before all free slots get "
+			"refilled and resubmitted with a single call. Larger values reduce the number of "
+			"syscalls per I/O at the cost of a less constantly full queue. Must not be larger "
+			"than \"--" ARG_IODEPTH_LONG "\". The achieved average batch sizes are shown in the "
+			"results. (Default: 1)")
 /*io*/	(ARG_IODEPTH_LONG, bpo::value(&this->ioDepth),
 			"Depth of I/O queue per thread for asynchronous I/O. Setting this to 2 or higher "
 			"turns on async I/O. (Default: 1)")
+/*io*/	(ARG_IOURING_LONG, bpo::bool_switch(&this->useIOUring),
+			"Use io_uring instead of libaio for file/blockdev reads and writes. Buffers and file "
+			"descriptors get registered with the ring to reduce per-I/O overhead. Can be combined "
+			"with \"--" ARG_IODEPTH_LONG "\" to set the number of in-flight I/Os per thread.")
+/*io*/	(ARG_IOURINGIOPOLL_LONG, bpo::bool_switch(&this->useIOUringIOPoll),
+			"Busy-poll for io_uring completions instead of waiting for interrupts "
+			"(IORING_SETUP_IOPOLL). Requires \"--" ARG_IOURING_LONG "\" and "
+			"\"--" ARG_DIRECTIO_LONG "\" and a device/filesystem that supports polled I/O.")
+/*io*/	(ARG_IOURINGSQPOLL_LONG, bpo::bool_switch(&this->useIOUringSQPoll),
+			"Let a kernel thread poll the io_uring submission queue, so that submitting I/Os "
+			"does not require a syscall (IORING_SETUP_SQPOLL). This costs one kernel thread per "
+			"I/O thread. Requires \"--" ARG_IOURING_LONG "\".")
 /*jso*/ (ARG_JSONFILE_LONG, bpo::value(&this->resFilePathJSON),
             "Path to file for end results in json format. If the file exists, results will be "
             "appended. (See also \"--" ARG_JSONLIVEFILE_LONG "\" for progress results in json "
@@ -400,18 +470,53 @@ void ProgArgs::defineAllowedArgs()
 			"Custom label to identify benchmark run in result files.")
 /*la*/	(ARG_LATENCY_LONG, bpo::bool_switch(&this->showLatency),
 			"Show minimum, average and maximum latency for read/write operations and entries. "
-			"In read and write phases, entry latency includes file open, read/write and close.")
+			"In read and write phases, entry latency includes file open, read/write and close. "
+			"Live stats additionally show p50/p99/p99.9 latency of the previous live stats "
+			"interval.")
 /*la*/	(ARG_LATENCYHISTOGRAM_LONG, bpo::bool_switch(&this->showLatencyHistogram),
 			"Show latency histogram.")
+/*la*/	(ARG_LATENCYHISTODIGITS_LONG, bpo::value(&this->latencyHistoDigits),
+			"Number of significant decimal digits for recorded latency values, which defines the "
+			"resolution of latency percentiles and histograms. 2 means that latencies are "
+			"recorded with less than 1% error. Each additional digit increases memory usage per "
+			"thread by roughly 8x. (Default: 2; Range: " STRINGIZE(HDRHISTO_MIN_SIGNIFICANT_DIGITS) "-"
+			STRINGIZE(HDRHISTO_MAX_SIGNIFICANT_DIGITS) ")")
 /*la*/	(ARG_LATENCYPERCENTILES_LONG, bpo::bool_switch(&this->showLatencyPercentiles),
 			"Show latency percentiles.")
 /*la*/	(ARG_LATENCYPERCENT9S_LONG, bpo::value(&this->numLatencyPercentile9s),
 			"Number of decimal nines to show in latency percentiles. 0 for 99%, 1 for 99.9%, 2 for "
 			"99.99% and so on. (Default: 0)")
 /*li*/	(ARG_LIMITREAD_LONG, bpo::value(&this->limitReadBpsOrigStr),
-			"Per-thread read limit in bytes per second.")
+			"Read limit in bytes per second. Applies per thread, per host or to all hosts "
+			"together depending on \"--" ARG_LIMITSCOPE_LONG "\".")
+/*li*/	(ARG_LIMITREADIOPS_LONG, bpo::value(&this->limitReadIOPS),
+			"Read limit in IOs per second. Applies like \"--" ARG_LIMITREAD_LONG "\". "
+			"Can be combined with "
+			"\"--" ARG_LIMITREAD_LONG "\", in which case the lower of both limits applies.")
+/*li*/	(ARG_LIMITREFILL_LONG, bpo::value(&this->limitRefillUSec),
+			"Interval in microseconds in which the rate limiter allows the next share of the "
+			"read/write limits. Shorter intervals result in smoother traffic. "
+			"(Default: " STRINGIZE(RATELIMITER_DEFAULT_REFILL_USEC) ")")
+/*li*/	(ARG_LIMITSCOPE_LONG, bpo::value(&this->limitScopeOrigStr),
+			"Scope of the read/write limits. "
+			"\"" ARG_LIMITSCOPE_THREAD_NAME "\": separate limit for each worker thread. "
+			"\"" ARG_LIMITSCOPE_HOST_NAME "\": limit is shared by all worker threads of the same "
+			"host, so that fast threads can use the budget that slow threads leave. "
+			"\"" ARG_LIMITSCOPE_GLOBAL_NAME "\": limit is shared by all worker threads on all of "
+			"the given service hosts. The master splits it among the hosts and rebalances the "
+			"shares based on live throughput, so that hosts with slower paths leave their unused "
+			"share to the others. (Default: " ARG_LIMITSCOPE_THREAD_NAME ")")
+/*li*/	(ARG_LIMITSPIN_LONG, bpo::bool_switch(&this->useLimitSpin),
+			"Busy-wait instead of sleep for the last " STRINGIZE(RATELIMITER_SPIN_USEC) " "
+			"microseconds of rate limiter waits. This enables precise pacing with short "
+			"\"--" ARG_LIMITREFILL_LONG "\" intervals at the cost of CPU time.")
 /*li*/	(ARG_LIMITWRITE_LONG, bpo::value(&this->limitWriteBpsOrigStr),
-			"Per-thread write limit in bytes per second. (In combination with "
+			"Write limit in bytes per second. Applies like \"--" ARG_LIMITREAD_LONG "\". "
+			"(In combination with "
+			"\"--" ARG_RWMIXPERCENT_LONG "\" this defines the limit for read+write.)")
+/*li*/	(ARG_LIMITWRITEIOPS_LONG, bpo::value(&this->limitWriteIOPS),
+			"Write limit in IOs per second. Applies like \"--" ARG_LIMITREAD_LONG "\". "
+			"(In combination with "
 			"\"--" ARG_RWMIXPERCENT_LONG "\" this defines the limit for read+write.)")
 /*liv*/	(ARG_BRIEFLIVESTATS_LONG, bpo::bool_switch(&this->useBriefLiveStats),
 			"Use brief live statistics format, i.e. a single line instead of full screen stats. "
@@ -432,6 +537,17 @@ void ProgArgs::defineAllowedArgs()
 /*liv*/	(ARG_LIVEINTERVAL_LONG, bpo::value(&this->liveStatsSleepMS),
 			"Update interval for console and csv file live statistics in milliseconds. "
 			"(Default: 2000)")
+/*liv*/	(ARG_LIVEBINFILE_LONG, bpo::value(&this->liveBinFilePath),
+			"Path to binary time-series file for live progress results. Contains the aggregate "
+			"and per-worker throughput, IOPS and latency of each live stats interval as "
+			"fixed-size records, so it is much cheaper than \"--" ARG_CSVLIVEEXTENDED_LONG "\" "
+			"for short intervals (e.g. \"--" ARG_LIVEINTERVAL_LONG "=100\") and many workers. "
+			"Latency percentiles are included with \"--" ARG_LATENCY_LONG "\". If "
+			"the file exists, results will be appended. Use \"--" ARG_LIVEBINTOJSON_LONG "\" "
+			"to convert the file to JSON.")
+/*liv*/	(ARG_LIVEBINTOJSON_LONG, bpo::value(&this->liveBinToJSONPath),
+			"Convert the given binary time-series file of \"--" ARG_LIVEBINFILE_LONG "\" to "
+			"JSON lines on stdout (i.e. one JSON object per line) and exit.")
 //  live json not implemented yet:
 // /*liv*/	(ARG_JSONLIVEFILE_LONG, bpo::value(&this->liveJSONFilePath),
 //             "Path to file for live progress results in json format. If the file exists, results "
@@ -504,14 +620,54 @@ void ProgArgs::defineAllowedArgs()
 /*nu*/	(ARG_NUMHOSTS_LONG, bpo::value(&this->numHosts),
 			"Number of hosts to use from given hosts list or hosts file. (Default: use all given "
 			"hosts)")
+/*op*/	(ARG_OPENLOOP_LONG, bpo::value(&this->openLoopOpsPerSec),
+			"Open-loop load generation: Each worker thread issues the given number of operations "
+			"per second according to a fixed schedule, independent of how long previous operations "
+			"took. (Operations are IOs in file/bdev mode and entries in dir mode.) Latency is "
+			"additionally reported as response time measured from the intended issue time, so that "
+			"the waiting time of operations which got delayed by slow predecessors is included "
+			"(coordinated omission correction). Requires \"--" ARG_LATENCY_LONG "\" to see the "
+			"response time. (Default: 0 for closed loop)")
+/*op*/	(ARG_OPENLOOPDIST_LONG, bpo::value(&this->openLoopDistOrigStr),
+			"Arrival distribution of operations for \"--" ARG_OPENLOOP_LONG "\". "
+			"Possible values: "
+			"\"" ARG_OPENLOOPDIST_FIXED_NAME "\": same interval between all operations, "
+			"\"" ARG_OPENLOOPDIST_POISSON_NAME "\": exponentially distributed intervals with the "
+			"same mean (Poisson arrivals). (Default: " ARG_OPENLOOPDIST_FIXED_NAME ")")
 /*op*/	(ARG_OPSLOGPATH_LONG, bpo::value(&this->opsLogPath),
 			"Absolute path to logfile for all I/O operations (open, read, ...). In service mode, "
 			"the service instances will log their operations locally to the given path. Log is in "
 			"JSON format. (Default: disabled)")
+/*op*/	(ARG_OPSLOGBINARY_LONG, bpo::bool_switch(&this->useOpsLogBinary),
+			"Write \"--" ARG_OPSLOGPATH_LONG "\" in compact binary format instead of JSON. Ops "
+			"get recorded to per-thread in-memory buffers, which a background thread flushes "
+			"to the log file, so the overhead is much lower than for the JSON format. Also "
+			"includes latency and errno of ops. Use \"--" ARG_OPSLOGTOJSON_LONG "\" to convert "
+			"the file to JSON.")
 /*op*/	(ARG_OPSLOGLOCKING_LONG, bpo::bool_switch(&this->useOpsLogLocking),
 			"Use file locking to synchronize appends to \"--" ARG_OPSLOGPATH_LONG "\".")
+/*op*/	(ARG_OPSLOGSAMPLE_LONG, bpo::value(&this->opsLogSampleN),
+			"Log only 1 in N ops to the binary ops log. Selection is deterministic based on op "
+			"type, entry name and offset, so that start and end of an op are either both logged "
+			"or both skipped. Requires \"--" ARG_OPSLOGBINARY_LONG "\". (Default: 1)")
+/*op*/	(ARG_OPSLOGTOJSON_LONG, bpo::value(&this->opsLogToJSONPath),
+			"Convert the given binary ops log file of \"--" ARG_OPSLOGBINARY_LONG "\" to the "
+			"JSON lines format of \"--" ARG_OPSLOGPATH_LONG "\" on stdout and exit.")
 /*ph*/	(ARG_PHASEDELAYTIME_LONG, bpo::value(&this->nextPhaseDelaySecs),
 			"Delay between different benchmark phases in seconds. (Default: 0)")
+/*pr*/	(ARG_PRECONDFILLS_LONG, bpo::value(&this->precondNumFills),
+			"Precondition block devices or large files before the benchmark phases by writing the "
+			"full dataset sequentially the given number of times. Write settings like block size "
+			"and IO depth are the same as for the benchmark phases. (Default: 0)")
+/*pr*/	(ARG_PRECONDSOAKSECS_LONG, bpo::value(&this->precondSoakSecs),
+			"Random write soak after the sequential preconditioning passes. The soak ends when "
+			"IOPS and average latency reached steady state or latest after the given number of "
+			"seconds. Steady state is reached when the values of the rounds in the measurement "
+			"window (see \"--" ARG_STEADYSTATEROUND_LONG "\" and "
+			"\"--" ARG_STEADYSTATEWINDOW_LONG "\") differ by less than "
+			STRINGIZE(STEADYSTATE_MAX_EXCURSION_PCT) "% of their average and their linear trend "
+			"changes by less than " STRINGIZE(STEADYSTATE_MAX_SLOPE_PCT) "% across the window, as "
+			"in the SNIA Performance Test Specification. (Default: 0 for no soak)")
 /*po*/	(ARG_SERVICEPORT_LONG, bpo::value(&this->servicePort),
 			"TCP port of background service. (Default: " ARGDEFAULT_SERVICEPORT_STR ")")
 /*qr*/	(ARG_PREALLOCFILE_LONG, bpo::bool_switch(&this->doPreallocFile),
@@ -540,6 +696,20 @@ void ProgArgs::defineAllowedArgs()
 /*re*/	(ARG_RECVBUFSIZE_LONG, bpo::value(&this->sockRecvBufSizeOrigStr),
 			"In netbench mode, this sets the receive buffer size of sockets in bytes. "
 			"(Supports base2 suffixes, e.g. \"2M\")")
+/*re*/	(ARG_REPLAY_LONG, bpo::value(&this->replayFilePath),
+			"Replay the ops of the given ops log file (JSON or binary format of "
+			"\"--" ARG_OPSLOGPATH_LONG "\") as a separate benchmark phase. Recorded reads, writes, "
+			"opens, closes, mkdirs, unlinks and stats (or S3 object gets, puts, heads and deletes) "
+			"get reissued on the recorded paths. Ops are distributed across threads and hosts by "
+			"path, so ops on the same file keep their recorded order. Files are only opened for "
+			"writing if the log contains writes to them and only get created if the recorded open "
+			"was used for writes, so missing files of read ops are reported as errors.")
+/*re*/	(ARG_REPLAYROOT_LONG, bpo::value(&this->replayRoot),
+			"Path prefix of the recorded paths in \"--" ARG_REPLAY_LONG "\" to be replaced by the "
+			"first given benchmark path, e.g. to replay on a different mountpoint or bucket.")
+/*re*/	(ARG_REPLAYSPEED_LONG, bpo::value(&this->replaySpeed),
+			"Time scale for \"--" ARG_REPLAY_LONG "\": 1 keeps the recorded timing of ops, 2 "
+			"issues ops twice as fast, 0 issues ops as fast as possible. (Default: 1)")
 /*re*/	(ARG_RESPSIZE_LONG, bpo::value(&this->netBenchRespSizeOrigStr),
 			"Netbench mode server response size in bytes. Servers will send this amount of data as "
 			"response to each received block from a client. (Default: 1; "
@@ -766,6 +936,49 @@ void ProgArgs::defineAllowedArgs()
 			"exclusively assigned to a thread. This means multiple threads read/write different "
 			"parts of files that exceed the given size. "
 			"(Default: 0, which means " FILESHAREBLOCKFACTOR_STR " x blocksize)")
+/*sl*/	(ARG_SLOLAT_LONG, bpo::value(&this->sloLatUSec),
+			"Latency SLO capacity search: Find the highest IOPS at which the latency percentile "
+			"given by \"--" ARG_SLOPERCENTILE_LONG "\" stays below this number of microseconds. "
+			"This runs the selected read or write phase repeatedly with different settings as "
+			"defined by \"--" ARG_SLOSEARCH_LONG "\" and reports the resulting "
+			"throughput-vs-latency curve. Use \"--" ARG_TIMELIMITSECS_LONG "\" to define the "
+			"duration of each search step. (Default: 0 for disabled)")
+/*sl*/	(ARG_SLOPERCENTILE_LONG, bpo::value(&this->sloPercentile),
+			"Latency percentile for \"--" ARG_SLOLAT_LONG "\". (Default: 99)")
+/*sl*/	(ARG_SLOSEARCH_LONG, bpo::value(&this->sloSearchTypeOrigStr),
+			"What to vary in the search steps of \"--" ARG_SLOLAT_LONG "\". Possible values: "
+			"\"" ARG_SLOSEARCH_RATE_NAME "\": total IOPS limit of all threads (and all hosts in "
+			"distributed mode) by binary search between 0 and the unlimited IOPS. "
+			"\"" ARG_SLOSEARCH_IODEPTH_NAME "\": IO depth per thread by binary search between 1 and "
+			"the given \"--" ARG_IODEPTH_LONG "\". (Default: " ARG_SLOSEARCH_RATE_NAME ")")
+/*sl*/	(ARG_SLOSTEPS_LONG, bpo::value(&this->sloSearchMaxSteps),
+			"Max number of search steps (i.e. benchmark phases) for \"--" ARG_SLOLAT_LONG "\". "
+			"The search stops earlier when the IOPS limit is narrowed down to "
+			STRINGIZE(SLOSEARCH_RESOLUTION_PCT) "% or the IO depth is found. (Default: 8)")
+/*sl*/	(ARG_SLOWOPS_LONG, bpo::value(&this->numSlowOps),
+			"Show the given number of slowest I/O and entry operations in phase results, "
+			"including path, offset, length, start time in phase, worker rank and service host. "
+			"Helps to find out which files or hosts cause latency outliers. Each thread keeps "
+			"its slowest ops with very low overhead. (Default: 0 for disabled)")
+/*st*/	(ARG_STABILITY_LONG, bpo::bool_switch(&this->showThroughputStability),
+			"Show throughput stability metrics in phase results, based on the throughput of the "
+			"live stats intervals (see \"--" ARG_LIVEINTERVAL_LONG "\") while all workers are "
+			"running: min, max and percentiles of throughput per second, coefficient of "
+			"variation (i.e. standard deviation in percent of the mean) and the longest time "
+			"window below \"--" ARG_STABILITYDIP_LONG "\" percent of the mean. Also shows the "
+			"fairness of workers (i.e. threads or hosts in distributed mode) as Jain's index of "
+			"the amount of work that each worker completed until the first worker finished. "
+			"1 means perfectly fair, 1/N means that a single worker got everything. Intervals "
+			"that start before the end of \"--" ARG_WARMUPSECS_LONG "\" are not included.")
+/*st*/	(ARG_STABILITYDIP_LONG, bpo::value(&this->stabilityDipPercent),
+			"Throughput below this percentage of the mean counts as dip for the longest dip "
+			"window of \"--" ARG_STABILITY_LONG "\". (Default: 90)")
+/*ss*/	(ARG_STEADYSTATEROUND_LONG, bpo::value(&this->steadyStateRoundSecs),
+			"Duration of a steady state detection round in seconds for "
+			"\"--" ARG_PRECONDSOAKSECS_LONG "\". (Default: 60)")
+/*ss*/	(ARG_STEADYSTATEWINDOW_LONG, bpo::value(&this->steadyStateWindowRounds),
+			"Number of rounds in the steady state measurement window for "
+			"\"--" ARG_PRECONDSOAKSECS_LONG "\". (Default: 5)")
 /*st*/	(ARG_STATFILES_LONG, bpo::bool_switch(&this->runStatFilesPhase),
 			"Run file stat benchmark phase.")
 /*re*/	(ARG_STATFILESINLINE_LONG, bpo::bool_switch(&this->doStatInline),
@@ -789,6 +1002,33 @@ void ProgArgs::defineAllowedArgs()
 			"Update retrieval interval for service hosts in milliseconds. (Default: 500)")
 /*sv*/	(ARG_SVCREADYWAITSECS_LONG, bpo::value(&this->svcReadyWaitSec),
 			"Wait time (in seconds) for service instances to become ready. (Default: 5)")
+/*sw*/	(ARG_SWEEPBLOCK_LONG, bpo::value(&this->sweepBlockSizesStr),
+			"Parameter sweep: Comma-separated list of block sizes. All combinations of the given "
+			"sweep lists run in a single invocation, reusing the service instances. The selected "
+			"phases run for each combination. A list element \"min:max\" expands to all doubling "
+			"steps from min to max, e.g. \"4K:1M\". If the phase time limit "
+			"(\"--" ARG_TIMELIMITSECS_LONG "\") expires, the remaining phases of the current "
+			"combination are skipped and the sweep continues with the next combination. The sweep "
+			"summary also gets printed if the sweep ends early due to an error or interruption. "
+			"(Default: only the value of \"--" ARG_BLOCK_LONG "\")")
+/*sw*/	(ARG_SWEEPIODEPTH_LONG, bpo::value(&this->sweepIODepthsStr),
+			"Parameter sweep: Comma-separated list of IO depths, e.g. \"1:64\". See "
+			"\"--" ARG_SWEEPBLOCK_LONG "\". (Default: only the value of "
+			"\"--" ARG_IODEPTH_LONG "\")")
+/*sw*/	(ARG_SWEEPPLATEAU_LONG, bpo::value(&this->sweepPlateauPercent),
+			"Stop a parameter sweep early when throughput plateaus: If a higher IO depth does not "
+			"increase throughput by at least the given percentage, the remaining IO depths are "
+			"skipped for the current thread count. If a higher thread count does not increase the "
+			"best throughput by at least this percentage, the remaining thread counts are skipped "
+			"for the current block and file size. (Default: 0 for disabled)")
+/*sw*/	(ARG_SWEEPSIZE_LONG, bpo::value(&this->sweepFileSizesStr),
+			"Parameter sweep: Comma-separated list of file sizes. See "
+			"\"--" ARG_SWEEPBLOCK_LONG "\". (Default: only the value of "
+			"\"--" ARG_FILESIZE_LONG "\")")
+/*sw*/	(ARG_SWEEPTHREADS_LONG, bpo::value(&this->sweepNumThreadsStr),
+			"Parameter sweep: Comma-separated list of thread counts, e.g. \"1:64\". See "
+			"\"--" ARG_SWEEPBLOCK_LONG "\". (Default: only the value of "
+			"\"--" ARG_NUMTHREADS_LONG "\")")
 /*sy*/	(ARG_SYNCPHASE_LONG, bpo::bool_switch(&this->runSyncPhase),
 			"Sync Linux kernel page cache to stable storage before/after each phase.")
 /*t*/	(ARG_NUMTHREADS_LONG "," ARG_NUMTHREADS_SHORT, bpo::value(&this->numThreads),
@@ -796,6 +1036,15 @@ void ProgArgs::defineAllowedArgs()
 /*ti*/	(ARG_TIMELIMITSECS_LONG, bpo::value(&this->timeLimitSecs),
 			"Time limit in seconds for each benchmark phase. If the limit is exceeded for a phase "
 			"then no further phases will run. (Default: 0 for disabled)")
+/*tr*/	(ARG_TRACEFILE_LONG, bpo::value(&this->traceFilePath),
+			"Path to file for a timeline of all I/O operations (open, read, ...) and phases of "
+			"each worker thread in Chrome trace event format, which can be loaded into Perfetto UI "
+			"or chrome://tracing. Events get buffered in memory and appended to the file at the "
+			"end of each phase. In service mode, the service instances will write their trace "
+			"locally to the given path. (Default: disabled)")
+/*tr*/	(ARG_TRACESAMPLE_LONG, bpo::value(&this->traceSampleN),
+			"Trace only 1 in N ops to \"--" ARG_TRACEFILE_LONG "\". Useful for long phases, as "
+			"the number of buffered events per thread and phase is limited. (Default: 1)")
 /*tr*/	(ARG_TREEFILE_LONG, bpo::value(&this->treeFilePath),
 			"The path to a treefile containing a list of dirs and filenames to use. This is called "
 			"\"custom tree mode\" and enables testing with mixed file sizes. The general benchmark "
@@ -845,6 +1094,13 @@ void ProgArgs::defineAllowedArgs()
 /*w*/	(ARG_CREATEFILES_LONG "," ARG_CREATEFILES_SHORT,
 			bpo::bool_switch(&this->runCreateFilesPhase),
 			"Write files. Create them if they don't exist.")
+/*wa*/	(ARG_WARMUPSECS_LONG, bpo::value(&this->warmupSecs),
+			"Warmup period in seconds at the start of each phase. Workers start I/O immediately, "
+			"but their counters, latency histograms and the CPU utilization baseline get reset "
+			"when the warmup period ends, so that the phase results only cover the time after "
+			"warmup. This excludes effects like cache warmup, first-open costs and TCP slow start. "
+			"Phases that end during warmup include all operations. The warmup period is part of "
+			"\"--" ARG_TIMELIMITSECS_LONG "\". (Default: 0 for disabled)")
 #ifdef LIBNUMA_SUPPORT
 /*zo*/	(ARG_NUMAZONES_LONG, bpo::value(&this->numaZonesStr),
 			"Comma-separated list of NUMA zones to bind this process to. If multiple zones are "
@@ -871,6 +1127,15 @@ void ProgArgs::defineDefaults()
     this->blockSizeOrigStr = "1M";
     this->blockVarianceAlgo = RANDALGO_FAST_STR;
     this->blockVariancePercent = 100;
+    this->blockVarPoolSize = 0;
+    this->compressRatio = 0;
+    this->dedupeChunkSize = 4*1024;
+    this->dedupeChunkSizeOrigStr = "4K";
+    this->dedupeNumRanks = 1;
+    this->dedupePercent = 0;
+    this->dedupeRankOffset = 0;
+    this->dedupeScope = ARG_DEDUPESCOPE_THREAD;
+    this->dedupeSeed = 0;
     this->disableLiveStats = false;
     this->disablePathBracketsExpansion = false;
     this->doDirectVerify = false;
@@ -905,12 +1170,18 @@ void ProgArgs::defineDefaults()
     this->ignoreS3PartNum = false;
     this->integrityCheckSalt = 0;
     this->interruptServices = false;
+    this->ioBatchMin = 1;
     this->ioDepth = 1;
     this->iterations = 1;
+    this->latencyHistoDigits = 2;
     this->limitReadBps = 0;
     this->limitReadBpsOrigStr = "0";
     this->limitWriteBps = 0;
     this->limitWriteBpsOrigStr = "0";
+    this->limitReadIOPS = 0;
+    this->limitWriteIOPS = 0;
+    this->limitRefillUSec = RATELIMITER_DEFAULT_REFILL_USEC;
+    this->limitScope = ARG_LIMITSCOPE_THREAD;
     this->liveStatsSleepMS = 2000;
     this->logLevel = Log_NORMAL;
     this->madviseFlags = 0;
@@ -929,7 +1200,13 @@ void ProgArgs::defineDefaults()
     this->numLatencyPercentile9s = 0;
     this->numNetBenchServers = 0;
     this->numRWMixReadThreads = 0;
+    this->numSlowOps = 0;
     this->numThreads = 1;
+    this->openLoopOpsPerSec = 0;
+    this->openLoopDist = ARG_OPENLOOPDIST_FIXED;
+    this->opsLogSampleN = 1;
+    this->precondNumFills = 0;
+    this->precondSoakSecs = 0;
     this->quitServices = false;
     this->randOffsetAlgo = ""; /* empty means full coverage for
         writes, balanced_single for reads, but we currently don't want to use full coverage algo */
@@ -937,6 +1214,7 @@ void ProgArgs::defineDefaults()
     this->randomAmount = 0;
     this->randomAmountOrigStr = "0";
     this->rankOffset = 0;
+    this->replaySpeed = 1;
     this->runCreateDirsPhase = false;
     this->runCreateFilesPhase = false;
     this->runDeleteDirsPhase = false;
@@ -980,11 +1258,20 @@ void ProgArgs::defineDefaults()
     this->showAllElapsed = false;
     this->showCPUUtilization = false;
     this->showDirStats = false;
+    this->showFileLatBreakdown = false;
     this->showLatency = false;
     this->showLatencyHistogram = false;
     this->showLatencyPercentiles = false;
     this->showServicesElapsed = false;
     this->showThroughputBase10 = false;
+    this->showThroughputStability = false;
+    this->sloLatUSec = 0;
+    this->sloPercentile = 99;
+    this->sloSearchType = ARG_SLOSEARCH_RATE;
+    this->sloSearchMaxSteps = 8;
+    this->stabilityDipPercent = 90;
+    this->steadyStateRoundSecs = 60;
+    this->steadyStateWindowRounds = 5;
     this->sockRecvBufSize = 0;
     this->sockRecvBufSizeOrigStr = "0";
     this->sockSendBufSize = 0;
@@ -992,7 +1279,9 @@ void ProgArgs::defineDefaults()
     this->svcReadyWaitSec = 5;
     this->svcShowPing = false;
     this->svcUpdateIntervalMS = 500;
+    this->sweepPlateauPercent = 0;
     this->timeLimitSecs = 0;
+    this->traceSampleN = 1;
     this->useAlternativeHTTPService = false;
     this->useRWMixPercent = false;
     this->useBriefLiveStats = false;
@@ -1007,9 +1296,14 @@ void ProgArgs::defineDefaults()
     this->useExtendedLiveJSON = false;
     this->useGDSBufReg = false;
     this->useHDFS = false;
+    this->useIOUring = false;
+    this->useIOUringIOPoll = false;
+    this->useIOUringSQPoll = false;
+    this->useLimitSpin = false;
     this->useMmap = false;
     this->useNetBench = false;
     this->useNoFDSharing = false;
+    this->useOpsLogBinary = false;
     this->useOpsLogLocking = false;
     this->useRandomOffsets = false;
     this->useRandomUnaligned = false;
@@ -1022,6 +1316,7 @@ void ProgArgs::defineDefaults()
     this->useS3SSE = false;
     this->useS3VirtualAddressing = false;
     this->useStridedAccess = false;
+    this->warmupSecs = 0;
     this->treeRoundUpSize = 0;
     this->treeRoundUpSizeOrigStr = "0";
 }
@@ -1330,6 +1625,7 @@ void ProgArgs::convertUnitStrings()
 	treeRoundUpSize = UnitTk::numHumanToBytesBinary(treeRoundUpSizeOrigStr, false);
 	limitReadBps = UnitTk::numHumanToBytesBinary(limitReadBpsOrigStr, false);
 	limitWriteBps = UnitTk::numHumanToBytesBinary(limitWriteBpsOrigStr, false);
+	dedupeChunkSize = UnitTk::numHumanToBytesBinary(dedupeChunkSizeOrigStr, false);
 	netBenchRespSize = UnitTk::numHumanToBytesBinary(netBenchRespSizeOrigStr, false);
     s3MpuSizeVariance = UnitTk::numHumanToBytesBinary(s3MpuSizeVarianceOrigStr, false);
     s3MpuSplitSize = UnitTk::numHumanToBytesBinary(s3MpuSplitSizeOrigStr, false);
@@ -1339,6 +1635,10 @@ void ProgArgs::convertUnitStrings()
 	fadviseFlags = TranslatorTk::fadviseArgsStrToFlags(fadviseFlagsOrigStr);
 	madviseFlags = TranslatorTk::madviseArgsStrToFlags(madviseFlagsOrigStr);
     flockType = TranslatorTk::flockArgsStrToType(flockTypeOrigStr);
+    dedupeScope = TranslatorTk::dedupeScopeArgsStrToType(dedupeScopeOrigStr);
+    openLoopDist = TranslatorTk::openLoopDistArgsStrToType(openLoopDistOrigStr);
+    limitScope = TranslatorTk::limitScopeArgsStrToType(limitScopeOrigStr);
+    sloSearchType = TranslatorTk::sloSearchArgsStrToType(sloSearchTypeOrigStr);
 }
 
 /**
@@ -1399,6 +1699,8 @@ void ProgArgs::checkArgs()
 
 	parseAndCheckPaths();
 
+	parseSweepLists();
+
 	if(!numThreads)
 		throw ProgException("Number of threads may not be zero.");
 
@@ -1408,6 +1710,9 @@ void ProgArgs::checkArgs()
 	numDataSetThreads = (!hostsVec.empty() && getIsServicePathShared() ) ?
 		(numThreads * hostsVec.size() ) : numThreads;
 
+	// (services get their own dedupe rank offset, also for non-shared paths)
+	dedupeNumRanks = numThreads * (hostsVec.empty() ? 1 : hostsVec.size() );
+
 	if(!fileShareSize)
 		fileShareSize = FILESHAREBLOCKFACTOR * blockSize;
 
@@ -1429,6 +1734,8 @@ void ProgArgs::checkArgs()
 
 	loadCustomTreeFile();
 
+	loadReplayFile();
+
     precreateS3MpuSharingUploadIDs(); // requires customTree to be initialized
 
 	if(useCuFile && (ioDepth > 1) )
@@ -1489,6 +1796,28 @@ void ProgArgs::checkArgs()
 	if(!gpuIDsStr.empty() && useMmap)
 		throw ProgException("Memory mapped IO (mmap) cannot be used with GPUs.");
 
+	if(!ioBatchMin || (ioBatchMin > ioDepth) )
+		throw ProgException("Option \"--" ARG_IOBATCHMIN_LONG "\" must be in the range from 1 to "
+			"the value of \"--" ARG_IODEPTH_LONG "\". "
+			"Given value: " + std::to_string(ioBatchMin) + "; "
+			"IO depth: " + std::to_string(ioDepth) );
+
+	if( (useIOUringSQPoll || useIOUringIOPoll) && !useIOUring)
+		throw ProgException("Options \"--" ARG_IOURINGSQPOLL_LONG "\" and "
+			"\"--" ARG_IOURINGIOPOLL_LONG "\" require \"--" ARG_IOURING_LONG "\".");
+
+	if(useIOUringIOPoll && !useDirectIO)
+		throw ProgException("Option \"--" ARG_IOURINGIOPOLL_LONG "\" requires "
+			"\"--" ARG_DIRECTIO_LONG "\".");
+
+	if(useIOUring && (benchMode != BenchMode_POSIX) )
+		throw ProgException("Option \"--" ARG_IOURING_LONG "\" can only be used for "
+			"file and block device I/O.");
+
+	if(useIOUring && (useMmap || useCuFile) )
+		throw ProgException("Option \"--" ARG_IOURING_LONG "\" cannot be used together with "
+			"mmap or cuFile API.");
+
 	if(useRandomOffsets && (benchMode == BenchMode_S3) && runCreateFilesPhase)
 		LOGGER(Log_NORMAL, "NOTE: S3 write/upload cannot be used with random offsets. "
 			"Falling back to \"--" ARG_REVERSESEQOFFSETS_LONG "\"." << std::endl);
@@ -1525,9 +1854,95 @@ void ProgArgs::checkArgs()
         throw ProgException("Option \"--" ARG_RWMIXPERCENT_LONG "\" cannot be used together with "
             "\"--" ARG_RWMIXTHREADS_LONG "\"");
 
-    if(rwMixThreadsReadPercent && (limitReadBps || limitWriteBps) )
+    const bool haveRWLimit = limitReadBps || limitWriteBps || limitReadIOPS || limitWriteIOPS;
+
+    if(rwMixThreadsReadPercent && haveRWLimit)
         throw ProgException("Option \"--" ARG_RWMIXTHREADSPCT_LONG "\" cannot be used together with "
-            "\"--" ARG_LIMITREAD_LONG "\" or \"--" ARG_LIMITWRITE_LONG "\"");
+            "\"--" ARG_LIMITREAD_LONG "\", \"--" ARG_LIMITWRITE_LONG "\", "
+            "\"--" ARG_LIMITREADIOPS_LONG "\" or \"--" ARG_LIMITWRITEIOPS_LONG "\"");
+
+    if(!limitRefillUSec)
+        throw ProgException("Option \"--" ARG_LIMITREFILL_LONG "\" must not be 0.");
+
+    if( (limitScope == ARG_LIMITSCOPE_GLOBAL) && hostsVec.empty() )
+        throw ProgException("Rate limit scope \"" ARG_LIMITSCOPE_GLOBAL_NAME "\" requires "
+            "service hosts. Use \"" ARG_LIMITSCOPE_HOST_NAME "\" for local runs.");
+
+    if( (limitScope == ARG_LIMITSCOPE_GLOBAL) &&
+        ( (limitReadBps && (limitReadBps < hostsVec.size() ) ) ||
+        (limitWriteBps && (limitWriteBps < hostsVec.size() ) ) ||
+        (limitReadIOPS && (limitReadIOPS < hostsVec.size() ) ) ||
+        (limitWriteIOPS && (limitWriteIOPS < hostsVec.size() ) ) ) )
+        throw ProgException("Global rate limits must not be lower than the number of hosts.");
+
+    if(openLoopOpsPerSec && (haveRWLimit || rwMixThreadsReadPercent) )
+        throw ProgException("Option \"--" ARG_OPENLOOP_LONG "\" cannot be used together with "
+            "read/write limits or \"--" ARG_RWMIXTHREADSPCT_LONG "\"");
+
+    if(openLoopOpsPerSec && (benchMode != BenchMode_POSIX) )
+        throw ProgException("Option \"--" ARG_OPENLOOP_LONG "\" is only supported for file "
+            "system and block device paths.");
+
+    if(openLoopOpsPerSec && !treeFilePath.empty() )
+        throw ProgException("Option \"--" ARG_OPENLOOP_LONG "\" cannot be used together with "
+            "\"--" ARG_TREEFILE_LONG "\"");
+
+    if(sloLatUSec)
+    {
+        if(runReadPhase == runCreateFilesPhase)
+            throw ProgException("Option \"--" ARG_SLOLAT_LONG "\" requires either a read or a "
+                "write phase.");
+
+        if(runCreateDirsPhase || runStatFilesPhase || runDeleteFilesPhase || runDeleteDirsPhase)
+            throw ProgException("Option \"--" ARG_SLOLAT_LONG "\" cannot be used together with "
+                "phases other than read or write.");
+
+        if(iterations > 1)
+            throw ProgException("Option \"--" ARG_SLOLAT_LONG "\" cannot be used together with "
+                "\"--" ARG_ITERATIONS_LONG "\"");
+
+        if(openLoopOpsPerSec)
+            throw ProgException("Option \"--" ARG_SLOLAT_LONG "\" cannot be used together with "
+                "\"--" ARG_OPENLOOP_LONG "\"");
+
+        if( (sloSearchType == ARG_SLOSEARCH_RATE) && (haveRWLimit || rwMixThreadsReadPercent) )
+            throw ProgException("Latency SLO search type \"" ARG_SLOSEARCH_RATE_NAME "\" cannot "
+                "be used together with read/write limits or \"--" ARG_RWMIXTHREADSPCT_LONG "\"");
+
+        if( (sloSearchType == ARG_SLOSEARCH_IODEPTH) && (ioDepth < 2) )
+            throw ProgException("Latency SLO search type \"" ARG_SLOSEARCH_IODEPTH_NAME "\" "
+                "requires \"--" ARG_IODEPTH_LONG "\" to be larger than 1 as upper search limit.");
+
+        if( (sloSearchType == ARG_SLOSEARCH_IODEPTH) && (ioBatchMin > 1) )
+            throw ProgException("Latency SLO search type \"" ARG_SLOSEARCH_IODEPTH_NAME "\" "
+                "cannot be used together with \"--" ARG_IOBATCHMIN_LONG "\"");
+
+        if( (sloPercentile <= 0) || (sloPercentile > 100) )
+            throw ProgException("Option \"--" ARG_SLOPERCENTILE_LONG "\" must be larger than 0 "
+                "and not larger than 100.");
+
+        if(!sloSearchMaxSteps)
+            throw ProgException("Option \"--" ARG_SLOSTEPS_LONG "\" must not be 0.");
+    }
+
+    if(getIsSweep() )
+    {
+        if( (benchMode != BenchMode_POSIX) || useNetBench)
+            throw ProgException("Parameter sweeps are only supported for file system and block "
+                "device paths.");
+
+        if(!treeFilePath.empty() )
+            throw ProgException("Parameter sweeps cannot be used together with "
+                "\"--" ARG_TREEFILE_LONG "\"");
+
+        if(sloLatUSec)
+            throw ProgException("Parameter sweeps cannot be used together with "
+                "\"--" ARG_SLOLAT_LONG "\"");
+
+        if(ioBatchMin > *std::min_element(sweepIODepthsVec.begin(), sweepIODepthsVec.end() ) )
+            throw ProgException("Option \"--" ARG_IOBATCHMIN_LONG "\" must not be larger than "
+                "the smallest IO depth of \"--" ARG_SWEEPIODEPTH_LONG "\".");
+    }
 
     if(rwMixReadPercent && !gpuIDsVec.empty() && !useCuFile)
         throw ProgException("Option \"--" ARG_RWMIXPERCENT_LONG "\" cannot be used together with "
@@ -1541,6 +1956,73 @@ void ProgArgs::checkArgs()
         throw ProgException("Option \"--" ARG_INTEGRITYCHECK_LONG "\" requires "
             "\"--" ARG_BLOCKVARIANCE_LONG " 0\"");
 
+    if( (compressRatio != 0) && (compressRatio < 1) )
+        throw ProgException("Option \"--" ARG_COMPRESSRATIO_LONG "\" must not be smaller than 1. "
+            "Given value: " + std::to_string(compressRatio) );
+
+    if( (compressRatio != 0) && runCreateFilesPhase)
+    {
+        if(blockVariancePercent != 100)
+            throw ProgException("Option \"--" ARG_COMPRESSRATIO_LONG "\" requires "
+                "\"--" ARG_BLOCKVARIANCE_LONG " 100\". (Note that block variance is disabled by "
+                "integrity check and netbench mode.)");
+
+        if(!gpuIDsVec.empty() )
+            throw ProgException("Option \"--" ARG_COMPRESSRATIO_LONG "\" cannot be used together "
+                "with GPUs.");
+    }
+
+    if( (latencyHistoDigits < HDRHISTO_MIN_SIGNIFICANT_DIGITS) ||
+        (latencyHistoDigits > HDRHISTO_MAX_SIGNIFICANT_DIGITS) )
+        throw ProgException("Option \"--" ARG_LATENCYHISTODIGITS_LONG "\" is out of range. "
+            "Given value: " + std::to_string(latencyHistoDigits) + "; "
+            "Range: " STRINGIZE(HDRHISTO_MIN_SIGNIFICANT_DIGITS) "-"
+            STRINGIZE(HDRHISTO_MAX_SIGNIFICANT_DIGITS) );
+
+    if(dedupePercent >= 100)
+        throw ProgException("Option \"--" ARG_DEDUPEPERCENT_LONG "\" must be smaller than 100. "
+            "Given value: " + std::to_string(dedupePercent) );
+
+    if(dedupePercent && runCreateFilesPhase)
+    {
+        if(blockVariancePercent != 100)
+            throw ProgException("Option \"--" ARG_DEDUPEPERCENT_LONG "\" requires "
+                "\"--" ARG_BLOCKVARIANCE_LONG " 100\". (Note that block variance is disabled by "
+                "integrity check and netbench mode.)");
+
+        if(!dedupeChunkSize || (blockSize % dedupeChunkSize) )
+            throw ProgException("Block size needs to be a multiple of "
+                "\"--" ARG_DEDUPECHUNK_LONG "\". "
+                "Block size: " + std::to_string(blockSize) + "; "
+                "Dedupe chunk size: " + std::to_string(dedupeChunkSize) );
+
+        if(blockVarPoolSize || !gpuIDsVec.empty() )
+            throw ProgException("Option \"--" ARG_DEDUPEPERCENT_LONG "\" cannot be used together "
+                "with \"--" ARG_BLOCKVARPOOL_LONG "\" or GPUs.");
+    }
+
+    if(blockVarPoolSize && runCreateFilesPhase)
+    {
+        if(!blockVariancePercent)
+            throw ProgException("Option \"--" ARG_BLOCKVARPOOL_LONG "\" requires "
+                "\"--" ARG_BLOCKVARIANCE_LONG "\" larger than 0. (Note that block variance is "
+                "disabled by integrity check and netbench mode.)");
+
+        if(benchMode != BenchMode_POSIX)
+            throw ProgException("Option \"--" ARG_BLOCKVARPOOL_LONG "\" can only be used for "
+                "file and block device I/O.");
+
+        if(useMmap || useCuFile || !gpuIDsVec.empty() )
+            throw ProgException("Option \"--" ARG_BLOCKVARPOOL_LONG "\" cannot be used together "
+                "with mmap, cuFile API or GPUs.");
+
+        if(blockVarPoolSize < ioDepth)
+            throw ProgException("Option \"--" ARG_BLOCKVARPOOL_LONG "\" must not be smaller than "
+                "\"--" ARG_IODEPTH_LONG "\". "
+                "Given value: " + std::to_string(blockVarPoolSize) + "; "
+                "IO depth: " + std::to_string(ioDepth) );
+    }
+
     if(integrityCheckSalt && runCreateFilesPhase && useRandomOffsets)
         throw ProgException("Integrity check writes are not supported in combination with random "
             "offsets.");
@@ -1552,19 +2034,104 @@ void ProgArgs::checkArgs()
     if(doDirectVerify && (ioDepth > 1) )
         throw ProgException("Direct verification cannot be used together with --" ARG_IODEPTH_LONG);
 
+    if(doDirectVerify && useIOUring)
+        throw ProgException("Direct verification cannot be used together with --" ARG_IOURING_LONG);
+
     if(doReadInline && (ioDepth > 1) )
         throw ProgException("Inline read cannot be used together with --" ARG_IODEPTH_LONG);
 
-    if( (flockType == ARG_FLOCK_FULL) && (ioDepth > 1) && runCreateFilesPhase)
+    if(doReadInline && useIOUring)
+        throw ProgException("Inline read cannot be used together with --" ARG_IOURING_LONG);
+
+    if( (flockType == ARG_FLOCK_FULL) && ( (ioDepth > 1) || useIOUring) && runCreateFilesPhase)
         throw ProgException("Full file write locks cannot be used together with async IO");
 
-    if( (ioDepth > 1) && (limitReadBps || limitWriteBps) && (benchMode == BenchMode_POSIX) )
-    { /* note: we don't check for "showLatency" & friends here because latency is always shown
-        in csv/json */
-        LOGGER(Log_NORMAL, "NOTE: Using rate limiter with \"iodepth > 1\" can result in some "
-        "I/Os being dropped from latency stats." << std::endl);
+    if(warmupSecs && timeLimitSecs && (warmupSecs >= timeLimitSecs) )
+        throw ProgException("Option \"--" ARG_WARMUPSECS_LONG "\" must be lower than "
+            "\"--" ARG_TIMELIMITSECS_LONG "\".");
+
+    if(precondNumFills || precondSoakSecs)
+    {
+        if(benchMode != BenchMode_POSIX)
+            throw ProgException("Preconditioning is only supported for file system and block "
+                "device paths.");
+
+        // (in master mode, path type is only known after checkServiceBenchPathInfos() )
+        if(hostsVec.empty() && (benchPathType == BenchPathType_DIR) )
+            throw ProgException("Preconditioning is only supported for block devices and files, "
+                "not for directories.");
+
+        if(!treeFilePath.empty() )
+            throw ProgException("Preconditioning cannot be used together with "
+                "\"--" ARG_TREEFILE_LONG "\"");
+
+        if(hasUserSetRWMixPercent() || hasUserSetRWMixReadThreads() )
+            throw ProgException("Preconditioning cannot be used together with "
+                "\"--" ARG_RWMIXPERCENT_LONG "\" or \"--" ARG_RWMIXTHREADS_LONG "\"");
+
+        if(precondSoakSecs && (useStridedAccess || doReverseSeqOffsets) )
+            throw ProgException("Preconditioning soak cannot be used together with "
+                "\"--" ARG_STRIDEDACCESS_LONG "\" or \"--" ARG_REVERSESEQOFFSETS_LONG "\"");
+
+        if(!steadyStateRoundSecs)
+            throw ProgException("Option \"--" ARG_STEADYSTATEROUND_LONG "\" must not be 0.");
+
+        if(steadyStateWindowRounds < 2)
+            throw ProgException("Option \"--" ARG_STEADYSTATEWINDOW_LONG "\" must be at least 2.");
     }
 
+    if(!stabilityDipPercent || (stabilityDipPercent > 100) )
+        throw ProgException("Option \"--" ARG_STABILITYDIP_LONG "\" must be between 1 and 100.");
+
+    if(!liveBinFilePath.empty() &&
+        ( (liveBinFilePath == liveCSVFilePath) || (liveBinFilePath == resFilePathCSV) ||
+        (liveBinFilePath == ARG_LIVECSV_STDOUT) ) )
+        throw ProgException("Option \"--" ARG_LIVEBINFILE_LONG "\" must not be the same file as "
+            "\"--" ARG_CSVLIVEFILE_LONG "\" or \"--" ARG_CSVFILE_LONG "\" and cannot be sent to "
+            "stdout.");
+
+    if(useOpsLogBinary && useOpsLogLocking)
+        throw ProgException("Option \"--" ARG_OPSLOGBINARY_LONG "\" cannot be used together with "
+            "\"--" ARG_OPSLOGLOCKING_LONG "\", because the binary ops log has its own background "
+            "writer.");
+
+    if(!opsLogSampleN)
+        throw ProgException("Option \"--" ARG_OPSLOGSAMPLE_LONG "\" must not be 0.");
+
+    if( (opsLogSampleN > 1) && !useOpsLogBinary)
+        throw ProgException("Option \"--" ARG_OPSLOGSAMPLE_LONG "\" requires "
+            "\"--" ARG_OPSLOGBINARY_LONG "\".");
+
+    if(!traceSampleN)
+        throw ProgException("Option \"--" ARG_TRACESAMPLE_LONG "\" must not be 0.");
+
+    if( (traceSampleN > 1) && traceFilePath.empty() )
+        throw ProgException("Option \"--" ARG_TRACESAMPLE_LONG "\" requires "
+            "\"--" ARG_TRACEFILE_LONG "\".");
+
+    if(!replayFilePath.empty() )
+    {
+        if(!treeFilePath.empty() )
+            throw ProgException("Option \"--" ARG_REPLAY_LONG "\" cannot be used together with "
+                "\"--" ARG_TREEFILE_LONG "\".");
+
+        if(useNetBench || useHDFS || useMmap || useCuFile)
+            throw ProgException("Option \"--" ARG_REPLAY_LONG "\" cannot be used together with "
+                "\"--" ARG_NETBENCH_LONG "\", \"--" ARG_HDFS_LONG "\", \"--" ARG_MMAP_LONG "\" "
+                "or \"--" ARG_CUFILE_LONG "\".");
+
+        if(integrityCheckSalt)
+            throw ProgException("Option \"--" ARG_REPLAY_LONG "\" cannot be used together with "
+                "\"--" ARG_INTEGRITYCHECK_LONG "\".");
+
+        if(replaySpeed < 0)
+            throw ProgException("Option \"--" ARG_REPLAYSPEED_LONG "\" may not be negative.");
+    }
+
+    // checks above applied to the max IO depth of a sweep, now switch to the first combination
+    if(getIsSweep() )
+        ioDepth = sweepIODepthsVec.front();
+
     if(!hostsVec.empty() )
         return;
 
@@ -2639,6 +3206,134 @@ void ProgArgs::parseCPUCores()
 		"cpu core affinity list after: " << NumaTk::getCurrentCPUAffinityStrHuman() << std::endl);
 }
 
+/**
+ * Parse the value lists of a parameter sweep and set thread count, block size and file size to
+ * the first combination. IO depth gets set to the largest value, so that the checks for async IO
+ * apply; checkArgs() switches it to the first value afterwards. Lists that were not given by the
+ * user contain only the current value.
+ *
+ * @throw ProgException if a list cannot be parsed.
+ */
+void ProgArgs::parseSweepLists()
+{
+	if(!getIsSweep() )
+		return; // nothing to do
+
+	sweepBlockSizesVec.assign(1, blockSize);
+	sweepFileSizesVec.assign(1, fileSize);
+	sweepIODepthsVec.assign(1, ioDepth);
+	sweepNumThreadsVec.assign(1, numThreads);
+
+	parseSweepList(sweepBlockSizesStr, ARG_SWEEPBLOCK_LONG, sweepBlockSizesVec);
+	parseSweepList(sweepFileSizesStr, ARG_SWEEPSIZE_LONG, sweepFileSizesVec);
+	parseSweepList(sweepIODepthsStr, ARG_SWEEPIODEPTH_LONG, sweepIODepthsVec);
+	parseSweepList(sweepNumThreadsStr, ARG_SWEEPTHREADS_LONG, sweepNumThreadsVec);
+
+	blockSize = sweepBlockSizesVec.front();
+	fileSize = sweepFileSizesVec.front();
+	ioDepth = *std::max_element(sweepIODepthsVec.begin(), sweepIODepthsVec.end() );
+	numThreads = sweepNumThreadsVec.front();
+}
+
+/**
+ * Parse a single value list of a parameter sweep. Elements may have units (e.g. "4K") and
+ * "min:max" elements expand to all doubling steps from min to max (incl. max).
+ *
+ * @listStr the list from the user; nothing is done if this is empty.
+ * @argName name of the option for error messages.
+ * @outVec will be overwritten with the parsed values if listStr is not empty.
+ * @throw ProgException if the list cannot be parsed or contains a zero value.
+ */
+void ProgArgs::parseSweepList(std::string listStr, std::string argName, UInt64Vec& outVec)
+{
+	if(listStr.empty() )
+		return; // nothing to do
+
+	StringVec valuesStrVec; // temporary for split()
+
+	// split by given delimiters and expand lists/ranges in square brackets
+	TranslatorTk::splitAndExpandStr(listStr, SWEEPLIST_DELIMITERS, valuesStrVec);
+
+	// delete empty string elements from vec (they come from delimiter use at beginning or end)
+	TranslatorTk::eraseEmptyStringsFromVec(valuesStrVec);
+
+	if(valuesStrVec.empty() )
+		throw ProgException("Sweep list defined, but parsing resulted in an empty list. "
+			"Option: --" + argName + "; "
+			"List: " + listStr);
+
+	outVec.clear();
+
+	for(const std::string& valueStr : valuesStrVec)
+	{
+		const size_t rangeSepPos = valueStr.find(SWEEPLIST_RANGE_SEPARATOR);
+
+		const uint64_t minValue = UnitTk::numHumanToBytesBinary(
+			valueStr.substr(0, rangeSepPos), true);
+		const uint64_t maxValue = (rangeSepPos == std::string::npos) ? minValue :
+			UnitTk::numHumanToBytesBinary(valueStr.substr(rangeSepPos + 1), true);
+
+		if(!minValue || (maxValue < minValue) )
+			throw ProgException("Invalid sweep list element. Values must not be 0 and ranges must "
+				"not be descending. "
+				"Option: --" + argName + "; "
+				"Element: " + valueStr);
+
+		for(uint64_t value = minValue; value < maxValue; value *= 2)
+			outVec.push_back(value);
+
+		outVec.push_back(maxValue);
+	}
+}
+
+/**
+ * Switch to the next combination of a parameter sweep. This resets the values that got derived
+ * from the previous combination and checks the new combination in local standalone mode. (Service
+ * instances check it in their preparation phase.) Workers need to be restarted afterwards to apply
+ * the new values.
+ *
+ * @throw ProgException if the new combination is invalid.
+ */
+void ProgArgs::setSweepValues(size_t numThreads, size_t ioDepth, uint64_t blockSize,
+	uint64_t fileSize)
+{
+	this->numThreads = numThreads;
+	this->ioDepth = ioDepth;
+	this->blockSize = blockSize;
+	this->fileSize = fileSize;
+
+	// auto-set by checkPathDependentArgs() based on previous file size
+	randomAmount = UnitTk::numHumanToBytesBinary(randomAmountOrigStr, false);
+
+	numDataSetThreads = (!hostsVec.empty() && getIsServicePathShared() ) ?
+		(numThreads * hostsVec.size() ) : numThreads;
+
+	dedupeNumRanks = numThreads * (hostsVec.empty() ? 1 : hostsVec.size() );
+
+	if(hostsVec.empty() )
+		checkPathDependentArgs();
+}
+
+/**
+ * Switch between sequential and random offsets and between single pass and infinite loop, e.g. for
+ * preconditioning. This resets the values that got derived from the previous pattern and checks the
+ * new pattern in local standalone mode. (Service instances check it in their preparation phase.)
+ * Workers need to be restarted afterwards to apply the new values.
+ *
+ * @throw ProgException if the new pattern is invalid.
+ */
+void ProgArgs::setIOPatternValues(bool useRandomOffsets, bool doInfiniteIOLoop)
+{
+	this->useRandomOffsets = useRandomOffsets;
+	this->doInfiniteIOLoop = doInfiniteIOLoop;
+
+	// auto-set by checkPathDependentArgs() based on previous pattern
+	randomAmount = UnitTk::numHumanToBytesBinary(randomAmountOrigStr, false);
+
+	if(hostsVec.empty() )
+		checkPathDependentArgs();
+}
+
 /**
  * Parse GPU IDs string to fill gpuIDsVec. Do nothing if gpuIDsStr is empty.
  *
@@ -2924,6 +3619,30 @@ void ProgArgs::loadCustomTreeFile()
 	}
 }
 
+/**
+ * If replay file is given, load ops from the ops log file for the replay phase. Otherwise do
+ * nothing.
+ *
+ * @throw ProgException on error, such as replay file not exists.
+ */
+void ProgArgs::loadReplayFile()
+{
+	if(replayFilePath.empty() )
+		return; // nothing to do
+
+	replayOps.loadOpsFromFile(replayFilePath, replayRoot, benchPathsVec, benchMode);
+
+	LOGGER(Log_VERBOSE, "Loaded ops for replay. "
+		"Ops: " << replayOps.getOps().size() << "; "
+		"Skipped: " << replayOps.getNumSkippedOps() << std::endl);
+
+	if(replayOps.isEmpty() )
+		throw ProgException("Ops log file for replay contains no ops that can be replayed in " +
+			TranslatorTk::benchModeToModeName(benchMode) + " mode. "
+			"File: " + replayFilePath + "; "
+			"Skipped ops: " + std::to_string(replayOps.getNumSkippedOps() ) );
+}
+
 /**
  * Precreate the s3 mpu upload IDs for shared mpu mode between services.
  *
@@ -3627,6 +4346,34 @@ bool ProgArgs::hasUserRequestedVersion()
 	return false;
 }
 
+/**
+ * Check if user gave the argument to convert a binary live time-series file to json. If this
+ * returns true, then the rest of the settings in this class is not initialized, so may not be used.
+ *
+ * @return true if conversion was requested.
+ */
+bool ProgArgs::hasUserRequestedLiveBinConversion()
+{
+	if(argsVariablesMap.count(ARG_LIVEBINTOJSON_LONG) )
+		return true;
+
+	return false;
+}
+
+/**
+ * Check if user gave the argument to convert a binary ops log file to json. If this returns true,
+ * then the rest of the settings in this class is not initialized, so may not be used.
+ *
+ * @return true if conversion was requested.
+ */
+bool ProgArgs::hasUserRequestedOpsLogConversion()
+{
+	if(argsVariablesMap.count(ARG_OPSLOGTOJSON_LONG) )
+		return true;
+
+	return false;
+}
+
 /**
  * Check if user gave the argument to do only a dry run.
  *
@@ -3701,6 +4448,12 @@ void ProgArgs::printVersionAndBuildInfo()
 	notIncludedStream << "libnuma ";
 #endif
 
+#ifdef LIBURING_SUPPORT
+	includedStream << "liburing ";
+#else
+	notIncludedStream << "liburing ";
+#endif
+
 #ifdef USE_MIMALLOC
 	includedStream << "mimalloc ";
 #else
@@ -3761,6 +4514,12 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 	blockSize = tree.get<size_t>(ARG_BLOCK_LONG);
 	blockVarianceAlgo = tree.get<std::string>(ARG_BLOCKVARIANCEALGO_LONG);
 	blockVariancePercent = tree.get<unsigned>(ARG_BLOCKVARIANCE_LONG);
+	blockVarPoolSize = tree.get<size_t>(ARG_BLOCKVARPOOL_LONG);
+	compressRatio = tree.get<double>(ARG_COMPRESSRATIO_LONG);
+	dedupeChunkSize = tree.get<size_t>(ARG_DEDUPECHUNK_LONG);
+	dedupePercent = tree.get<unsigned>(ARG_DEDUPEPERCENT_LONG);
+	dedupeScope = tree.get<unsigned short>(ARG_DEDUPESCOPE_LONG);
+	dedupeSeed = tree.get<uint64_t>(ARG_DEDUPESEED_LONG);
 	doDirectVerify = tree.get<bool>(ARG_VERIFYDIRECT_LONG);
 	doDirSharing = tree.get<bool>(ARG_DIRSHARING_LONG);
 	doInfiniteIOLoop = tree.get<bool>(ARG_INFINITEIOLOOP_LONG);
@@ -3785,14 +4544,22 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 	fileShareSize = tree.get<uint64_t>(ARG_FILESHARESIZE_LONG);
 	fileSize = tree.get<uint64_t>(ARG_FILESIZE_LONG);
 	flockType = tree.get<unsigned short>(ARG_FLOCK_LONG);
+	showFileLatBreakdown = tree.get<bool>(ARG_FILELAT_LONG);
 	gpuIDsStr = tree.get<std::string>(ARG_GPUIDS_LONG);
 	ignore0USecErrors = tree.get<bool>(ARG_IGNORE0USECERR_LONG);
 	ignoreDelErrors = tree.get<bool>(ARG_IGNOREDELERR_LONG);
 	ignoreS3Errors = tree.get<bool>(ARG_S3IGNOREERRORS_LONG);
 	integrityCheckSalt = tree.get<uint64_t>(ARG_INTEGRITYCHECK_LONG);
+	ioBatchMin = tree.get<size_t>(ARG_IOBATCHMIN_LONG);
 	ioDepth = tree.get<size_t>(ARG_IODEPTH_LONG);
+	showLatency = tree.get<bool>(ARG_LATENCY_LONG);
+	latencyHistoDigits = tree.get<unsigned short>(ARG_LATENCYHISTODIGITS_LONG);
 	limitReadBps = tree.get<uint64_t>(ARG_LIMITREAD_LONG);
 	limitWriteBps = tree.get<uint64_t>(ARG_LIMITWRITE_LONG);
+	limitReadIOPS = tree.get<uint64_t>(ARG_LIMITREADIOPS_LONG);
+	limitWriteIOPS = tree.get<uint64_t>(ARG_LIMITWRITEIOPS_LONG);
+	limitRefillUSec = tree.get<uint64_t>(ARG_LIMITREFILL_LONG);
+	limitScope = tree.get<unsigned short>(ARG_LIMITSCOPE_LONG);
 	madviseFlags = tree.get<unsigned>(ARG_MADVISE_LONG);
 	netBenchRespSize = tree.get<size_t>(ARG_RESPSIZE_LONG);
 	netBenchServersStr = tree.get<std::string>(ARG_NETBENCHSERVERSSTR_LONG);
@@ -3801,10 +4568,16 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 	numFiles = tree.get<size_t>(ARG_NUMFILES_LONG);
 	numNetBenchServers = tree.get<unsigned>(ARG_NUMNETBENCHSERVERS_LONG);
 	numRWMixReadThreads = tree.get<size_t>(ARG_RWMIXTHREADS_LONG);
+	numSlowOps = tree.get<size_t>(ARG_SLOWOPS_LONG);
 	numThreads = tree.get<size_t>(ARG_NUMTHREADS_LONG);
+	openLoopOpsPerSec = tree.get<uint64_t>(ARG_OPENLOOP_LONG);
+	openLoopDist = tree.get<unsigned short>(ARG_OPENLOOPDIST_LONG);
 	opsLogPath = tree.get<std::string>(ARG_OPSLOGPATH_LONG);
+	opsLogSampleN = tree.get<size_t>(ARG_OPSLOGSAMPLE_LONG);
 	randOffsetAlgo = tree.get<std::string>(ARG_RANDSEEKALGO_LONG);
 	randomAmount = tree.get<uint64_t>(ARG_RANDOMAMOUNT_LONG);
+	replayRoot = tree.get<std::string>(ARG_REPLAYROOT_LONG);
+	replaySpeed = tree.get<double>(ARG_REPLAYSPEED_LONG);
 	runCreateDirsPhase = tree.get<bool>(ARG_CREATEDIRS_LONG);
 	runCreateFilesPhase = tree.get<bool>(ARG_CREATEFILES_LONG);
 	runDeleteDirsPhase = tree.get<bool>(ARG_DELETEDIRS_LONG);
@@ -3848,6 +4621,8 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
     showThroughputBase10 = tree.get<bool>(ARG_THROUGHPUTBASE10_LONG);
 	sockRecvBufSize = tree.get<int>(ARG_RECVBUFSIZE_LONG);
 	sockSendBufSize = tree.get<int>(ARG_SENDBUFSIZE_LONG);
+	traceFilePath = tree.get<std::string>(ARG_TRACEFILE_LONG);
+	traceSampleN = tree.get<size_t>(ARG_TRACESAMPLE_LONG);
 	treeRoundUpSize = tree.get<uint64_t>(ARG_TREEROUNDUP_LONG);
 	useCuFile = tree.get<bool>(ARG_CUFILE_LONG);
 	useCuFileDriverOpen = tree.get<bool>(ARG_CUFILEDRIVEROPEN_LONG);
@@ -3857,9 +4632,14 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 	useDirectIO = tree.get<bool>(ARG_DIRECTIO_LONG);
 	useGDSBufReg = tree.get<bool>(ARG_GDSBUFREG_LONG);
 	useHDFS = tree.get<bool>(ARG_HDFS_LONG);
+	useIOUring = tree.get<bool>(ARG_IOURING_LONG);
+	useIOUringIOPoll = tree.get<bool>(ARG_IOURINGIOPOLL_LONG);
+	useIOUringSQPoll = tree.get<bool>(ARG_IOURINGSQPOLL_LONG);
+	useLimitSpin = tree.get<bool>(ARG_LIMITSPIN_LONG);
 	useMmap = tree.get<bool>(ARG_MMAP_LONG);
 	useNetBench = tree.get<bool>(ARG_NETBENCH_LONG);
 	useNoFDSharing = tree.get<bool>(ARG_NOFDSHARING_LONG);
+	useOpsLogBinary = tree.get<bool>(ARG_OPSLOGBINARY_LONG);
 	useOpsLogLocking = tree.get<bool>(ARG_OPSLOGLOCKING_LONG);
 	useRandomUnaligned = tree.get<bool>(ARG_NORANDOMALIGN_LONG);
 	useRandomOffsets = tree.get<bool>(ARG_RANDOMOFFSETS_LONG);
@@ -3870,6 +4650,7 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
     useS3SSE = tree.get<bool>(ARG_S3SSE_LONG);
     useS3VirtualAddressing = tree.get<bool>(ARG_S3VIRTADDRESSING_LONG);
 	useStridedAccess = tree.get<bool>(ARG_STRIDEDACCESS_LONG);
+	warmupSecs = tree.get<size_t>(ARG_WARMUPSECS_LONG);
 
 	// dynamically calculated values for service hosts...
 
@@ -3877,6 +4658,9 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 
 	numDataSetThreads = tree.get<size_t>(ARG_NUMDATASETTHREADS_LONG);
 
+	dedupeNumRanks = tree.get<size_t>(ARG_DEDUPENUMRANKS_LONG);
+	dedupeRankOffset = tree.get<size_t>(ARG_DEDUPERANKOFFSET_LONG);
+
 	// prepend upload dir to tree file
 	treeFilePath = tree.get<std::string>(ARG_TREEFILE_LONG);
 	if(!treeFilePath.empty() )
@@ -3895,6 +4679,22 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 		loadCustomTreeFile();
 	}
 
+	// prepend upload dir to replay file
+	replayFilePath = tree.get<std::string>(ARG_REPLAY_LONG);
+	if(!replayFilePath.empty() )
+	{
+		char* filenameDup = strdup(replayFilePath.c_str() );
+		if(!filenameDup)
+			throw ProgException("Failed to alloc mem for filename dup: " + replayFilePath);
+
+		// note: basename() ensures that there is no "../" or subdirs in the given filename
+		std::string filename = basename(filenameDup);
+
+		free(filenameDup);
+
+		replayFilePath = SERVICE_UPLOAD_BASEPATH(servicePort) + "/" + filename;
+	}
+
 	parseS3Endpoints();
 	parseNetBenchServersForService();
 
@@ -3903,6 +4703,8 @@ void ProgArgs::setFromPropertyTreeForService(bpt::ptree& tree)
 
 	checkPathDependentArgs();
 
+	loadReplayFile(); // (after parseAndCheckPaths() for replay root substitution)
+
 	// apply GPU IDs override if given
 	if(!gpuIDsStr.empty() && !gpuIDsServiceOverride.empty() )
 		gpuIDsStr = gpuIDsServiceOverride;
@@ -3925,6 +4727,12 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
 	outTree.put(ARG_BLOCK_LONG, blockSize);
 	outTree.put(ARG_BLOCKVARIANCE_LONG, blockVariancePercent);
 	outTree.put(ARG_BLOCKVARIANCEALGO_LONG, blockVarianceAlgo);
+	outTree.put(ARG_BLOCKVARPOOL_LONG, blockVarPoolSize);
+	outTree.put(ARG_COMPRESSRATIO_LONG, compressRatio);
+	outTree.put(ARG_DEDUPECHUNK_LONG, dedupeChunkSize);
+	outTree.put(ARG_DEDUPEPERCENT_LONG, dedupePercent);
+	outTree.put(ARG_DEDUPESCOPE_LONG, dedupeScope);
+	outTree.put(ARG_DEDUPESEED_LONG, dedupeSeed);
 	outTree.put(ARG_BENCHLABEL_LONG, benchLabel);
     outTree.put(ARG_BENCHMODE_LONG, benchMode);
 	outTree.put(ARG_BENCHPATHS_LONG, benchPathStr);
@@ -3941,6 +4749,7 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
 	outTree.put(ARG_FADVISE_LONG, fadviseFlags);
 	outTree.put(ARG_FILESHARESIZE_LONG, fileShareSize);
 	outTree.put(ARG_FILESIZE_LONG, fileSize);
+	outTree.put(ARG_FILELAT_LONG, showFileLatBreakdown);
 	outTree.put(ARG_FLOCK_LONG, flockType);
 	outTree.put(ARG_GDSBUFREG_LONG, useGDSBufReg);
 	outTree.put(ARG_HDFS_LONG, useHDFS);
@@ -3948,9 +4757,20 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
 	outTree.put(ARG_IGNOREDELERR_LONG, ignoreDelErrors);
 	outTree.put(ARG_INFINITEIOLOOP_LONG, doInfiniteIOLoop);
 	outTree.put(ARG_INTEGRITYCHECK_LONG, integrityCheckSalt);
+	outTree.put(ARG_IOBATCHMIN_LONG, ioBatchMin);
 	outTree.put(ARG_IODEPTH_LONG, ioDepth);
+	outTree.put(ARG_IOURING_LONG, useIOUring);
+	outTree.put(ARG_IOURINGIOPOLL_LONG, useIOUringIOPoll);
+	outTree.put(ARG_IOURINGSQPOLL_LONG, useIOUringSQPoll);
+	outTree.put(ARG_LATENCY_LONG, showLatency);
+	outTree.put(ARG_LATENCYHISTODIGITS_LONG, latencyHistoDigits);
 	outTree.put(ARG_LIMITREAD_LONG, limitReadBps);
 	outTree.put(ARG_LIMITWRITE_LONG, limitWriteBps);
+	outTree.put(ARG_LIMITREADIOPS_LONG, limitReadIOPS);
+	outTree.put(ARG_LIMITWRITEIOPS_LONG, limitWriteIOPS);
+	outTree.put(ARG_LIMITREFILL_LONG, limitRefillUSec);
+	outTree.put(ARG_LIMITSCOPE_LONG, limitScope);
+	outTree.put(ARG_LIMITSPIN_LONG, useLimitSpin);
 	outTree.put(ARG_MADVISE_LONG, madviseFlags);
 	outTree.put(ARG_MMAP_LONG, useMmap);
 	outTree.put(ARG_NETBENCH_LONG, useNetBench);
@@ -3960,10 +4780,15 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
 	outTree.put(ARG_NUMFILES_LONG, numFiles);
 	outTree.put(ARG_NUMNETBENCHSERVERS_LONG, numNetBenchServers);
 	outTree.put(ARG_NUMTHREADS_LONG, numThreads);
+	outTree.put(ARG_SLOWOPS_LONG, numSlowOps);
 	outTree.put(ARG_NOFDSHARING_LONG, useNoFDSharing);
 	outTree.put(ARG_NODIRECTIOCHECK_LONG, noDirectIOCheck);
+	outTree.put(ARG_OPENLOOP_LONG, openLoopOpsPerSec);
+	outTree.put(ARG_OPENLOOPDIST_LONG, openLoopDist);
+	outTree.put(ARG_OPSLOGBINARY_LONG, useOpsLogBinary);
 	outTree.put(ARG_OPSLOGLOCKING_LONG, useOpsLogLocking);
 	outTree.put(ARG_OPSLOGPATH_LONG, opsLogPath);
+	outTree.put(ARG_OPSLOGSAMPLE_LONG, opsLogSampleN);
 	outTree.put(ARG_PREALLOCFILE_LONG, doPreallocFile);
 	outTree.put(ARG_NORANDOMALIGN_LONG, useRandomUnaligned);
 	outTree.put(ARG_RANDOMAMOUNT_LONG, randomAmount);
@@ -3972,6 +4797,8 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
 	outTree.put(ARG_READ_LONG, runReadPhase);
 	outTree.put(ARG_READINLINE_LONG, doReadInline);
 	outTree.put(ARG_RECVBUFSIZE_LONG, sockRecvBufSize);
+	outTree.put(ARG_REPLAYROOT_LONG, replayRoot);
+	outTree.put(ARG_REPLAYSPEED_LONG, replaySpeed);
 	outTree.put(ARG_RESPSIZE_LONG, netBenchRespSize);
 	outTree.put(ARG_REVERSESEQOFFSETS_LONG, doReverseSeqOffsets);
 	outTree.put(ARG_RWMIXPERCENT_LONG, rwMixReadPercent);
@@ -4032,12 +4859,15 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
     outTree.put(ARG_STRIDEDACCESS_LONG, useStridedAccess);
     outTree.put(ARG_SYNCPHASE_LONG, runSyncPhase);
     outTree.put(ARG_THROUGHPUTBASE10_LONG, showThroughputBase10);
+	outTree.put(ARG_TRACEFILE_LONG, traceFilePath);
+	outTree.put(ARG_TRACESAMPLE_LONG, traceSampleN);
 	outTree.put(ARG_TRUNCATE_LONG, doTruncate);
 	outTree.put(ARG_TRUNCTOSIZE_LONG, doTruncToSize);
 	outTree.put(ARG_TREERANDOMIZE_LONG, useCustomTreeRandomize);
     outTree.put(ARG_TREEROUNDROBIN_LONG, useCustomTreeRoundRobin);
 	outTree.put(ARG_TREEROUNDUP_LONG, treeRoundUpSize);
 	outTree.put(ARG_VERIFYDIRECT_LONG, doDirectVerify);
+	outTree.put(ARG_WARMUPSECS_LONG, warmupSecs);
 
 
 	// dynamically calculated values for service hosts...
@@ -4047,7 +4877,21 @@ void ProgArgs::getAsPropertyTreeForService(bpt::ptree& outTree, size_t serviceRa
 
 	outTree.put(ARG_RANKOFFSET_LONG, remoteRankOffset);
 
+	if(limitScope == ARG_LIMITSCOPE_GLOBAL)
+	{ // even share of global limit as start value, master rebalances during the phase
+		const size_t numHosts = hostsVec.size();
+
+		outTree.put(ARG_LIMITREAD_LONG, limitReadBps / numHosts);
+		outTree.put(ARG_LIMITWRITE_LONG, limitWriteBps / numHosts);
+		outTree.put(ARG_LIMITREADIOPS_LONG, limitReadIOPS / numHosts);
+		outTree.put(ARG_LIMITWRITEIOPS_LONG, limitWriteIOPS / numHosts);
+	}
+
+	outTree.put(ARG_DEDUPENUMRANKS_LONG, dedupeNumRanks);
+	outTree.put(ARG_DEDUPERANKOFFSET_LONG, serviceRank * numThreads);
+
 	outTree.put(ARG_TREEFILE_LONG, treeFilePath.empty() ? "" : SERVICE_UPLOAD_TREEFILE);
+	outTree.put(ARG_REPLAY_LONG, replayFilePath.empty() ? "" : SERVICE_UPLOAD_REPLAYFILE);
 
 	if(!assignGPUPerService || gpuIDsVec.empty() )
 		outTree.put(ARG_GPUIDS_LONG, gpuIDsStr);
@@ -4245,6 +5089,10 @@ void ProgArgs::checkServiceBenchPathInfos(BenchPathInfoVec& benchPathInfos)
 	randomAmount = firstInfo.randomAmount;
 	blockSize = firstInfo.blockSize;
 
+	if( (precondNumFills || precondSoakSecs) && (benchPathType == BenchPathType_DIR) )
+		throw ProgException("Preconditioning is only supported for block devices and files, "
+			"not for directories.");
+
 	// compare all other bench path infos to 1st info in list
 	for(size_t i=1; i < benchPathInfos.size(); i++)
 	{
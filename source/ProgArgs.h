@@ -13,6 +13,7 @@
 #include "CuFileHandleData.h"
 #include "Logger.h"
 #include "PathStore.h"
+#include "ReplayOpStore.h"
 #include "toolkits/S3Tk.h"
 #include "toolkits/SystemTk.h" // IWYU pragma: keep (false clangd unused include warning)
 
@@ -33,9 +34,11 @@ namespace bpt = boost::property_tree;
 #define ARG_BLOCK_SHORT                  "b"
 #define ARG_BLOCKVARIANCE_LONG           "blockvarpct"
 #define ARG_BLOCKVARIANCEALGO_LONG       "blockvaralgo"
+#define ARG_BLOCKVARPOOL_LONG            "blockvarpool"
 #define ARG_BRIEFLIVESTATS_LONG          "live1"
 #define ARG_CLIENTS_LONG                 "clients"
 #define ARG_CLIENTSFILE_LONG             "clientsfile"
+#define ARG_COMPRESSRATIO_LONG           "compressratio"
 #define ARG_CONFIGFILE_LONG              "configfile"
 #define ARG_CONFIGFILE_SHORT             "c"
 #define ARG_CPUCORES_LONG                "cores"
@@ -50,6 +53,12 @@ namespace bpt = boost::property_tree;
 #define ARG_CUFILE_LONG                  "cufile"
 #define ARG_CUFILEDRIVEROPEN_LONG        "cufiledriveropen"
 #define ARG_CUHOSTBUFREG_LONG            "cuhostbufreg"
+#define ARG_DEDUPECHUNK_LONG             "dedupechunk"
+#define ARG_DEDUPENUMRANKS_LONG          "dedupenumranks" // internal (not set by user)
+#define ARG_DEDUPEPERCENT_LONG           "dedupepct"
+#define ARG_DEDUPERANKOFFSET_LONG        "deduperankoffset" // internal (not set by user)
+#define ARG_DEDUPESCOPE_LONG             "dedupescope"
+#define ARG_DEDUPESEED_LONG              "dedupeseed"
 #define ARG_DELETEDIRS_LONG              "deldirs"
 #define ARG_DELETEDIRS_SHORT             "D"
 #define ARG_DELETEFILES_LONG             "delfiles"
@@ -60,6 +69,7 @@ namespace bpt = boost::property_tree;
 #define ARG_DROPCACHESPHASE_LONG         "dropcache"
 #define ARG_DRYRUN_LONG                  "dryrun"
 #define ARG_FADVISE_LONG                 "fadv"
+#define ARG_FILELAT_LONG                 "filelat"
 #define ARG_FILESHARESIZE_LONG           "sharesize"
 #define ARG_FILESIZE_LONG                "size"
 #define ARG_FILESIZE_SHORT               "s"
@@ -85,7 +95,11 @@ namespace bpt = boost::property_tree;
 #define ARG_INFINITEIOLOOP_LONG          "infloop"
 #define ARG_INTEGRITYCHECK_LONG          "verify"
 #define ARG_INTERRUPT_LONG               "interrupt"
+#define ARG_IOBATCHMIN_LONG              "iobatch"
 #define ARG_IODEPTH_LONG                 "iodepth"
+#define ARG_IOURING_LONG                 "iouring"
+#define ARG_IOURINGIOPOLL_LONG           "iouringiopoll"
+#define ARG_IOURINGSQPOLL_LONG           "iouringsqpoll"
 #define ARG_ITERATIONS_LONG              "iterations"
 #define ARG_ITERATIONS_SHORT             "i"
 #define ARG_JSONFILE_LONG                "jsonfile"
@@ -93,10 +107,18 @@ namespace bpt = boost::property_tree;
 #define ARG_JSONLIVEFILE_LONG            "livejson"
 #define ARG_LATENCY_LONG                 "lat"
 #define ARG_LATENCYHISTOGRAM_LONG        "lathisto"
+#define ARG_LATENCYHISTODIGITS_LONG      "lathistodigits"
 #define ARG_LATENCYPERCENT9S_LONG        "latpercent9s"
 #define ARG_LATENCYPERCENTILES_LONG      "latpercent"
 #define ARG_LIMITREAD_LONG               "limitread"
+#define ARG_LIMITREADIOPS_LONG           "limitreadiops"
+#define ARG_LIMITREFILL_LONG             "limitrefill"
+#define ARG_LIMITSCOPE_LONG              "limitscope"
+#define ARG_LIMITSPIN_LONG               "limitspin"
 #define ARG_LIMITWRITE_LONG              "limitwrite"
+#define ARG_LIMITWRITEIOPS_LONG          "limitwriteiops"
+#define ARG_LIVEBINFILE_LONG             "livebin"
+#define ARG_LIVEBINTOJSON_LONG           "livebin2json"
 #define ARG_LIVEINTERVAL_LONG            "liveint"
 #define ARG_LIVESTATSNEWLINE_LONG        "live1n"
 #define ARG_LOGLEVEL_LONG                "log"
@@ -123,10 +145,17 @@ namespace bpt = boost::property_tree;
 #define ARG_NUMNETBENCHSERVERS_LONG      "numservers"
 #define ARG_NUMTHREADS_LONG              "threads"
 #define ARG_NUMTHREADS_SHORT             "t"
+#define ARG_OPENLOOP_LONG                "openloop"
+#define ARG_OPENLOOPDIST_LONG            "openloopdist"
+#define ARG_OPSLOGBINARY_LONG            "opslogbin"
 #define ARG_OPSLOGLOCKING_LONG           "opsloglock"
 #define ARG_OPSLOGPATH_LONG              "opslog"
+#define ARG_OPSLOGSAMPLE_LONG            "opslogsample"
+#define ARG_OPSLOGTOJSON_LONG            "opslog2json"
 #define ARG_PHASEDELAYTIME_LONG          "phasedelay"
 #define ARG_PREALLOCFILE_LONG            "preallocfile"
+#define ARG_PRECONDFILLS_LONG            "precond"
+#define ARG_PRECONDSOAKSECS_LONG         "precondsoak"
 #define ARG_QUIT_LONG                    "quit"
 #define ARG_RANDOMAMOUNT_LONG            "randamount"
 #define ARG_RANDOMOFFSETS_LONG           "rand"
@@ -136,6 +165,9 @@ namespace bpt = boost::property_tree;
 #define ARG_READ_SHORT                   "r"
 #define ARG_READINLINE_LONG              "readinline"
 #define ARG_RECVBUFSIZE_LONG             "recvbuf"
+#define ARG_REPLAY_LONG                  "replay"
+#define ARG_REPLAYROOT_LONG              "replayroot"
+#define ARG_REPLAYSPEED_LONG             "replayspeed"
 #define ARG_RESPSIZE_LONG                "respsize"
 #define ARG_RESULTSFILE_LONG             "resfile"
 #define ARG_REVERSESEQOFFSETS_LONG       "backward"
@@ -204,6 +236,15 @@ namespace bpt = boost::property_tree;
 #define ARG_SERVICEPORT_LONG             "port"
 #define ARG_SHOWALLELAPSED_LONG          "allelapsed"
 #define ARG_SHOWSVCELAPSED_LONG          "svcelapsed"
+#define ARG_SLOLAT_LONG                  "slolat"
+#define ARG_SLOPERCENTILE_LONG           "slopct"
+#define ARG_SLOSEARCH_LONG               "slosearch"
+#define ARG_SLOSTEPS_LONG                "slosteps"
+#define ARG_SLOWOPS_LONG                 "slowops"
+#define ARG_STABILITY_LONG               "stability"
+#define ARG_STABILITYDIP_LONG            "stabilitydip"
+#define ARG_STEADYSTATEROUND_LONG        "ssround"
+#define ARG_STEADYSTATEWINDOW_LONG       "sswindow"
 #define ARG_STARTTIME_LONG               "start"
 #define ARG_STATFILES_LONG               "stat"
 #define ARG_STATFILESINLINE_LONG         "statinline"
@@ -212,8 +253,15 @@ namespace bpt = boost::property_tree;
 #define ARG_SVCSHOWPING_LONG             "svcping"
 #define ARG_SVCUPDATEINTERVAL_LONG       "svcupint"
 #define ARG_SVCREADYWAITSECS_LONG        "svcwait"
+#define ARG_SWEEPBLOCK_LONG              "sweepblock"
+#define ARG_SWEEPIODEPTH_LONG            "sweepiodepth"
+#define ARG_SWEEPPLATEAU_LONG            "sweepplateau"
+#define ARG_SWEEPSIZE_LONG               "sweepsize"
+#define ARG_SWEEPTHREADS_LONG            "sweepthreads"
 #define ARG_SYNCPHASE_LONG               "sync"
 #define ARG_TIMELIMITSECS_LONG           "timelimit"
+#define ARG_TRACEFILE_LONG               "tracefile"
+#define ARG_TRACESAMPLE_LONG             "tracesample"
 #define ARG_TREEFILE_LONG                "treefile"
 #define ARG_TREERANDOMIZE_LONG           "treerand"
 #define ARG_TREEROUNDROBIN_LONG          "treeroundrob"
@@ -223,6 +271,7 @@ namespace bpt = boost::property_tree;
 #define ARG_TRUNCTOSIZE_LONG             "trunctosize"
 #define ARG_VERIFYDIRECT_LONG            "verifydirect"
 #define ARG_VERSION_LONG                 "version"
+#define ARG_WARMUPSECS_LONG              "warmup"
 
 
 #define ARGDEFAULT_SERVICEPORT              1611
@@ -233,6 +282,7 @@ namespace bpt = boost::property_tree;
                                                 SystemTk::getUsername() + "_" + \
                                                 "p" + std::to_string(servicePort) )
 #define SERVICE_UPLOAD_TREEFILE                 "treefile.txt"
+#define SERVICE_UPLOAD_REPLAYFILE               "replayfile.opslog"
 #define S3_IMPLICIT_TREEFILE_PATH               (ELBENCHO_VAR_TMP + "/" + EXE_NAME "_" + \
                                                 SystemTk::getUsername() + "_" + \
                                                 "treefile_implicit.txt")
@@ -242,6 +292,10 @@ namespace bpt = boost::property_tree;
                                                 "mpufile_implicit.txt")
 
 
+// parameter sweep value lists
+#define SWEEPLIST_DELIMITERS                ", \n\r" // delimiters for sweep value lists
+#define SWEEPLIST_RANGE_SEPARATOR           ':' // "min:max" expands to doubling steps
+
 // flags for fadvise
 #define FADVISELIST_DELIMITERS              ", \n\r" // delimiters for fadvise args string
 
@@ -280,6 +334,35 @@ namespace bpt = boost::property_tree;
 #define ARG_FLOCK_FULL                      2
 #define ARG_FLOCK_FULL_NAME                 "full" // lock entire file instead of only a range
 
+// values for dedupe scope
+#define ARG_DEDUPESCOPE_THREAD              0
+#define ARG_DEDUPESCOPE_THREAD_NAME         "thread" // dups of own blocks of each worker thread
+#define ARG_DEDUPESCOPE_HOST                1
+#define ARG_DEDUPESCOPE_HOST_NAME           "host" // dups of blocks of any thread on same host
+#define ARG_DEDUPESCOPE_GLOBAL              2
+#define ARG_DEDUPESCOPE_GLOBAL_NAME         "global" // dups of blocks of any thread on any host
+
+// values for rate limit scope
+#define ARG_LIMITSCOPE_THREAD               0
+#define ARG_LIMITSCOPE_THREAD_NAME          "thread" // separate limit for each worker thread
+#define ARG_LIMITSCOPE_HOST                 1
+#define ARG_LIMITSCOPE_HOST_NAME            "host" // shared by all threads of the same host
+#define ARG_LIMITSCOPE_GLOBAL               2
+#define ARG_LIMITSCOPE_GLOBAL_NAME          "global" // shared by all threads on all hosts
+
+// values for open-loop arrival distribution
+#define ARG_OPENLOOPDIST_FIXED              0
+#define ARG_OPENLOOPDIST_FIXED_NAME         "fixed" // same interval between all ops
+#define ARG_OPENLOOPDIST_POISSON            1
+#define ARG_OPENLOOPDIST_POISSON_NAME       "poisson" // exponentially distributed intervals
+
+// values for latency SLO capacity search type
+#define ARG_SLOSEARCH_RATE                  0
+#define ARG_SLOSEARCH_RATE_NAME             "rate" // search over total IOPS limit
+#define ARG_SLOSEARCH_IODEPTH               1
+#define ARG_SLOSEARCH_IODEPTH_NAME          "iodepth" // search over IO depth per thread
+#define SLOSEARCH_RESOLUTION_PCT            5 // rate search stops when limit range is this narrow
+
 /* permission flags for S3 ACLs.
     note: std::string::find() will be used with these, so make sure each name is unambiguous and not
     a substring of another name. */
@@ -329,6 +412,8 @@ class ProgArgs
         bool hasUserRequestedHelp();
         void printHelp();
         bool hasUserRequestedVersion();
+        bool hasUserRequestedLiveBinConversion();
+        bool hasUserRequestedOpsLogConversion();
         bool hasUserRequestedDryRun();
         void printVersionAndBuildInfo();
         void printDryRunInfo();
@@ -350,6 +435,7 @@ class ProgArgs
         char** argv; // command line arg vector (as in main(argc, argv) )
 
         CustomTree customTree; // file and dir paths for custom tree mode
+        ReplayOpStore replayOps; // ops of ops log for replay phase
 
         std::string progPath; // absolute path to program binary
         std::string benchPathStr; // benchmark path(s), separated by BENCHPATH_DELIMITER
@@ -383,11 +469,21 @@ class ProgArgs
         std::string blockSizeOrigStr; // original blockSize str from user with unit
         unsigned blockVariancePercent; // % of blocks that should differ between writes
         std::string blockVarianceAlgo; // rand algo for buffer fill variance
+        size_t blockVarPoolSize; // number of pre-generated random write blocks per worker (0=off)
         std::string clientsFilePath; // path to file for appended service hosts
         std::string clientsStr; // appended to hostsStr in netbench mode
+        double compressRatio; // target compression ratio for written data (0 for random data)
         std::string configFilePath; // Configuration input using a config file (empty for none)
         std::string cpuCoresStr; // comma-separated cpu cores that this process may run on
         IntVec cpuCoresVec; // list from cpuCoresStr broken down into individual elements
+        size_t dedupeChunkSize; // granularity of duplicate data for dedupePercent
+        std::string dedupeChunkSizeOrigStr; // original dedupeChunkSize str from user with unit
+        size_t dedupeNumRanks; // total number of data ranks on all hosts for global dedupe scope
+        unsigned dedupePercent; // percentage of written chunks that duplicate earlier chunks
+        size_t dedupeRankOffset; // data rank offset of this host for dedupe (hosts with own seq)
+        unsigned short dedupeScope; // internal dedupe scope type (ARG_DEDUPESCOPE_x)
+        std::string dedupeScopeOrigStr; // dedupe scope on command line (ARG_DEDUPESCOPE_x_NAME)
+        uint64_t dedupeSeed; // seed for reproducible dedupe data
         bool disableLiveStats; // disable live stats
         bool disablePathBracketsExpansion; // true to disable square brackets expansion for paths
         bool doDirectVerify; // verify data integrity by reading immediately after write
@@ -429,15 +525,24 @@ class ProgArgs
         bool ignoreDelErrors; // ignore ENOENT errors on file/dir deletion
         bool ignoreS3Errors; // ignore S3 get/put errors, useful for stress-testing
         bool ignoreS3PartNum; // don't check for >10K parts in multi-part uploads
+        size_t ioBatchMin; // min number of async IO completions to reap before resubmitting
         size_t ioDepth; // depth of io queue per thread for libaio
         uint64_t integrityCheckSalt; // salt to add to data integrity checksum (0 disables check)
         bool interruptServices; // send interrupt msg to given hosts to stop current phase
         size_t iterations; // Number of iterations of the same benchmark
+        unsigned short latencyHistoDigits; // significant digits of HDR latency histogram
         unsigned short logLevel; // filter level for log messages (higher will not be logged)
-        uint64_t limitReadBps; // read limit per thread in bytes per sec
+        uint64_t limitReadBps; // read limit per thread/host/global in bytes per sec
         std::string limitReadBpsOrigStr; // original limitReadBps str from user with unit
-        uint64_t limitWriteBps; // write limit per thread in bytes per sec
+        uint64_t limitWriteBps; // write limit per thread/host/global in bytes per sec
         std::string limitWriteBpsOrigStr; // original limitWriteBps str from user with unit
+        uint64_t limitReadIOPS; // read limit per thread/host/global in IOs per sec
+        uint64_t limitWriteIOPS; // write limit per thread/host/global in IOs per sec
+        uint64_t limitRefillUSec; // refill interval of rate limiter token buckets in microsecs
+        unsigned short limitScope; // internal rate limit scope type (ARG_LIMITSCOPE_x)
+        std::string limitScopeOrigStr; // rate limit scope on command line (ARG_LIMITSCOPE_x_NAME)
+        std::string liveBinFilePath; // live stats file path for binary time-series (or empty)
+        std::string liveBinToJSONPath; // binary time-series file to convert to json and exit
         std::string liveCSVFilePath; // live stats file path for csv format (or empty for none)
         std::string liveJSONFilePath; // live stats file path for json format (or empty for none)
         size_t liveStatsSleepMS; // interval between live stats console/csv updates
@@ -467,13 +572,24 @@ class ProgArgs
         unsigned short numLatencyPercentile9s; // decimal 9s to show (0=99%, 1=99.9%, 2=99.99%, ...)
         unsigned numNetBenchServers; // number of servers in service hosts list for netbench mode
         size_t numRWMixReadThreads; // number of rwmix read threads in file/bdev write phase
+        size_t numSlowOps; // number of slowest ops to show in phase results (0 to disable)
         size_t numThreads; // parallel I/O worker threads per instance
+        uint64_t openLoopOpsPerSec; // open-loop target ops per sec per worker (0 for closed loop)
+        unsigned short openLoopDist; // internal open-loop arrival dist type (ARG_OPENLOOPDIST_x)
+        std::string openLoopDistOrigStr; // open-loop arrival dist on cmd line (ARG_OPENLOOPDIST_x_NAME)
         std::string opsLogPath; // path to operations log file (empty to disable)
+        size_t opsLogSampleN; // log only 1 in N ops to binary ops log
+        std::string opsLogToJSONPath; // binary ops log file to convert to json and exit
+        unsigned precondNumFills; // number of sequential fill passes for preconditioning
+        size_t precondSoakSecs; // max random write soak time for preconditioning (0 to disable)
         bool quitServices; // send quit (via interrupt msg) to given hosts to exit service
         uint64_t randomAmount; // random bytes to read/write per file (when randomOffsets is used)
         std::string randomAmountOrigStr; // original randomAmount str from user with unit
         std::string randOffsetAlgo; // rand algo for random offsets
         size_t rankOffset; // offset for worker rank numbers
+        std::string replayFilePath; // ops log file to replay (or empty for no replay phase)
+        std::string replayRoot; // recorded path prefix to replace by bench path for replay
+        double replaySpeed; // replay time scale factor; 0 means as fast as possible
         std::string resFilePathCSV; // phase results file path for csv format (or empty for none)
         std::string resFilePathJSON; // phase results file path for json format (or empty for none)
         std::string resFilePathTXT; // results output file path (or empty for no results file)
@@ -533,11 +649,21 @@ class ProgArgs
         bool showAllElapsed; // print elapsed time of each I/O worker thread
         bool showCPUUtilization; // show cpu utilization in phase stats results
         bool showDirStats; // show processed dirs stats in file write/read phase of dir mode
+        bool showFileLatBreakdown; // show latency of open/stat/1st byte/xfer/close in dir mode
         bool showLatency; // show min/avg/max latency
         bool showLatencyHistogram; // show latency histogram
         bool showLatencyPercentiles; // show latency percentiles
         bool showServicesElapsed; // print elapsed time of each service by slowest thread
         bool showThroughputBase10; // show throughput in base10 instead base2 (MB/s instead MiB/s)
+        bool showThroughputStability; // show throughput stability metrics in phase results
+        uint64_t sloLatUSec; // latency SLO target in usec for capacity search (0 to disable)
+        double sloPercentile; // latency percentile which must stay below sloLatUSec
+        unsigned short sloSearchType; // internal SLO search type (ARG_SLOSEARCH_x)
+        std::string sloSearchTypeOrigStr; // SLO search type on cmd line (ARG_SLOSEARCH_x_NAME)
+        size_t sloSearchMaxSteps; // max number of phases to run for SLO capacity search
+        unsigned stabilityDipPercent; // throughput below this % of mean counts as stability dip
+        size_t steadyStateRoundSecs; // duration of a steady state detection round in seconds
+        size_t steadyStateWindowRounds; // number of rounds in steady state measurement window
         int sockRecvBufSize; // custom netbench socket recv buf size (0 means no change)
         int sockSendBufSize; // custom netbench socket send buf size (0 means no change)
         std::string sockRecvBufSizeOrigStr; // original sockRecvBufSize str from user with unit
@@ -549,6 +675,17 @@ class ProgArgs
         size_t svcReadyWaitSec; // startup wait time for services to be ready in seconds
         bool svcShowPing; // show service response time in fullscreen live stats
         size_t svcUpdateIntervalMS; // update retrieval interval for service hosts in milliseconds
+        std::string sweepBlockSizesStr; // block size list for parameter sweep (empty for no sweep)
+        UInt64Vec sweepBlockSizesVec; // parsed sweepBlockSizesStr or just blockSize if empty
+        std::string sweepFileSizesStr; // file size list for parameter sweep (empty for no sweep)
+        UInt64Vec sweepFileSizesVec; // parsed sweepFileSizesStr or just fileSize if empty
+        std::string sweepIODepthsStr; // IO depth list for parameter sweep (empty for no sweep)
+        UInt64Vec sweepIODepthsVec; // parsed sweepIODepthsStr or just ioDepth if empty
+        std::string sweepNumThreadsStr; // thread count list for param sweep (empty for no sweep)
+        UInt64Vec sweepNumThreadsVec; // parsed sweepNumThreadsStr or just numThreads if empty
+        unsigned sweepPlateauPercent; // min throughput gain % to continue sweep (0 to disable)
+        std::string traceFilePath; // path to Chrome trace event file of ops (empty to disable)
+        size_t traceSampleN; // trace only 1 in N ops to traceFilePath
         std::string treeFilePath; // path to file containing custom tree (list of dirs and files)
         uint64_t treeRoundUpSize; /* in treefile, round up file sizes to multiple of given size.
             (useful for directIO with its alignment reqs on some file systems. 0 disables this.) */
@@ -569,9 +706,14 @@ class ProgArgs
         bool useExtendedLiveJSON; // false for total/aggregate results only, true for per-worker
         bool useGDSBufReg; // register GPU buffers for GPUDirect Storage (GDS) when using cuFile API
         bool useHDFS; // use Hadoop HDFS
+        bool useIOUring; // use io_uring instead of libaio for block-sized read/write
+        bool useIOUringIOPoll; // busy-poll for io_uring completions (IORING_SETUP_IOPOLL)
+        bool useIOUringSQPoll; // kernel thread polls io_uring submissions (IORING_SETUP_SQPOLL)
+        bool useLimitSpin; // busy-wait for last part of rate limiter waits for precise pacing
         bool useMmap; // use memory mapped IO
         bool useNetBench; // run network benchmarking
         bool useNoFDSharing; // when true, each worker does its own file open in file/bdev mode
+        bool useOpsLogBinary; // write opsLogPath in binary format through background thread
         bool useOpsLogLocking; // use file locking to sync opsLogPath writes
         bool useRandomUnaligned; // don't use block-aligned offsets for random IO
         bool useRandomOffsets; // use random offsets for file reads/writes
@@ -586,6 +728,7 @@ class ProgArgs
         bool useS3SSE; // use SSE-S3 encryption method for S3
         bool useS3VirtualAddressing; // true to use virtual addressing for S3
         bool useStridedAccess; // use strided file access pattern for shared files
+        size_t warmupSecs; // secs at phase start to exclude from phase results (0 to disable)
         std::string s3ChecksumAlgoStr;  /* Stores the S3 checksum algorithm value (e.g. "CRC32",
                                             "CRC32C", "SHA1", "SHA256") */
 
@@ -614,8 +757,11 @@ class ProgArgs
         void parseRandAlgos();
         void parseS3Endpoints();
         void parseNetDevs();
+        void parseSweepLists();
+        void parseSweepList(std::string listStr, std::string argName, UInt64Vec& outVec);
         void scanCustomTree();
         void loadCustomTreeFile();
+        void loadReplayFile();
         void loadServicePasswordFile();
         void precreateS3MpuSharingUploadIDs();
         std::string absolutePath(std::string pathStr);
@@ -677,10 +823,18 @@ class ProgArgs
         BenchMode getBenchMode() const { return benchMode; }
         unsigned getBlockVariancePercent() const { return blockVariancePercent; }
         std::string getBlockVarianceAlgo() const { return blockVarianceAlgo; }
+        size_t getBlockVarPoolSize() const { return blockVarPoolSize; }
         size_t getBlockSize() const { return blockSize; }
         std::string getBenchLabel() const { return benchLabel; }
         const std::string& getBenchLabelNoCommas() const { return benchLabelNoCommas; }
         CuFileHandleDataVec& getCuFileHandleDataVec() { return cuFileHandleDataVec; }
+        double getCompressRatio() const { return compressRatio; }
+        size_t getDedupeChunkSize() const { return dedupeChunkSize; }
+        size_t getDedupeNumRanks() const { return dedupeNumRanks; }
+        unsigned getDedupePercent() const { return dedupePercent; }
+        size_t getDedupeRankOffset() const { return dedupeRankOffset; }
+        unsigned short getDedupeScope() const { return dedupeScope; }
+        uint64_t getDedupeSeed() const { return dedupeSeed; }
         std::string getConfigFilePath() const { return configFilePath; }
         const IntVec& getCPUCoresVec() const { return cpuCoresVec; }
         std::string getCPUCoresStr() const { return cpuCoresStr; }
@@ -726,12 +880,20 @@ class ProgArgs
         bool getIgnoreS3Errors() const { return ignoreS3Errors; }
         bool getIgnoreS3PartNum() const { return ignoreS3PartNum; }
         uint64_t getIntegrityCheckSalt() const { return integrityCheckSalt; }
+        size_t getIOBatchMin() const { return ioBatchMin; }
         size_t getIODepth() const { return ioDepth; }
         bool getInterruptServices() const { return interruptServices; }
         bool getIsServicePathShared() const { return !noSharedServicePath; }
         size_t getIterations() const { return iterations; }
+        unsigned short getLatencyHistoDigits() const { return latencyHistoDigits; }
         uint64_t getLimitReadBps() const { return limitReadBps; }
         uint64_t getLimitWriteBps() const { return limitWriteBps; }
+        uint64_t getLimitReadIOPS() const { return limitReadIOPS; }
+        uint64_t getLimitWriteIOPS() const { return limitWriteIOPS; }
+        uint64_t getLimitRefillUSec() const { return limitRefillUSec; }
+        unsigned short getLimitScope() const { return limitScope; }
+        std::string getLiveBinFilePath() const { return liveBinFilePath; }
+        std::string getLiveBinToJSONPath() const { return liveBinToJSONPath; }
         std::string getLiveCSVFilePath() const { return liveCSVFilePath; }
         std::string getLiveJSONFilePath() const { return liveJSONFilePath; }
         size_t getLiveStatsSleepMS() const { return liveStatsSleepMS; }
@@ -749,17 +911,28 @@ class ProgArgs
         unsigned getNumLatencyPercentile9s() const { return numLatencyPercentile9s; }
         unsigned getNumNetBenchServers() const { return numNetBenchServers; }
         size_t getNumRWMixReadThreads() const { return numRWMixReadThreads; }
+        size_t getNumSlowOps() const { return numSlowOps; }
         size_t getNumThreads() const { return numThreads; }
         std::string getNetDevsStr() const { return netDevsStr; }
         const StringVec& getNetDevsVec() const { return netDevsVec; }
         size_t getNetBenchRespSize() const { return netBenchRespSize; }
         bool getNoDirectIOCheck() const { return noDirectIOCheck; }
         bool getPrintCSVLabels() const { return !noCSVLabels; }
+        uint64_t getOpenLoopOpsPerSec() const { return openLoopOpsPerSec; }
+        unsigned short getOpenLoopDist() const { return openLoopDist; }
         std::string getOpsLogPath() const { return opsLogPath; }
+        size_t getOpsLogSampleN() const { return opsLogSampleN; }
+        std::string getOpsLogToJSONPath() const { return opsLogToJSONPath; }
+        unsigned getPrecondNumFills() const { return precondNumFills; }
+        size_t getPrecondSoakSecs() const { return precondSoakSecs; }
         bool getQuitServices() const { return quitServices; }
         std::string getRandOffsetAlgo() const { return randOffsetAlgo; }
         uint64_t getRandomAmount() const { return randomAmount; }
         size_t getRankOffset() const { return rankOffset; }
+        const ReplayOpStore& getReplayOps() const { return replayOps; }
+        std::string getReplayFilePath() const { return replayFilePath; }
+        std::string getReplayRoot() const { return replayRoot; }
+        double getReplaySpeed() const { return replaySpeed; }
         std::string getResFilePathCSV() const { return resFilePathCSV; }
         std::string getResFilePathJSON() const { return resFilePathJSON; }
         std::string getResFilePathTXT() const { return resFilePathTXT; }
@@ -775,6 +948,7 @@ class ProgArgs
         bool getRunListObjPhase() const { return (runS3ListObjNum > 0); }
         bool getRunMultiDelObjPhase() const { return (runS3MultiDelObjNum > 0); }
         bool getRunReadPhase() const { return runReadPhase; }
+        bool getRunReplayPhase() const { return !replayFilePath.empty(); }
         bool getRunS3AclPut() const { return runS3AclPut; }
         bool getRunS3AclGet() const { return runS3AclGet; }
         bool getRunS3BucketAclPut() const { return runS3BucketAclPut; }
@@ -816,11 +990,20 @@ class ProgArgs
         bool getShowAllElapsed() const { return showAllElapsed; }
         bool getShowCPUUtilization() const { return showCPUUtilization; }
         bool getShowDirStats() const { return showDirStats; }
+        bool getShowFileLatBreakdown() const { return showFileLatBreakdown; }
         bool getShowLatency() const { return showLatency; }
         bool getShowLatencyHistogram() const { return showLatencyHistogram; }
         bool getShowLatencyPercentiles() const { return showLatencyPercentiles; }
         bool getShowServicesElapsed() const { return showServicesElapsed; }
         bool getShowThroughputBase10() const { return showThroughputBase10; }
+        bool getShowThroughputStability() const { return showThroughputStability; }
+        uint64_t getSLOLatUSec() const { return sloLatUSec; }
+        double getSLOPercentile() const { return sloPercentile; }
+        unsigned short getSLOSearchType() const { return sloSearchType; }
+        size_t getSLOSearchMaxSteps() const { return sloSearchMaxSteps; }
+        unsigned getStabilityDipPercent() const { return stabilityDipPercent; }
+        size_t getSteadyStateRoundSecs() const { return steadyStateRoundSecs; }
+        size_t getSteadyStateWindowRounds() const { return steadyStateWindowRounds; }
         int getSockRecvBufSize() const { return sockRecvBufSize; }
         int getSockSendBufSize() const { return sockSendBufSize; }
         std::string getSvcPasswordFile() const { return svcPasswordFile; }
@@ -828,6 +1011,14 @@ class ProgArgs
         size_t getSvcReadyWaitSec() const { return svcReadyWaitSec; }
         bool getSvcShowPing() const { return svcShowPing; }
         size_t getSvcUpdateIntervalMS() const { return svcUpdateIntervalMS; }
+        const UInt64Vec& getSweepBlockSizesVec() const { return sweepBlockSizesVec; }
+        const UInt64Vec& getSweepFileSizesVec() const { return sweepFileSizesVec; }
+        const UInt64Vec& getSweepIODepthsVec() const { return sweepIODepthsVec; }
+        const UInt64Vec& getSweepNumThreadsVec() const { return sweepNumThreadsVec; }
+        unsigned getSweepPlateauPercent() const { return sweepPlateauPercent; }
+        bool getIsSweep() const { return !sweepBlockSizesStr.empty() ||
+            !sweepFileSizesStr.empty() || !sweepIODepthsStr.empty() ||
+            !sweepNumThreadsStr.empty(); }
         time_t getStartTime() const { return startTime; }
         int getStdoutDupFD() const { return stdoutDupFD; }
         std::string getTreeScanPath() const { return treeScanPath; }
@@ -843,8 +1034,13 @@ class ProgArgs
         bool getUseExtendedLiveCSV() const { return useExtendedLiveCSV; }
         bool getUseExtendedLiveJSON() const { return useExtendedLiveJSON; }
         bool getUseGPUBufReg() const { return useGDSBufReg; }
+        bool getUseIOUring() const { return useIOUring; }
+        bool getUseIOUringIOPoll() const { return useIOUringIOPoll; }
+        bool getUseIOUringSQPoll() const { return useIOUringSQPoll; }
+        bool getUseLimitSpin() const { return useLimitSpin; }
         bool getUseMmap() const { return useMmap; }
         bool getUseNoFDSharing() const { return useNoFDSharing; }
+        bool getUseOpsLogBinary() const { return useOpsLogBinary; }
         bool getUseOpsLogLocking() const { return useOpsLogLocking; }
         bool getUseRandomUnaligned() const { return useRandomUnaligned; }
         bool getUseRandomOffsets() const { return useRandomOffsets; }
@@ -857,6 +1053,9 @@ class ProgArgs
         bool getUseS3VirtualAddressing() const { return useS3VirtualAddressing; }
         bool getUseStridedAccess() const { return useStridedAccess; }
         size_t getTimeLimitSecs() const { return timeLimitSecs; }
+        size_t getWarmupSecs() const { return warmupSecs; }
+        std::string getTraceFilePath() const { return traceFilePath; }
+        size_t getTraceSampleN() const { return traceSampleN; }
         std::string getTreeFilePath() const { return treeFilePath; }
         uint64_t getTreeRoundUpSize() const { return treeRoundUpSize; }
         bool hasUserSetRWMixPercent() const { return useRWMixPercent; }
@@ -866,6 +1065,13 @@ class ProgArgs
         // setters for config options in alphabetic order...
 
         void setIgnoreDelErrors(bool ignoreDelErrors) { this->ignoreDelErrors = ignoreDelErrors; }
+        void setIODepth(size_t ioDepth) { this->ioDepth = ioDepth; }
+        void setLimitReadIOPS(uint64_t limitReadIOPS) { this->limitReadIOPS = limitReadIOPS; }
+        void setLimitScope(unsigned short limitScope) { this->limitScope = limitScope; }
+        void setLimitWriteIOPS(uint64_t limitWriteIOPS) { this->limitWriteIOPS = limitWriteIOPS; }
+        void setSweepValues(size_t numThreads, size_t ioDepth, uint64_t blockSize,
+            uint64_t fileSize);
+        void setIOPatternValues(bool useRandomOffsets, bool doInfiniteIOLoop);
         void setTimeLimitSecs(size_t timeLimitSecs) { this->timeLimitSecs = timeLimitSecs; }
 };
 
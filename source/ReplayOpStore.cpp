@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include "ReplayOpStore.h"
+#include "toolkits/OpsLogger.h"
+
+
+/**
+ * Load ops from an ops log file in JSON or binary format. Only the pre-op records of the log are
+ * used, so the recorded start time of each op defines the replay order. Ops that cannot be
+ * replayed (e.g. bucket ops or multipart uploads) or that don't match the bench mode (e.g. file
+ * ops in S3 mode) are skipped and counted in numSkippedOps.
+ *
+ * File descriptor numbers of data ops get resolved to paths per recorded worker: An fd gets bound
+ * to the oldest preceding open of the same worker that has not been bound yet. FDs without such
+ * an open (e.g. the shared FDs of file/blockdev mode, which get opened before the ops log starts)
+ * get assigned to the given bench paths in order of first appearance. Opens that failed in the
+ * recorded run are not replayed. Opens of which the fd was used for writes are marked as creating
+ * opens, because elbencho only sets O_CREAT when it opens files for writing; all other opens
+ * expect the file to exist on replay.
+ *
+ * @path path to ops log file.
+ * @replayRoot recorded path prefix to be replaced by benchPaths[0]; empty to use recorded paths
+ * 	unmodified. For S3, this can be a bucket name.
+ * @benchPaths current bench paths.
+ * @benchMode current bench mode; only S3 ops get replayed in S3 mode, only file ops otherwise.
+ * @throw ProgException on error, such as file not exists or invalid file format.
+ */
+void ReplayOpStore::loadOpsFromFile(const std::string& path, const std::string& replayRoot,
+	const StringVec& benchPaths, BenchMode benchMode)
+{
+	static const std::unordered_map<std::string, ReplayOpType> opTypeMap =
+	{
+		{"open", ReplayOp_OPEN},
+		{"openat", ReplayOp_OPEN},
+		{"close", ReplayOp_CLOSE},
+		{"pread", ReplayOp_READ},
+		{"aioread", ReplayOp_READ},
+		{"uringread", ReplayOp_READ},
+		{"cuFileRead", ReplayOp_READ},
+		{"hdfsPread", ReplayOp_READ},
+		{"pwrite", ReplayOp_WRITE},
+		{"aiowrite", ReplayOp_WRITE},
+		{"uringwrite", ReplayOp_WRITE},
+		{"cuFileWrite", ReplayOp_WRITE},
+		{"hdfsWrite", ReplayOp_WRITE},
+		{"mkdirat", ReplayOp_MKDIR},
+		{"unlinkat", ReplayOp_UNLINK},
+		{"fstat", ReplayOp_STAT},
+		{"S3GetObject", ReplayOp_S3GET},
+		{"S3GetObjectAsync", ReplayOp_S3GET},
+		{"S3PutObject", ReplayOp_S3PUT},
+		{"S3HeadObject", ReplayOp_S3HEAD},
+		{"S3DeleteObject", ReplayOp_S3DELETE},
+	};
+
+	// per recorded worker state to resolve file descriptors to paths
+	struct RecordedWorker
+	{
+		std::deque<size_t> pendingOpens; // ops index of opens that are not bound to an fd yet
+		std::unordered_map<std::string, size_t> fdMap; // key is fd str, value is ops index of open
+	};
+
+	std::map<int64_t, RecordedWorker> recordedWorkerMap; // key is recorded worker rank
+	std::unordered_map<std::string, uint32_t> pathIdxMap; // key is path
+	std::unordered_map<std::string, uint32_t> unboundFDMap; // fds without open => bench paths
+	std::vector<bool> failedOpsVec; // true for ops index of opens that failed in recorded run
+	uint64_t firstTimestampNS = UINT64_MAX;
+
+	ops.clear();
+	pathsPtr = std::make_shared<StringVec>();
+	numEntryOps = 0;
+	numBytesTotal = 0;
+	numSkippedOps = 0;
+	writtenPathIdxSet.clear();
+
+	// get pathIdx for a path, adding it to the paths vec if it's new
+	std::function<uint32_t(const std::string&)> getPathIdx =
+		[&](const std::string& entryPath) -> uint32_t
+	{
+		std::string replayPath = entryPath;
+
+		if(!replayRoot.empty() && !benchPaths.empty() &&
+			!entryPath.compare(0, replayRoot.length(), replayRoot) )
+			replayPath = benchPaths[0] + entryPath.substr(replayRoot.length() );
+
+		auto insertRes = pathIdxMap.insert( {replayPath, pathsPtr->size()} );
+
+		if(insertRes.second)
+			pathsPtr->push_back(replayPath);
+
+		return insertRes.first->second;
+	};
+
+	OpsLogger::readLogFile(path, [&](const OpsLogEntry& entry)
+	{
+		auto opTypeIter = opTypeMap.find(entry.opName);
+
+		if( (opTypeIter == opTypeMap.end() ) ||
+			(isS3OpType(opTypeIter->second) != (benchMode == BenchMode_S3) ) )
+		{ // op type that we can't replay in this bench mode
+			if(!entry.isOpFinished)
+				numSkippedOps++;
+
+			return;
+		}
+
+		const ReplayOpType opType = opTypeIter->second;
+		RecordedWorker& recordedWorker = recordedWorkerMap[entry.workerRank];
+
+		if(entry.isOpFinished)
+		{ // post-op record: only relevant to drop failed opens, which get no fd
+			if( (opType != ReplayOp_OPEN) || !entry.isError)
+				return;
+
+			const uint32_t pathIdx = getPathIdx(entry.entryName);
+			auto pendingIter = std::find_if(recordedWorker.pendingOpens.begin(),
+				recordedWorker.pendingOpens.end(),
+				[&](size_t opIdx) { return ops[opIdx].pathIdx == pathIdx; } );
+
+			if(pendingIter != recordedWorker.pendingOpens.end() )
+			{
+				failedOpsVec[*pendingIter] = true;
+				recordedWorker.pendingOpens.erase(pendingIter);
+			}
+
+			return;
+		}
+
+		ReplayOp op;
+		op.timeNS = entry.timestampNS;
+		op.offset = entry.offset;
+		op.length = entry.length;
+		op.type = opType;
+		op.isCreate = false;
+
+		if( (opType == ReplayOp_READ) || (opType == ReplayOp_WRITE) ||
+			(opType == ReplayOp_CLOSE) )
+		{ // entry name is an fd => resolve to path
+			auto fdIter = recordedWorker.fdMap.find(entry.entryName);
+
+			if( (fdIter == recordedWorker.fdMap.end() ) && !recordedWorker.pendingOpens.empty() )
+			{
+				fdIter = recordedWorker.fdMap.insert(
+					{entry.entryName, recordedWorker.pendingOpens.front() } ).first;
+				recordedWorker.pendingOpens.pop_front();
+			}
+
+			if(fdIter != recordedWorker.fdMap.end() )
+			{
+				ReplayOp& openOp = ops[fdIter->second];
+
+				op.pathIdx = openOp.pathIdx;
+
+				if(opType == ReplayOp_WRITE)
+					openOp.isCreate = true;
+			}
+			else
+			if(opType == ReplayOp_CLOSE)
+			{ // close of an fd that we never saw in use => nothing to replay
+				numSkippedOps++;
+				return;
+			}
+			else
+			{ // fd without open (e.g. shared fd of file/blockdev mode) => assign a bench path
+				if(benchPaths.empty() )
+				{
+					numSkippedOps++;
+					return;
+				}
+
+				auto insertRes = unboundFDMap.insert( {entry.entryName,
+					getPathIdx(benchPaths[unboundFDMap.size() % benchPaths.size()] ) } );
+
+				op.pathIdx = insertRes.first->second;
+			}
+
+			if(opType == ReplayOp_CLOSE)
+				recordedWorker.fdMap.erase(entry.entryName);
+		}
+		else
+		{ // entry name is a path or "bucket/object"
+			op.pathIdx = getPathIdx(entry.entryName);
+
+			if(opType == ReplayOp_OPEN)
+				recordedWorker.pendingOpens.push_back(ops.size() );
+		}
+
+		firstTimestampNS = std::min(firstTimestampNS, entry.timestampNS);
+
+		ops.push_back(op);
+		failedOpsVec.push_back(false);
+	} );
+
+	/* drop failed opens, make times relative to first op and sort, as worker logs are not strictly
+		ordered in file */
+
+	ReplayOpVec loadedOpsVec;
+	loadedOpsVec.swap(ops);
+
+	for(size_t opIdx = 0; opIdx < loadedOpsVec.size(); opIdx++)
+	{
+		if(failedOpsVec[opIdx] )
+			continue;
+
+		loadedOpsVec[opIdx].timeNS -= firstTimestampNS;
+
+		addOp(loadedOpsVec[opIdx] );
+	}
+
+	std::stable_sort(ops.begin(), ops.end(),
+		[](const ReplayOp& a, const ReplayOp& b) { return a.timeNS < b.timeNS; } );
+}
+
+/**
+ * Get the ops of a single worker. Ops get assigned to workers based on their path, so that all
+ * ops on the same file (or object) are processed in recorded order by the same worker.
+ *
+ * @workerRank rank of the worker among all workers of all hosts.
+ * @numDataSetThreads number of workers among all hosts.
+ * @outStore will be filled with the ops of the given worker; shares paths with this store.
+ */
+void ReplayOpStore::getWorkerSublist(size_t workerRank, size_t numDataSetThreads,
+	ReplayOpStore& outStore) const
+{
+	std::hash<std::string> pathHasher;
+	std::vector<size_t> pathWorkerRankVec; // worker rank for each pathIdx
+
+	pathWorkerRankVec.reserve(pathsPtr->size() );
+
+	for(const std::string& path : *pathsPtr)
+		pathWorkerRankVec.push_back(pathHasher(path) % numDataSetThreads);
+
+	outStore.ops.clear();
+	outStore.pathsPtr = pathsPtr;
+	outStore.numEntryOps = 0;
+	outStore.numBytesTotal = 0;
+	outStore.numSkippedOps = 0;
+	outStore.writtenPathIdxSet.clear();
+
+	for(const ReplayOp& op : ops)
+	{
+		if(pathWorkerRankVec[op.pathIdx] == workerRank)
+			outStore.addOp(op);
+	}
+}
+
+/**
+ * Append op and update counters.
+ */
+void ReplayOpStore::addOp(const ReplayOp& op)
+{
+	ops.push_back(op);
+
+	if(isEntryOpType(op.type) )
+		numEntryOps++;
+
+	if(isDataOpType(op.type) )
+		numBytesTotal += op.length;
+
+	if(op.type == ReplayOp_WRITE)
+		writtenPathIdxSet.insert(op.pathIdx);
+}
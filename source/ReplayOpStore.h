@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef REPLAYOPSTORE_H_
+#define REPLAYOPSTORE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "Common.h"
+
+
+/**
+ * Types of ops that can be replayed. Recorded ops of the ops log get mapped to these, e.g. pread,
+ * aioread and uringread are all a ReplayOp_READ.
+ */
+enum ReplayOpType
+{
+	ReplayOp_OPEN = 0,
+	ReplayOp_CLOSE,
+	ReplayOp_READ,
+	ReplayOp_WRITE,
+	ReplayOp_MKDIR,
+	ReplayOp_UNLINK,
+	ReplayOp_STAT,
+	ReplayOp_S3GET,
+	ReplayOp_S3PUT,
+	ReplayOp_S3HEAD,
+	ReplayOp_S3DELETE,
+};
+
+/**
+ * Elements of ReplayOpStore.
+ */
+struct ReplayOp
+{
+	uint64_t timeNS; // recorded start time relative to the first op in the ops log
+	uint64_t offset;
+	uint64_t length;
+	uint32_t pathIdx; // index in ReplayOpStore paths
+	ReplayOpType type;
+	bool isCreate; // only for opens: recorded open was used for writes (elbencho sets O_CREAT)
+};
+
+typedef std::vector<ReplayOp> ReplayOpVec;
+typedef std::unordered_map<uint32_t, int> ReplayFDMap; // key is pathIdx, value is open fd
+
+
+/**
+ * Stores the ops of an ops log (as written by "--opslog") for replay, ordered by their recorded
+ * start time.
+ *
+ * Data ops in the ops log reference files by their file descriptor number. On load, each file
+ * descriptor gets mapped to the path of the preceding open of the same recorded worker, so that
+ * all ops refer to paths. Paths are shared between the full store and its worker sublists.
+ */
+class ReplayOpStore
+{
+	public:
+		void loadOpsFromFile(const std::string& path, const std::string& replayRoot,
+			const StringVec& benchPaths, BenchMode benchMode);
+
+		void getWorkerSublist(size_t workerRank, size_t numDataSetThreads,
+			ReplayOpStore& outStore) const;
+
+	private:
+		ReplayOpVec ops; // ordered by timeNS
+		std::shared_ptr<StringVec> pathsPtr{std::make_shared<StringVec>()}; // for pathIdx
+		size_t numEntryOps{0}; // number of ops that count as entries (open, mkdir, stat, ...)
+		uint64_t numBytesTotal{0}; // sum of lengths of read/write ops
+		size_t numSkippedOps{0}; // recorded ops that can't be replayed
+		std::unordered_set<uint32_t> writtenPathIdxSet; // pathIdx of paths with write ops
+
+		void addOp(const ReplayOp& op);
+
+		// inliners
+	public:
+		const ReplayOpVec& getOps() const { return ops; }
+		const std::string& getPath(uint32_t pathIdx) const { return (*pathsPtr)[pathIdx]; }
+		size_t getNumEntryOps() const { return numEntryOps; }
+		uint64_t getNumBytesTotal() const { return numBytesTotal; }
+		size_t getNumSkippedOps() const { return numSkippedOps; }
+		bool isEmpty() const { return ops.empty(); }
+
+		bool isPathWritten(uint32_t pathIdx) const
+			{ return writtenPathIdxSet.count(pathIdx); }
+
+		static bool isEntryOpType(ReplayOpType type)
+		{
+			return (type == ReplayOp_OPEN) || (type == ReplayOp_MKDIR) ||
+				(type == ReplayOp_UNLINK) || (type == ReplayOp_STAT) ||
+				(type == ReplayOp_S3HEAD) || (type == ReplayOp_S3DELETE);
+		}
+
+		static bool isS3OpType(ReplayOpType type)
+		{
+			return (type == ReplayOp_S3GET) || (type == ReplayOp_S3PUT) ||
+				(type == ReplayOp_S3HEAD) || (type == ReplayOp_S3DELETE);
+		}
+
+		static bool isDataOpType(ReplayOpType type)
+		{
+			return (type == ReplayOp_READ) || (type == ReplayOp_WRITE) ||
+				(type == ReplayOp_S3GET) || (type == ReplayOp_S3PUT);
+		}
+
+		static const char* opTypeToStr(ReplayOpType type)
+		{
+			static const char* const opTypeStrs[] = {"open", "close", "read", "write", "mkdir",
+				"unlink", "stat", "s3get", "s3put", "s3head", "s3delete"};
+
+			return opTypeStrs[type];
+		}
+};
+
+#endif /* REPLAYOPSTORE_H_ */
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include "Logger.h"
+#include "ResourceStats.h"
+
+#define PROC_STATUS_FILE			"/proc/self/status"
+#define PROC_CLEARREFS_FILE			"/proc/self/clear_refs"
+#define PROC_STATUS_PEAKRSS_KEY		"VmHWM:" // line prefix of peak RSS in PROC_STATUS_FILE
+#define PROC_CLEARREFS_PEAKRSS		"5" // value for PROC_CLEARREFS_FILE to reset peak RSS
+
+
+/**
+ * Remember the current usage of the calling thread as start of the phase. Also to be called at the
+ * end of the warmup period, so that the results only cover the time after warmup.
+ */
+void ResourceStats::startPhase()
+{
+	setToZero();
+
+	getThreadUsage(phaseStartUsage);
+}
+
+/**
+ * Set values to the difference between the current usage of the calling thread and the usage at
+ * startPhase(), and set peak RSS to the current peak of the process.
+ */
+void ResourceStats::endPhase()
+{
+	struct rusage phaseEndUsage{};
+
+	peakRSSKiB = getProcPeakRSSKiB();
+
+	if(!getThreadUsage(phaseEndUsage) )
+		return; // per-thread usage not supported on this platform
+
+	auto timevalToUSec = [](const struct timeval& tv) -> uint64_t
+		{ return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec; };
+
+	cpuUserUSec = timevalToUSec(phaseEndUsage.ru_utime) -
+		timevalToUSec(phaseStartUsage.ru_utime);
+	cpuSysUSec = timevalToUSec(phaseEndUsage.ru_stime) -
+		timevalToUSec(phaseStartUsage.ru_stime);
+	numVolCtxSwitches = phaseEndUsage.ru_nvcsw - phaseStartUsage.ru_nvcsw;
+	numInvolCtxSwitches = phaseEndUsage.ru_nivcsw - phaseStartUsage.ru_nivcsw;
+	numMinorFaults = phaseEndUsage.ru_minflt - phaseStartUsage.ru_minflt;
+	numMajorFaults = phaseEndUsage.ru_majflt - phaseStartUsage.ru_majflt;
+}
+
+/**
+ * Reset the peak RSS of this process to the current RSS, so that the peak RSS at the end of the
+ * phase only covers this phase. If this is not supported by the kernel, the peak RSS covers the
+ * whole lifetime of the process.
+ */
+void ResourceStats::resetProcPeakRSS()
+{
+	int fd = open(PROC_CLEARREFS_FILE, O_WRONLY);
+
+	if(fd == -1)
+		return; // e.g. macOS
+
+	ssize_t writeRes = write(fd, PROC_CLEARREFS_PEAKRSS, strlen(PROC_CLEARREFS_PEAKRSS) );
+
+	if(writeRes == -1)
+		LOGGER(Log_DEBUG, "Unable to reset peak RSS. "
+			"File: " PROC_CLEARREFS_FILE "; "
+			"SysErr: " << strerror(errno) << std::endl);
+
+	close(fd);
+}
+
+/**
+ * Get usage of the calling thread.
+ *
+ * @return false if per-thread usage is not supported on this platform.
+ */
+bool ResourceStats::getThreadUsage(struct rusage& outUsage)
+{
+	#ifdef RUSAGE_THREAD
+		return !getrusage(RUSAGE_THREAD, &outUsage);
+	#else
+		return false; // e.g. macOS
+	#endif // RUSAGE_THREAD
+}
+
+/**
+ * Get peak RSS of this process since start or since the last resetProcPeakRSS(). Falls back to
+ * the peak RSS of getrusage(), which can't be reset, if PROC_STATUS_FILE is not available.
+ */
+uint64_t ResourceStats::getProcPeakRSSKiB()
+{
+	std::ifstream procStatusStream(PROC_STATUS_FILE);
+	std::string lineStr;
+
+	while(std::getline(procStatusStream, lineStr) )
+	{
+		if(lineStr.rfind(PROC_STATUS_PEAKRSS_KEY, 0) == 0)
+			return std::stoull(lineStr.substr(strlen(PROC_STATUS_PEAKRSS_KEY) ) ); // "<n> kB"
+	}
+
+	struct rusage procUsage{};
+
+	if(getrusage(RUSAGE_SELF, &procUsage) )
+		return 0;
+
+	#if defined(__APPLE__)
+		return procUsage.ru_maxrss / 1024; // macOS reports bytes instead of KiB
+	#else
+		return procUsage.ru_maxrss;
+	#endif // apple
+}
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef RESOURCESTATS_H_
+#define RESOURCESTATS_H_
+
+#include <algorithm>
+#include <boost/property_tree/ptree.hpp>
+#include <sys/resource.h>
+#include "Common.h"
+
+namespace bpt = boost::property_tree;
+
+/**
+ * CPU time, context switches and page faults of a worker thread in the current phase (based on
+ * getrusage(RUSAGE_THREAD) ) and peak RSS of the process. Other than CPUUtil, which measures
+ * system-wide utilization, this tells how much CPU the benchmark itself needed for its I/O.
+ *
+ * startPhase() and endPhase() have to be called by the owning worker thread, because per-thread
+ * usage is only available for the calling thread. Values are only valid at the end of a phase.
+ */
+class ResourceStats
+{
+	public:
+		uint64_t cpuUserUSec{0}; // user mode CPU time
+		uint64_t cpuSysUSec{0}; // kernel mode CPU time
+		uint64_t numVolCtxSwitches{0}; // voluntary context switches (e.g. waiting for I/O)
+		uint64_t numInvolCtxSwitches{0}; // involuntary context switches (e.g. preemption)
+		uint64_t numMinorFaults{0}; // page faults without I/O
+		uint64_t numMajorFaults{0}; // page faults with I/O
+		uint64_t peakRSSKiB{0}; // peak resident set size of the process in the phase (max on sum)
+
+		void startPhase();
+		void endPhase();
+
+		static void resetProcPeakRSS();
+
+	private:
+		struct rusage phaseStartUsage{}; // thread usage at start of phase or end of warmup
+
+		static bool getThreadUsage(struct rusage& outUsage);
+		static uint64_t getProcPeakRSSKiB();
+
+		// inliners
+	public:
+		void setToZero()
+		{
+			cpuUserUSec = 0;
+			cpuSysUSec = 0;
+			numVolCtxSwitches = 0;
+			numInvolCtxSwitches = 0;
+			numMinorFaults = 0;
+			numMajorFaults = 0;
+			peakRSSKiB = 0;
+		}
+
+		uint64_t getCPUUSec() const { return cpuUserUSec + cpuSysUSec; }
+
+		/**
+		 * Note: peakRSSKiB is the max, as all workers of a process see the same value.
+		 */
+		ResourceStats& operator+=(const ResourceStats& rhs)
+		{
+			cpuUserUSec += rhs.cpuUserUSec;
+			cpuSysUSec += rhs.cpuSysUSec;
+			numVolCtxSwitches += rhs.numVolCtxSwitches;
+			numInvolCtxSwitches += rhs.numInvolCtxSwitches;
+			numMinorFaults += rhs.numMinorFaults;
+			numMajorFaults += rhs.numMajorFaults;
+			peakRSSKiB = std::max(peakRSSKiB, rhs.peakRSSKiB);
+
+			return *this;
+		}
+
+		void getAsPropertyTreeForService(bpt::ptree& outTree) const
+		{
+			outTree.put(XFER_STATS_RES_CPUUSERUSEC, cpuUserUSec);
+			outTree.put(XFER_STATS_RES_CPUSYSUSEC, cpuSysUSec);
+			outTree.put(XFER_STATS_RES_NUMVOLCTXSW, numVolCtxSwitches);
+			outTree.put(XFER_STATS_RES_NUMINVOLCTXSW, numInvolCtxSwitches);
+			outTree.put(XFER_STATS_RES_NUMMINORFAULTS, numMinorFaults);
+			outTree.put(XFER_STATS_RES_NUMMAJORFAULTS, numMajorFaults);
+			outTree.put(XFER_STATS_RES_PEAKRSSKIB, peakRSSKiB);
+		}
+
+		void setFromPropertyTreeForService(bpt::ptree& tree)
+		{
+			cpuUserUSec = tree.get<uint64_t>(XFER_STATS_RES_CPUUSERUSEC);
+			cpuSysUSec = tree.get<uint64_t>(XFER_STATS_RES_CPUSYSUSEC);
+			numVolCtxSwitches = tree.get<uint64_t>(XFER_STATS_RES_NUMVOLCTXSW);
+			numInvolCtxSwitches = tree.get<uint64_t>(XFER_STATS_RES_NUMINVOLCTXSW);
+			numMinorFaults = tree.get<uint64_t>(XFER_STATS_RES_NUMMINORFAULTS);
+			numMajorFaults = tree.get<uint64_t>(XFER_STATS_RES_NUMMAJORFAULTS);
+			peakRSSKiB = tree.get<uint64_t>(XFER_STATS_RES_PEAKRSSKIB);
+		}
+};
+
+#endif /* RESOURCESTATS_H_ */
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef SLOWOPSSTATS_H_
+#define SLOWOPSSTATS_H_
+
+#include <algorithm>
+#include <boost/property_tree/ptree.hpp>
+#include <string>
+#include <vector>
+#include "Common.h"
+
+namespace bpt = boost::property_tree;
+
+/**
+ * A single slow op with the information to find out where it came from.
+ */
+struct SlowOp
+{
+	uint64_t latencyNS;
+	uint64_t startUSec; // start time relative to phase start
+	uint64_t offset; // file offset of IO; start of file range for entry ops
+	uint64_t length; // bytes transferred (incl. all IOs for entry ops)
+	size_t workerRank;
+	std::string opName; // e.g. "read", "write" or the entry type of the phase, like "file"
+	std::string path; // file, dir or "bucket/object"
+	std::string host; // service that did the op; empty for local ops
+};
+
+typedef std::vector<SlowOp> SlowOpVec;
+
+
+/**
+ * The K slowest I/O and entry ops of a phase (where K is "--slowops"), kept as a bounded min-heap,
+ * so that the fastest of the stored ops can be replaced cheaply by a slower one.
+ *
+ * Only updated by the owning worker thread, so values are only valid at the end of a phase.
+ */
+class SlowOpsStats
+{
+	public:
+		/**
+		 * @maxNumOps number of slowest ops to keep; 0 to disable.
+		 */
+		void reset(size_t maxNumOps)
+		{
+			this->maxNumOps = maxNumOps;
+			heapVec.clear();
+		}
+
+		void setToZero()
+		{
+			heapVec.clear();
+		}
+
+		bool isEnabled() const
+		{
+			return maxNumOps;
+		}
+
+		/**
+		 * Check if an op with the given latency would be added. This is the cheap check for the
+		 * hot path, so that callers only need to prepare the op details for actual slow ops.
+		 */
+		bool isSlowOp(uint64_t latencyNS) const
+		{
+			return maxNumOps &&
+				( (heapVec.size() < maxNumOps) || (latencyNS > heapVec.front().latencyNS) );
+		}
+
+		/**
+		 * Add op if it is among the maxNumOps slowest ops so far.
+		 */
+		void addOp(const SlowOp& op)
+		{
+			if(!isSlowOp(op.latencyNS) )
+				return;
+
+			if(heapVec.size() == maxNumOps)
+			{ // remove fastest op to make room
+				std::pop_heap(heapVec.begin(), heapVec.end(), compareLatency);
+				heapVec.pop_back();
+			}
+
+			heapVec.push_back(op);
+			std::push_heap(heapVec.begin(), heapVec.end(), compareLatency);
+		}
+
+		SlowOpsStats& operator+=(const SlowOpsStats& rhs)
+		{
+			for(const SlowOp& op : rhs.heapVec)
+				addOp(op);
+
+			return *this;
+		}
+
+		/**
+		 * Set the host of all ops, e.g. after receiving them from a service.
+		 */
+		void setHost(const std::string& host)
+		{
+			for(SlowOp& op : heapVec)
+				op.host = host;
+		}
+
+		/**
+		 * @return ops sorted by latency, slowest first.
+		 */
+		SlowOpVec getSortedOps() const
+		{
+			SlowOpVec sortedVec(heapVec);
+
+			std::sort(sortedVec.begin(), sortedVec.end(),
+				[](const SlowOp& a, const SlowOp& b) { return a.latencyNS > b.latencyNS; } );
+
+			return sortedVec;
+		}
+
+		size_t getNumOps() const { return heapVec.size(); }
+
+		void getAsPropertyTreeForService(bpt::ptree& outTree) const
+		{
+			for(const SlowOp& op : heapVec)
+			{
+				bpt::ptree opTree;
+
+				opTree.put(XFER_STATS_SLOWOP_LATNS, op.latencyNS);
+				opTree.put(XFER_STATS_SLOWOP_STARTUSEC, op.startUSec);
+				opTree.put(XFER_STATS_SLOWOP_OFFSET, op.offset);
+				opTree.put(XFER_STATS_SLOWOP_LENGTH, op.length);
+				opTree.put(XFER_STATS_SLOWOP_WORKERRANK, op.workerRank);
+				opTree.put(XFER_STATS_SLOWOP_OPNAME, op.opName);
+				opTree.put(XFER_STATS_SLOWOP_PATH, op.path);
+
+				outTree.add_child(XFER_STATS_SLOWOPSLIST_ITEM, opTree);
+			}
+		}
+
+		void setFromPropertyTreeForService(bpt::ptree& tree)
+		{
+			heapVec.clear();
+
+			if(!tree.count(XFER_STATS_SLOWOPSLIST) )
+				return;
+
+			for(bpt::ptree::value_type& opItem : tree.get_child(XFER_STATS_SLOWOPSLIST) )
+			{
+				SlowOp op;
+
+				op.latencyNS = opItem.second.get<uint64_t>(XFER_STATS_SLOWOP_LATNS);
+				op.startUSec = opItem.second.get<uint64_t>(XFER_STATS_SLOWOP_STARTUSEC);
+				op.offset = opItem.second.get<uint64_t>(XFER_STATS_SLOWOP_OFFSET);
+				op.length = opItem.second.get<uint64_t>(XFER_STATS_SLOWOP_LENGTH);
+				op.workerRank = opItem.second.get<size_t>(XFER_STATS_SLOWOP_WORKERRANK);
+				op.opName = opItem.second.get<std::string>(XFER_STATS_SLOWOP_OPNAME);
+				op.path = opItem.second.get<std::string>(XFER_STATS_SLOWOP_PATH);
+
+				addOp(op);
+			}
+		}
+
+	private:
+		size_t maxNumOps{0}; // 0 if disabled
+		SlowOpVec heapVec; // min-heap by latency, so front is the fastest of the slow ops
+
+		static bool compareLatency(const SlowOp& a, const SlowOp& b)
+		{
+			return a.latencyNS > b.latencyNS; // greater for min-heap
+		}
+};
+
+#endif /* SLOWOPSSTATS_H_ */
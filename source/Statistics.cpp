@@ -21,12 +21,20 @@
 #include "ProgException.h"
 #include "Statistics.h"
 #include "ftxui/dom/elements.hpp"
+#include "toolkits/CompressTk.h"
 #include "toolkits/FileTk.h"
 #include "toolkits/SignalTk.h"
 #include "toolkits/TerminalTk.h"
+#include "toolkits/random/CompressibleDataGen.h"
+#include "toolkits/random/DedupeDataGen.h"
+#include "toolkits/random/RandAlgoSelectorTk.h"
 #include "workers/RemoteWorker.h"
 #include "workers/Worker.h"
 
+#define DRYRUN_COMPRESS_SAMPLE_LEN                  (16*1024*1024) // data for compress estimate
+
+#define LIVESTATS_LAT_PERCENTILES                   {"50", "99", "99.9"} // live lat percentiles
+
 #define FULLSCREEN_WORKERS_TITLE_PADDING_SIZE       1 // 1 right
 #define FULLSCREEN_HEADER_TITLE_PADDING_SIZE        1 // 1 right
 
@@ -258,6 +266,31 @@ void Statistics::printSingleLineLiveStatsLine(LiveResults& liveResults)
 				"]; ";
 	}
 
+	// live latency percentiles (combined for rwmix write and read to keep the line short)
+	{
+		const LiveLatency& liveLat = liveResults.liveLatency;
+		const bool isDirBenchPath = (progArgs.getBenchPathType() == BenchPathType_DIR);
+
+		HdrHistogram latHisto(isDirBenchPath ? liveLat.entriesLatHisto : liveLat.ioLatHisto);
+		latHisto += isDirBenchPath ? liveLat.entriesLatReadMixHisto : liveLat.ioLatReadMixHisto;
+
+		if(latHisto.getSignificantDigits() )
+		{
+			std::string separatorStr = "lat "; // prefix for 1st percentile
+
+			for(const char* percentageStr : LIVESTATS_LAT_PERCENTILES)
+			{
+				stream << separatorStr << "p" << percentageStr << "=" <<
+					UnitTk::latencyUsToHumanStr(
+						latHisto.getValueAtPercentile(std::stod(percentageStr) ) / 1000);
+
+				separatorStr = " ";
+			}
+
+			stream << "; ";
+		}
+	}
+
 	if(!progArgs.getHostsVec().empty() )
 	{ // master mode
 		stream <<
@@ -352,6 +385,7 @@ void Statistics::loopSingleLineLiveStats(LiveResults* customLiveResults,
 		lock.unlock(); // U N L O C K
 
 		workerManager.checkPhaseTimeLimit(); // (interrupts workers if time limit exceeded)
+		workerManager.checkPhaseWarmupEnd(); // (resets worker stats after warmup period)
 
         // live stats refresh (& init-once of fullscreen mode)...
 
@@ -375,6 +409,7 @@ void Statistics::loopSingleLineLiveStats(LiveResults* customLiveResults,
             updateLiveStatsLiveOps(liveResults, elapsedRefreshMS.count() ); // upd live ops & %done
 
             printLiveStatsCSV(liveResults); // live stats csv file
+            printLiveStatsTimeSeries(liveResults); // live stats binary time-series file
 
             printSingleLineLiveStatsLine(liveResults);
         }
@@ -422,6 +457,7 @@ void Statistics::loopNoConsoleLiveStats()
 		lock.unlock(); // U N L O C K
 
 		workerManager.checkPhaseTimeLimit(); // (interrupts workers if time limit exceeded)
+		workerManager.checkPhaseWarmupEnd(); // (resets worker stats after warmup period)
 
         // live stats refresh (& init-once of fullscreen mode)...
 
@@ -445,6 +481,7 @@ void Statistics::loopNoConsoleLiveStats()
             updateLiveStatsLiveOps(liveResults, elapsedRefreshMS.count() ); // upd live ops & %done
 
             printLiveStatsCSV(liveResults); // live stats csv file
+            printLiveStatsTimeSeries(liveResults); // live stats binary time-series file
         }
 	}
 
@@ -764,6 +801,7 @@ void Statistics::loopFullScreenLiveStats()
 
 
         workerManager.checkPhaseTimeLimit(); // (interrupts workers if time limit exceeded)
+        workerManager.checkPhaseWarmupEnd(); // (resets worker stats after warmup period)
 
         // live stats refresh (& init-once of fullscreen mode)...
 
@@ -788,8 +826,9 @@ void Statistics::loopFullScreenLiveStats()
             updateLiveStatsRemoteInfo(liveResults); // update info for master mode
             updateLiveStatsLiveOps(liveResults, elapsedRefreshMS.count() ); // upd live ops & %done
 
-            // live stats csv file update
+            // live stats csv and time-series file update
             printLiveStatsCSV(liveResults);
+            printLiveStatsTimeSeries(liveResults);
 
             // print global info table
             printFullScreenLiveStatsGlobalInfo(liveResults, uiState.headerStatsTxtTable);
@@ -926,64 +965,87 @@ void Statistics::printFullScreenLiveStatsGlobalInfo(const LiveResults& liveResul
 		liveResults.newLiveOpsReadMix.numEntriesDone);
 	const bool isRWMixThreadsPhase = (isRWMixPhase && progArgs.hasUserSetRWMixReadThreads() );
 
+    const LiveLatency& liveLat = liveResults.liveLatency;
+
+    /* get latency string for IO and entries (the latter only in dir mode) for the given values in
+        microseconds (one value for each of io, io rwmix read, entries, entries rwmix read) */
+    auto getLatStr = [&](uint64_t ioLat, uint64_t ioLatReadMix, uint64_t entriesLat,
+        uint64_t entriesLatReadMix) -> std::string
+    {
+        std::ostringstream latStream;
+
+        if(!isRWMixPhase)
+        {
+            if(progArgs.getBenchPathType() != BenchPathType_DIR)
+                latStream << UnitTk::latencyUsToHumanStr(ioLat);
+            else
+            { // BenchPathType_DIR
+                latStream <<
+                    "IO=" << UnitTk::latencyUsToHumanStr(ioLat) << " " <<
+                    liveResults.entryTypeUpperCase << "=" <<
+                    UnitTk::latencyUsToHumanStr(entriesLat);
+            }
+        }
+        else
+        { // rwmix
+            latStream <<
+                "IO ["
+                "wr=" << UnitTk::latencyUsToHumanStr(ioLat) << " "
+                "rd=" << UnitTk::latencyUsToHumanStr(ioLatReadMix) <<
+                "]";
+
+            if(progArgs.getBenchPathType() == BenchPathType_DIR)
+            {
+                latStream << "  "; // double space as separator
+
+                if(!isRWMixThreadsPhase)
+                {
+                    latStream <<
+                        liveResults.entryTypeUpperCase << "=" <<
+                        UnitTk::latencyUsToHumanStr(entriesLat);
+                }
+                else
+                {
+                    latStream <<
+                        liveResults.entryTypeUpperCase <<
+                        " ["
+                        "wr=" << UnitTk::latencyUsToHumanStr(entriesLat) << " "
+                        "rd=" << UnitTk::latencyUsToHumanStr(entriesLatReadMix) <<
+                        "]";
+                }
+            }
+        }
+
+        return latStream.str();
+    };
+
     VEC2D_SET_AUTOGROW(outHeaderStatsTxtTable, rowIdx, colIdx++, FULLSCREEN_HEADER_TITLE_LATENCY);
+    VEC2D_SET_AUTOGROW(outHeaderStatsTxtTable, rowIdx, colIdx++,
+        getLatStr(liveLat.avgIOLatMicroSecsSum, liveLat.avgIOLatReadMixMicroSecsSum,
+            liveLat.avgEntriesLatMicroSecsSum, liveLat.avgEntriesLatReadMixMicrosSecsSum) );
 
-    std::ostringstream latStream;
+    // live percentiles (only available for the local case or if services sent them)
 
-	if(!isRWMixPhase)
-	{
-		if(progArgs.getBenchPathType() != BenchPathType_DIR)
-			latStream << UnitTk::latencyUsToHumanStr(liveResults.liveLatency.avgIOLatMicroSecsSum);
-		else
-		{ // BenchPathType_DIR
-			latStream <<
-				"IO=" <<
-				UnitTk::latencyUsToHumanStr(liveResults.liveLatency.avgIOLatMicroSecsSum) <<
-				" " <<
-				liveResults.entryTypeUpperCase << "=" <<
-				UnitTk::latencyUsToHumanStr(liveResults.liveLatency.avgEntriesLatMicroSecsSum);
-		}
-	}
-	else
-	{ // rwmix
-		latStream <<
-			"IO ["
-			"wr=" <<
-			UnitTk::latencyUsToHumanStr(liveResults.liveLatency.avgIOLatMicroSecsSum) <<
-			" "
-			"rd=" <<
-			UnitTk::latencyUsToHumanStr(liveResults.liveLatency.avgIOLatReadMixMicroSecsSum) <<
-			"]";
-
-		if(progArgs.getBenchPathType() == BenchPathType_DIR)
-		{
-			latStream << "  "; // double space as separator
+    if(!liveLat.ioLatHisto.getSignificantDigits() &&
+        !liveLat.entriesLatHisto.getSignificantDigits() )
+        return;
 
-			if(!isRWMixThreadsPhase)
-			{
-				latStream <<
-					liveResults.entryTypeUpperCase << "=" <<
-					UnitTk::latencyUsToHumanStr(
-						liveResults.liveLatency.avgEntriesLatMicroSecsSum);
-			}
-			else
-			{
-				latStream <<
-					liveResults.entryTypeUpperCase <<
-					" ["
-					"wr=" <<
-					UnitTk::latencyUsToHumanStr(
-						liveResults.liveLatency.avgEntriesLatMicroSecsSum) <<
-					" "
-					"rd=" <<
-					UnitTk::latencyUsToHumanStr(
-						liveResults.liveLatency.avgEntriesLatReadMixMicrosSecsSum) <<
-					"]";
-			}
-		}
-	}
+    for(const char* percentageStr : LIVESTATS_LAT_PERCENTILES)
+    {
+        const double percentage = std::stod(percentageStr);
 
-    VEC2D_SET_AUTOGROW(outHeaderStatsTxtTable, rowIdx, colIdx++, latStream.str() );
+        // new row, reset column
+        rowIdx++;
+        colIdx = 0;
+
+        VEC2D_SET_AUTOGROW(outHeaderStatsTxtTable, rowIdx, colIdx++,
+            std::string("P") + percentageStr + ":");
+        VEC2D_SET_AUTOGROW(outHeaderStatsTxtTable, rowIdx, colIdx++,
+            getLatStr(liveLat.ioLatHisto.getValueAtPercentile(percentage) / 1000,
+                liveLat.ioLatReadMixHisto.getValueAtPercentile(percentage) / 1000,
+                liveLat.entriesLatHisto.getValueAtPercentile(percentage) / 1000,
+                liveLat.entriesLatReadMixHisto.getValueAtPercentile(percentage) / 1000) );
+    }
 }
 
 /**
@@ -1284,7 +1346,10 @@ void Statistics::updateLiveStatsLiveOps(LiveResults& liveResults, size_t elapsed
             "Backtrace: \n" + backtraceStr);
     }
 
-	getLiveOps(liveResults.newLiveOps, liveResults.newLiveOpsReadMix, liveResults.liveLatency);
+	getLiveOps(liveResults.newLiveOps, liveResults.newLiveOpsReadMix, liveResults.liveLatency,
+		liveTimeSeriesFile.isOpen() ? &liveResults.workerLiveLatencyVec : NULL);
+
+	liveResults.intervalMS = elapsedMS;
 
 	liveResults.liveOpsPerSec = liveResults.newLiveOps - liveResults.lastLiveOps;
 	(liveResults.liveOpsPerSec *= 1000) /= elapsedMS;
@@ -1325,6 +1390,43 @@ void Statistics::updateLiveStatsLiveOps(LiveResults& liveResults, size_t elapsed
 
 	// calc latency average values
 	liveResults.liveLatency.divAllByNumValues();
+
+	/* throughput stability: only intervals while all workers are running (because the tail of a
+		phase with slower workers would dominate the dips) and intervals that start after warmup */
+	if(progArgs.getShowThroughputStability() &&
+		(liveResults.numBytesPerWorker || liveResults.numEntriesPerWorker) )
+	{
+		const size_t phaseElapsedMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - workersSharedData.phaseStartT).count();
+		const bool allWorkersRunning = progArgs.getHostsVec().empty() ?
+			!liveResults.numWorkersDone :
+			(liveResults.numRemoteThreadsLeft == (workerVec.size() * progArgs.getNumThreads() ) );
+		const bool isAfterWarmup = (phaseElapsedMS >= elapsedMS) &&
+			( (phaseElapsedMS - elapsedMS) >= (progArgs.getWarmupSecs() * 1000) );
+
+		if(allWorkersRunning && isAfterWarmup)
+			throughputStability.addInterval(elapsedMS, throughputStability.getUseBytes() ?
+				(liveResults.liveOpsPerSec.numBytesDone +
+					liveResults.liveOpsPerSecReadMix.numBytesDone) :
+				(liveResults.liveOpsPerSec.numEntriesDone +
+					liveResults.liveOpsPerSecReadMix.numEntriesDone) );
+	}
+
+	if(steadyStateDetector.getIsActive() )
+	{
+		const uint64_t iopsPerSec = liveResults.liveOpsPerSec.numIOPSDone +
+			liveResults.liveOpsPerSecReadMix.numIOPSDone;
+
+		if(steadyStateDetector.addInterval(elapsedMS, iopsPerSec,
+			liveResults.liveLatency.avgIOLatMicroSecsSum) )
+		{ // end phase like on expired time limit
+			LOGGER(Log_VERBOSE, "Steady state reached after " <<
+				steadyStateDetector.getNumRounds() << " rounds." << std::endl);
+
+			WorkersSharedData::isPhaseTimeExpired = true;
+			workerManager.interruptAndNotifyWorkers();
+		}
+	}
 }
 
 
@@ -1340,10 +1442,18 @@ void Statistics::printLiveStats()
         (TerminalTk::isStdoutTTY() || progArgs.getUseBriefLiveStatsNewLine() );
 
     prepLiveCSVFile();
+    prepLiveTimeSeriesFile();
+
+    size_t numEntriesPerWorker;
+    uint64_t numBytesPerWorker;
+
+    workerManager.getPhaseNumEntriesAndBytes(numEntriesPerWorker, numBytesPerWorker);
+    throughputStability.initStart(numBytesPerWorker != 0, progArgs.getStabilityDipPercent() );
 
     if(!showConsoleStats)
     {
-        if(liveCSVFileFD == -1)
+        if( (liveCSVFileFD == -1) && !liveTimeSeriesFile.isOpen() &&
+            !steadyStateDetector.getIsActive() && !progArgs.getShowThroughputStability() )
             return; // nohting to do here
 
         loopNoConsoleLiveStats();
@@ -1380,18 +1490,37 @@ single_line_stats:
  * 		to be initialized to 0).
  * @param outLiveLatency this method will call divAllByNumValues(), so struct values are avg across
  * 		all workers.
+ * @param outWorkerLiveLatencyVec if not NULL, this gets resized to the number of workers and
+ * 		receives the latency of each individual worker with divAllByNumValues() already applied.
+ * 		(The worker live latency values get reset on retrieval, so they can't be retrieved
+ * 		separately from the total values.)
  */
 void Statistics::getLiveOps(LiveOps& outLiveOps, LiveOps& outLiveRWMixReadOps,
-	LiveLatency& outLiveLatency)
+	LiveLatency& outLiveLatency, std::vector<LiveLatency>* outWorkerLiveLatencyVec)
 {
 	outLiveOps = {}; // set all members to zero
 	outLiveRWMixReadOps = {}; // set all members to zero
 	outLiveLatency = {}; // set all members to zero
 
+	if(outWorkerLiveLatencyVec)
+		outWorkerLiveLatencyVec->resize(workerVec.size() );
+
 	for(size_t i=0; i < workerVec.size(); i++)
 	{
 		workerVec[i]->getAndAddLiveOps(outLiveOps, outLiveRWMixReadOps);
-		workerVec[i]->getAndAddLiveLatency(outLiveLatency);
+
+		if(!outWorkerLiveLatencyVec)
+		{
+			workerVec[i]->getAndAddLiveLatency(outLiveLatency);
+			continue;
+		}
+
+		LiveLatency& workerLiveLatency = (*outWorkerLiveLatencyVec)[i];
+
+		workerLiveLatency.setToZero(); // (keeps histogram allocations of previous round)
+		workerVec[i]->getAndAddLiveLatency(workerLiveLatency);
+		workerLiveLatency.getAndAddOps(outLiveLatency);
+		workerLiveLatency.divAllByNumValues();
 	}
 }
 
@@ -1433,6 +1562,8 @@ void Statistics::getLiveStatsAsPropertyTreeForService(bpt::ptree& outTree)
 	outTree.put(XFER_STATS_LAT_SUM_IOPS, liveLatency.avgIOLatMicroSecsSum);
 	outTree.put(XFER_STATS_LAT_NUM_ENTRIES, liveLatency.numAvgEntriesLatValues);
 	outTree.put(XFER_STATS_LAT_SUM_ENTRIES, liveLatency.avgEntriesLatMicroSecsSum);
+	outTree.put(XFER_STATS_LIVELATHISTO_IOPS, liveLatency.ioLatHisto.getCountsStr() );
+	outTree.put(XFER_STATS_LIVELATHISTO_ENTRIES, liveLatency.entriesLatHisto.getCountsStr() );
 
 	if( (workersSharedData.currentBenchPhase == BenchPhase_CREATEFILES) &&
 		(progArgs.getRWMixReadPercent() || progArgs.getNumRWMixReadThreads() ||
@@ -1450,6 +1581,10 @@ void Statistics::getLiveStatsAsPropertyTreeForService(bpt::ptree& outTree)
 			liveLatency.numAvgEntriesLatReadMixValues);
 		outTree.put(XFER_STATS_LAT_SUM_ENTRIES_RWMIXREAD,
 			liveLatency.avgEntriesLatReadMixMicrosSecsSum);
+		outTree.put(XFER_STATS_LIVELATHISTO_IOPS_RWMIXREAD,
+			liveLatency.ioLatReadMixHisto.getCountsStr() );
+		outTree.put(XFER_STATS_LIVELATHISTO_ENTRIES_RWMIXREAD,
+			liveLatency.entriesLatReadMixHisto.getCountsStr() );
 	}
 
 	outTree.put(XFER_STATS_ERRORHISTORY, LoggerBase::getErrHistory() );
@@ -1622,6 +1757,26 @@ void Statistics::printPhaseResults()
 
     bool genRes = generatePhaseResults(phaseResults);
 
+    if(genRes && sloSearchStep.stepNum)
+        updateSLOSearchStep(phaseResults);
+
+    if(genRes && sweepCombinationNum)
+    {
+        SweepResult sweepResult;
+
+        sweepResult.combinationNum = sweepCombinationNum;
+        sweepResult.numThreads = progArgs.getNumThreads();
+        sweepResult.ioDepth = progArgs.getIODepth();
+        sweepResult.blockSize = progArgs.getBlockSize();
+        sweepResult.fileSize = progArgs.getFileSize();
+        sweepResult.phaseName = TranslatorTk::benchPhaseToPhaseName(
+            workersSharedData.currentBenchPhase, &progArgs);
+        sweepResult.opsPerSec = phaseResults.opsPerSec;
+        phaseResults.opsPerSecReadMix.getAndAddOps(sweepResult.opsPerSec);
+
+        sweepResultsVec.push_back(sweepResult);
+    }
+
     if(!genRes)
         std::cout << "Phase: " << TranslatorTk::benchPhaseToPhaseName(
             workersSharedData.currentBenchPhase, &progArgs) << ": "
@@ -1701,6 +1856,12 @@ bool Statistics::generatePhaseResults(PhaseResults& phaseResults)
 	// (first worker might not have gotten work, so we can only init while we iterate over workers)
 	bool firstAndLastFinishInitialized = false;
 
+	// work done by each worker until 1st finisher for fairness index
+	std::vector<uint64_t> workerStoneWallBytesVec;
+	std::vector<uint64_t> workerStoneWallEntriesVec;
+
+	phaseResults.slowOps.reset(progArgs.getNumSlowOps() );
+
 	// sum up total values
 	for(Worker* worker : workerVec)
 	{
@@ -1749,10 +1910,22 @@ bool Statistics::generatePhaseResults(PhaseResults& phaseResults)
 		worker->getAndAddLiveOps(phaseResults.opsTotal, phaseResults.opsTotalReadMix);
 		worker->getAndAddStoneWallOps(phaseResults.opsStoneWallTotal,
 			phaseResults.opsStoneWallTotalReadMix);
+
+		LiveOps workerStoneWallOps = {};
+		worker->getAndAddStoneWallOps(workerStoneWallOps, workerStoneWallOps);
+		workerStoneWallBytesVec.push_back(workerStoneWallOps.numBytesDone);
+		workerStoneWallEntriesVec.push_back(workerStoneWallOps.numEntriesDone);
 		phaseResults.iopsLatHisto += worker->getIOPSLatencyHistogram();
 		phaseResults.iopsLatHistoReadMix += worker->getIOPSLatencyHistogramReadMix();
 		phaseResults.entriesLatHisto += worker->getEntriesLatencyHistogram();
 		phaseResults.entriesLatHistoReadMix += worker->getEntriesLatencyHistogramReadMix();
+		phaseResults.iopsRespLatHisto += worker->getIOPSRespLatencyHistogram();
+		phaseResults.entriesRespLatHisto += worker->getEntriesRespLatencyHistogram();
+		phaseResults.ioBatchStats += worker->getIOBatchStats();
+		phaseResults.openLoopStats += worker->getOpenLoopStats();
+		phaseResults.slowOps += worker->getSlowOpsStats();
+		phaseResults.fileLatStats += worker->getFileLatStats();
+		phaseResults.resourceStats += worker->getResourceStats();
 
 	} // end of for loop
 
@@ -1762,6 +1935,14 @@ bool Statistics::generatePhaseResults(PhaseResults& phaseResults)
 	    return false;
 	}
 
+	// fairness of workers based on bytes (if any) or num entries
+	const bool haveStoneWallBytes = phaseResults.opsStoneWallTotal.numBytesDone ||
+		phaseResults.opsStoneWallTotalReadMix.numBytesDone;
+
+	phaseResults.fairnessIndex = ThroughputStability::getFairnessIndex(
+		haveStoneWallBytes ? workerStoneWallBytesVec : workerStoneWallEntriesVec);
+	phaseResults.numFairnessWorkers = workerStoneWallBytesVec.size();
+
 	// total per sec for all workers by 1st finisher
 	if(phaseResults.firstFinishUSec)
 	{
@@ -2110,6 +2291,138 @@ void Statistics::printPhaseResultsToStream(const PhaseResults& phaseResults,
 			% std::to_string( (unsigned) phaseResults.cpuUtilStoneWallPercent)
 			% std::to_string( (unsigned) phaseResults.cpuUtilPercent)
 			<< std::endl;
+
+		const ResourceStats& resourceStats = phaseResults.resourceStats;
+
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% "CPU usage"
+			% ":"
+			<< "user=" << UnitTk::latencyUsToHumanStr(resourceStats.cpuUserUSec) << " "
+			"sys=" << UnitTk::latencyUsToHumanStr(resourceStats.cpuSysUSec) << " "
+			"vol_csw=" << resourceStats.numVolCtxSwitches << " "
+			"invol_csw=" << resourceStats.numInvolCtxSwitches << " "
+			"minflt=" << resourceStats.numMinorFaults << " "
+			"majflt=" << resourceStats.numMajorFaults << " "
+			"peak_rss=" << (resourceStats.peakRSSKiB / 1024) << "MiB"
+			<< std::endl;
+
+		// cpu time of workers relative to work done, e.g. to compare I/O engines
+		const uint64_t numIOs = phaseResults.opsTotal.numIOPSDone +
+			phaseResults.opsTotalReadMix.numIOPSDone;
+		const uint64_t numEntries = phaseResults.opsTotal.numEntriesDone +
+			phaseResults.opsTotalReadMix.numEntriesDone;
+		const uint64_t numBytes = phaseResults.opsTotal.numBytesDone +
+			phaseResults.opsTotalReadMix.numBytesDone;
+
+		if(numIOs || numEntries)
+		{
+			std::ostringstream efficiencyStream; // separate stream to not change outStream format
+
+			efficiencyStream << std::fixed << std::setprecision(2);
+
+			if(numIOs)
+				efficiencyStream << "us/IO=" << ( (double)resourceStats.getCPUUSec() / numIOs);
+			else
+				efficiencyStream << "us/entry=" <<
+					( (double)resourceStats.getCPUUSec() / numEntries);
+
+			if(numBytes)
+				efficiencyStream << " s/GB=" <<
+					( (resourceStats.getCPUUSec() / 1e6) / (numBytes / 1e9) );
+
+			outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+				% ""
+				% "CPU efficiency"
+				% ":"
+				<< efficiencyStream.str() << std::endl;
+		}
+	}
+
+	// average number of I/Os per async submit/reap call
+	if(phaseResults.ioBatchStats.numSubmitCalls)
+	{
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% "IO batch avg"
+			% ":";
+
+		outStream << "[ " <<
+			"submit=" << boost::format("%.1f") % phaseResults.ioBatchStats.getAvgSubmitBatch() <<
+			" reap=" << boost::format("%.1f") % phaseResults.ioBatchStats.getAvgReapBatch() <<
+			" ]" << std::endl;
+	}
+
+	// ops that were issued behind the open-loop arrival schedule
+	if(phaseResults.openLoopStats.numOps)
+	{
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% "Open loop"
+			% ":";
+
+		outStream << "[ " <<
+			"late=" << boost::format("%.2f") % phaseResults.openLoopStats.getLatePercent() << "%" <<
+			" max_backlog=" << phaseResults.openLoopStats.maxBacklog <<
+			" ]" << std::endl;
+	}
+
+	// latency SLO capacity search step
+	if(sloSearchStep.stepNum)
+	{
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% "SLO search"
+			% ":";
+
+		outStream << "[ " <<
+			"step=" << sloSearchStep.stepNum <<
+			" " << getSLOSearchValueStr(sloSearchStep.searchValue) <<
+			" p" << progArgs.getSLOPercentile() << "=" <<
+				boost::format("%.0f") % sloSearchStep.latUSec << "us" <<
+			" target=" << progArgs.getSLOLatUSec() << "us" <<
+			" met=" << (sloSearchStep.sloMet ? "yes" : "no") <<
+			" ]" << std::endl;
+	}
+
+	// throughput stability of live stats intervals and fairness of workers
+	if(progArgs.getShowThroughputStability() )
+	{
+		const std::string stabilityUnitStr = throughputStability.getUseBytes() ?
+			throughputUnitStr : (entryTypeUpperCase + "/s");
+		const uint64_t stabilityDivisor = throughputStability.getUseBytes() ?
+			throughputDivisor : 1;
+
+		if(throughputStability.getNumIntervals() )
+		{
+			outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+				% ""
+				% (stabilityUnitStr + " stability")
+				% ":";
+
+			outStream << "[ " <<
+				"intervals=" << throughputStability.getNumIntervals() <<
+				" min=" << (throughputStability.getMin() / stabilityDivisor) <<
+				" p5=" << (throughputStability.getPercentile(5) / stabilityDivisor) <<
+				" p50=" << (throughputStability.getPercentile(50) / stabilityDivisor) <<
+				" p95=" << (throughputStability.getPercentile(95) / stabilityDivisor) <<
+				" max=" << (throughputStability.getMax() / stabilityDivisor) <<
+				" cv=" << boost::format("%.1f") %
+					throughputStability.getCoefficientOfVariationPercent() << "%" <<
+				" dip<" << throughputStability.getDipPercent() << "%=" <<
+					UnitTk::elapsedMSToHumanStr(throughputStability.getLongestDipMS() ) <<
+				" ]" << std::endl;
+		}
+
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% "Worker fairness"
+			% ":";
+
+		outStream << "[ " <<
+			"jain=" << boost::format("%.3f") % phaseResults.fairnessIndex <<
+			" workers=" << phaseResults.numFairnessWorkers <<
+			" ]" << std::endl;
 	}
 
 	// print individual elapsed time results for each worker
@@ -2183,6 +2496,62 @@ void Statistics::printPhaseResultsToStream(const PhaseResults& phaseResults,
 	printPhaseResultsLatencyToStream(phaseResults.iopsLatHistoReadMix,
 		"IO rd", outStream);
 
+	// open-loop response time (from intended issue time, so incl. backlog wait)
+	printPhaseResultsLatencyToStream(phaseResults.entriesRespLatHisto, "Ent resp", outStream);
+	printPhaseResultsLatencyToStream(phaseResults.iopsRespLatHisto, "IO resp", outStream);
+
+	// latency breakdown of file-level operations in dir mode
+	if(phaseResults.fileLatStats.hasValues() )
+	{
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% "File lat avg"
+			% ":";
+
+		outStream << "[";
+
+		for(unsigned type = 0; type < FileLat_NUMTYPES; type++)
+		{
+			const LatencyHistogram& latHisto =
+				phaseResults.fileLatStats.getLatHisto( (FileLatType)type);
+
+			if(latHisto.getNumStoredValues() )
+				outStream << " " << FileLatStats::getTypeName( (FileLatType)type) << "=" <<
+					UnitTk::latencyUsToHumanStr(latHisto.getAverageMicroSec() );
+		}
+
+		outStream << " ]" << std::endl;
+
+		for(unsigned type = 0; type < FileLat_NUMTYPES; type++)
+			printPhaseResultsLatencyToStream(
+				phaseResults.fileLatStats.getLatHisto( (FileLatType)type),
+				FileLatStats::getTypeLabel( (FileLatType)type), outStream);
+	}
+
+	// slowest ops of this phase (one line per op, slowest first)
+	std::string slowOpsLabelStr = "Slowest ops"; // only printed for 1st op
+
+	for(const SlowOp& slowOp : phaseResults.slowOps.getSortedOps() )
+	{
+		outStream << boost::format(Statistics::phaseResultsLeftFormatStr)
+			% ""
+			% slowOpsLabelStr
+			% (slowOpsLabelStr.empty() ? "" : ":");
+
+		outStream << "[ " <<
+			"lat=" << UnitTk::latencyUsToHumanStr(slowOp.latencyNS / 1000) <<
+			" op=" << slowOp.opName <<
+			" path=" << slowOp.path <<
+			" offset=" << slowOp.offset <<
+			" len=" << slowOp.length <<
+			" start=" << UnitTk::latencyUsToHumanStr(slowOp.startUSec) <<
+			" rank=" << slowOp.workerRank <<
+			(slowOp.host.empty() ? "" : " host=") << slowOp.host <<
+			" ]" << std::endl;
+
+		slowOpsLabelStr.clear();
+	}
+
 	// warn in case of invalid results
 	if( (phaseResults.firstFinishUSec == 0) && !progArgs.getIgnore0USecErrors() )
 	{
@@ -2343,6 +2712,86 @@ void Statistics::printPhaseResultsToStringVec(const PhaseResults& phaseResults,
 	printPhaseResultsLatencyToStringVec(phaseResults.iopsLatHistoReadMix, "rwmix read IO",
 		outLabelsVec, outResultsVec);
 
+	// open-loop response time & backlog
+
+	printPhaseResultsLatencyToStringVec(phaseResults.entriesRespLatHisto, "Ent resp",
+		outLabelsVec, outResultsVec);
+	printPhaseResultsLatencyToStringVec(phaseResults.iopsRespLatHisto, "IO resp",
+		outLabelsVec, outResultsVec);
+
+	outLabelsVec.push_back("open loop late %");
+	outResultsVec.push_back(!phaseResults.openLoopStats.numOps ?
+		"" : std::to_string(phaseResults.openLoopStats.getLatePercent() ) );
+
+	outLabelsVec.push_back("open loop max backlog");
+	outResultsVec.push_back(!phaseResults.openLoopStats.numOps ?
+		"" : std::to_string(phaseResults.openLoopStats.maxBacklog) );
+
+	// latency SLO capacity search step
+
+	outLabelsVec.push_back("slo step");
+	outResultsVec.push_back(!sloSearchStep.stepNum ?
+		"" : std::to_string(sloSearchStep.stepNum) );
+
+	outLabelsVec.push_back("slo search value");
+	outResultsVec.push_back(!sloSearchStep.stepNum ?
+		"" : std::to_string(sloSearchStep.searchValue) );
+
+	outLabelsVec.push_back("slo lat us");
+	outResultsVec.push_back(!sloSearchStep.stepNum ?
+		"" : std::to_string( (uint64_t)sloSearchStep.latUSec) );
+
+	outLabelsVec.push_back("slo met");
+	outResultsVec.push_back(!sloSearchStep.stepNum ?
+		"" : std::to_string(sloSearchStep.sloMet) );
+
+	// parameter sweep combination (the swept values are in the config columns)
+
+	outLabelsVec.push_back("sweep combination");
+	outResultsVec.push_back(!sweepCombinationNum ?
+		"" : std::to_string(sweepCombinationNum) );
+
+	// throughput stability (throughput values in MiB/s or entries/s)
+
+	const bool haveStability = progArgs.getShowThroughputStability() &&
+		throughputStability.getNumIntervals();
+	const uint64_t stabilityDivisor = throughputStability.getUseBytes() ? (1024*1024) : 1;
+
+	outLabelsVec.push_back("stability unit");
+	outResultsVec.push_back(!haveStability ?
+		"" : (throughputStability.getUseBytes() ? "MiB/s" : "entries/s") );
+
+	outLabelsVec.push_back("stability intervals");
+	outResultsVec.push_back(!haveStability ?
+		"" : std::to_string(throughputStability.getNumIntervals() ) );
+
+	outLabelsVec.push_back("stability min");
+	outResultsVec.push_back(!haveStability ?
+		"" : std::to_string(throughputStability.getMin() / stabilityDivisor) );
+
+	for(const char* percentageStr : {"5", "50", "95"} )
+	{
+		outLabelsVec.push_back(std::string("stability p") + percentageStr);
+		outResultsVec.push_back(!haveStability ? "" : std::to_string(
+			throughputStability.getPercentile(std::stod(percentageStr) ) / stabilityDivisor) );
+	}
+
+	outLabelsVec.push_back("stability max");
+	outResultsVec.push_back(!haveStability ?
+		"" : std::to_string(throughputStability.getMax() / stabilityDivisor) );
+
+	outLabelsVec.push_back("stability cv%");
+	outResultsVec.push_back(!haveStability ?
+		"" : std::to_string(throughputStability.getCoefficientOfVariationPercent() ) );
+
+	outLabelsVec.push_back("stability longest dip ms");
+	outResultsVec.push_back(!haveStability ?
+		"" : std::to_string(throughputStability.getLongestDipMS() ) );
+
+	outLabelsVec.push_back("fairness index");
+	outResultsVec.push_back(!progArgs.getShowThroughputStability() ?
+		"" : std::to_string(phaseResults.fairnessIndex) );
+
 	// elbencho version
 
 	outLabelsVec.push_back("version");
@@ -2416,23 +2865,15 @@ void Statistics::printPhaseResultsLatencyToStream(const LatencyHistogram& latHis
 			outStream << "Histogram exceeded";
 		else
 		{
-			outStream <<
-				"1%<=" << latHisto.getPercentileStr(1) << " "
-				"50%<=" << latHisto.getPercentileStr(50) << " "
-				"75%<=" << latHisto.getPercentileStr(75) << " "
-				"99%<=" << latHisto.getPercentileStr(99);
-
-			// print configurable amount of percentile nines (99.9%, 99.99%, ...)
-			std::string ninesStr = "99.";
-			for(unsigned short numDecimals=1;
-				numDecimals <= progArgs.getNumLatencyPercentile9s();
-				numDecimals++)
-			{
-				ninesStr += "9"; // append next decimal 9
-				double percentage = std::stod(ninesStr);
+			std::string separatorStr; // empty for 1st percentile
 
-				outStream << " " << std::setprecision(numDecimals+3) << // +3 for "99."
+			for(double percentage :
+				getLatencyPercentagesVec(progArgs.getNumLatencyPercentile9s() ) )
+			{
+				outStream << separatorStr << std::setprecision(15) <<
 					percentage << "%<=" << latHisto.getPercentileStr(percentage);
+
+				separatorStr = " ";
 			}
 		}
 
@@ -2480,6 +2921,34 @@ void Statistics::printPhaseResultsLatencyToStringVec(const LatencyHistogram& lat
 	outLabelsVec.push_back(latTypeStr + " lat us [max]");
 	outResultsVec.push_back(!latHisto.getNumStoredValues() ?
 		"" : std::to_string(latHisto.getMaxMicroSecLat() ) );
+
+	// latency percentiles (fixed set of columns, so that CSV header doesn't depend on options)
+
+	for(const char* percentageStr : {"50", "99", "99.9", "99.99"} )
+	{
+		outLabelsVec.push_back(latTypeStr + " lat us [p" + percentageStr + "]");
+		outResultsVec.push_back(
+			(!latHisto.getNumStoredValues() || latHisto.getHistogramExceeded() ) ?
+			"" : latHisto.getPercentileStr(std::stod(percentageStr) ) );
+	}
+}
+
+/**
+ * Get the percentages for latency percentile results: 1, 50, 75, 99 and the given number of
+ * decimal nines (99.9, 99.99, ...).
+ */
+std::vector<double> Statistics::getLatencyPercentagesVec(unsigned numPercentile9s)
+{
+	std::vector<double> percentagesVec = {1, 50, 75, 99};
+
+	std::string ninesStr = "99.";
+	for(unsigned numDecimals=1; numDecimals <= numPercentile9s; numDecimals++)
+	{
+		ninesStr += "9"; // append next decimal 9
+		percentagesVec.push_back(std::stod(ninesStr) );
+	}
+
+	return percentagesVec;
 }
 
 void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
@@ -2571,6 +3040,9 @@ void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
 
     configSubtree.put("io_depth", progArgs.getIODepth() );
 
+    if(sweepCombinationNum)
+        configSubtree.put("sweep_combination", sweepCombinationNum);
+
     if(!progArgs.getHostsVec().empty() )
         configSubtree.put("shared_service_paths", progArgs.getIsServicePathShared() );
 
@@ -2687,6 +3159,78 @@ void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
     firstDoneSubtree.put("cpu%", (unsigned)phaseResults.cpuUtilStoneWallPercent);
     lastDoneSubtree.put("cpu%", (unsigned)phaseResults.cpuUtilPercent);
 
+    // cpu time, context switches and page faults of worker threads
+
+    if(progArgs.getShowCPUUtilization() )
+    {
+        const ResourceStats& resourceStats = phaseResults.resourceStats;
+        const uint64_t numIOs = phaseResults.opsTotal.numIOPSDone +
+            phaseResults.opsTotalReadMix.numIOPSDone;
+        const uint64_t numBytes = phaseResults.opsTotal.numBytesDone +
+            phaseResults.opsTotalReadMix.numBytesDone;
+
+        lastDoneSubtree.put("cpu_usage.user_us", resourceStats.cpuUserUSec);
+        lastDoneSubtree.put("cpu_usage.sys_us", resourceStats.cpuSysUSec);
+        lastDoneSubtree.put("cpu_usage.vol_ctx_switches", resourceStats.numVolCtxSwitches);
+        lastDoneSubtree.put("cpu_usage.invol_ctx_switches", resourceStats.numInvolCtxSwitches);
+        lastDoneSubtree.put("cpu_usage.minor_faults", resourceStats.numMinorFaults);
+        lastDoneSubtree.put("cpu_usage.major_faults", resourceStats.numMajorFaults);
+        lastDoneSubtree.put("cpu_usage.peak_rss_kib", resourceStats.peakRSSKiB);
+
+        if(numIOs)
+            lastDoneSubtree.put("cpu_usage.us_per_io",
+                (double)resourceStats.getCPUUSec() / numIOs);
+
+        if(numBytes)
+            lastDoneSubtree.put("cpu_usage.s_per_gb",
+                (resourceStats.getCPUUSec() / 1e6) / (numBytes / 1e9) );
+    }
+
+    // average number of I/Os per async submit/reap call
+
+    if(phaseResults.ioBatchStats.numSubmitCalls)
+    {
+        lastDoneSubtree.put("io_batch.submit_avg", phaseResults.ioBatchStats.getAvgSubmitBatch() );
+        lastDoneSubtree.put("io_batch.reap_avg", phaseResults.ioBatchStats.getAvgReapBatch() );
+    }
+
+    // ops that were issued behind the open-loop arrival schedule
+
+    if(phaseResults.openLoopStats.numOps)
+    {
+        lastDoneSubtree.put("open_loop.num_ops", phaseResults.openLoopStats.numOps);
+        lastDoneSubtree.put("open_loop.late_percent",
+            phaseResults.openLoopStats.getLatePercent() );
+        lastDoneSubtree.put("open_loop.max_backlog", phaseResults.openLoopStats.maxBacklog);
+    }
+
+    // slowest ops of this phase (array, slowest first)
+
+    if(phaseResults.slowOps.getNumOps() )
+    {
+        bpt::ptree slowOpsSubtree;
+
+        for(const SlowOp& slowOp : phaseResults.slowOps.getSortedOps() )
+        {
+            bpt::ptree slowOpTree;
+
+            slowOpTree.put("lat_us", slowOp.latencyNS / 1000);
+            slowOpTree.put("op", slowOp.opName);
+            slowOpTree.put("path", slowOp.path);
+            slowOpTree.put("offset", slowOp.offset);
+            slowOpTree.put("length", slowOp.length);
+            slowOpTree.put("start_us", slowOp.startUSec);
+            slowOpTree.put("rank", slowOp.workerRank);
+
+            if(!slowOp.host.empty() )
+                slowOpTree.put("host", slowOp.host);
+
+            slowOpsSubtree.push_back(std::make_pair("", slowOpTree) );
+        }
+
+        lastDoneSubtree.put_child("slow_ops", slowOpsSubtree);
+    }
+
     // entries & iops latency results
 
     // lambda to fill latency
@@ -2699,6 +3243,25 @@ void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
         outTree.put("min_us", latHisto.getMinMicroSecLat() );
         outTree.put("avg_us", latHisto.getAverageMicroSec() );
         outTree.put("max_us", latHisto.getMaxMicroSecLat() );
+
+        if(!progArgs.getShowLatencyPercentiles() || latHisto.getHistogramExceeded() )
+            return;
+
+        // note: push_back instead of put, because put would treat "." in "p99.9" as path separator
+        bpt::ptree percentilesTree;
+
+        for(double percentage : getLatencyPercentagesVec(progArgs.getNumLatencyPercentile9s() ) )
+        {
+            std::ostringstream keyStream;
+            bpt::ptree percentileValueTree;
+
+            keyStream << "p" << std::setprecision(15) << percentage;
+            percentileValueTree.put_value(latHisto.getPercentile(percentage) );
+
+            percentilesTree.push_back(std::make_pair(keyStream.str(), percentileValueTree) );
+        }
+
+        outTree.put_child("percentiles_us", percentilesTree);
     }; // end of addLatencyResultsToSubtree lambda
 
     addLatencyResultsToSubtree(phaseResults.entriesLatHisto, entriesLatencySubtree);
@@ -2714,12 +3277,54 @@ void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
     if(iopsLatencySubtreeReadMix.size() )
         iopsLatencySubtree.put_child("rwmix_read", iopsLatencySubtreeReadMix);
 
+    // open-loop response time (from intended issue time, so incl. backlog wait)
+
+    bpt::ptree entriesRespLatencySubtree;
+    bpt::ptree iopsRespLatencySubtree;
+
+    addLatencyResultsToSubtree(phaseResults.entriesRespLatHisto, entriesRespLatencySubtree);
+    addLatencyResultsToSubtree(phaseResults.iopsRespLatHisto, iopsRespLatencySubtree);
+
+    if(entriesRespLatencySubtree.size() )
+        entriesLatencySubtree.put_child("response", entriesRespLatencySubtree);
+
+    if(iopsRespLatencySubtree.size() )
+        iopsLatencySubtree.put_child("response", iopsRespLatencySubtree);
+
     if(entriesLatencySubtree.size() )
         lastDoneLatencySubtree.put_child("entries", entriesLatencySubtree);
 
     if(iopsLatencySubtree.size() )
         lastDoneLatencySubtree.put_child("IO", iopsLatencySubtree);
 
+    // latency breakdown of file-level operations in dir mode
+
+    if(phaseResults.fileLatStats.hasValues() )
+    {
+        bpt::ptree fileLatencySubtree;
+
+        for(unsigned type = 0; type < FileLat_NUMTYPES; type++)
+        {
+            const LatencyHistogram& latHisto =
+                phaseResults.fileLatStats.getLatHisto( (FileLatType)type);
+            const std::string typeName = FileLatStats::getTypeName( (FileLatType)type);
+            bpt::ptree typeLatencySubtree;
+
+            if(!latHisto.getNumStoredValues() )
+                continue;
+
+            lastDoneSubtree.put("file_lat_avg_us." + typeName, latHisto.getAverageMicroSec() );
+
+            addLatencyResultsToSubtree(latHisto, typeLatencySubtree);
+
+            if(typeLatencySubtree.size() )
+                fileLatencySubtree.put_child(typeName, typeLatencySubtree);
+        }
+
+        if(fileLatencySubtree.size() )
+            lastDoneLatencySubtree.put_child("file", fileLatencySubtree);
+    }
+
     // latency histograms
 
     if(progArgs.getShowLatencyHistogram() )
@@ -2751,6 +3356,54 @@ void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
     ptree.put_child("first_done", firstDoneSubtree);
     ptree.put_child("last_done", lastDoneSubtree);
 
+    // latency SLO capacity search step
+
+    if(sloSearchStep.stepNum)
+    {
+        bpt::ptree sloSearchSubtree;
+
+        sloSearchSubtree.put("step", sloSearchStep.stepNum);
+        sloSearchSubtree.put("search_type",
+            (progArgs.getSLOSearchType() == ARG_SLOSEARCH_IODEPTH) ?
+            ARG_SLOSEARCH_IODEPTH_NAME : ARG_SLOSEARCH_RATE_NAME);
+        sloSearchSubtree.put("search_value", sloSearchStep.searchValue);
+        sloSearchSubtree.put("percentile", progArgs.getSLOPercentile() );
+        sloSearchSubtree.put("target_us", progArgs.getSLOLatUSec() );
+        sloSearchSubtree.put("lat_us", sloSearchStep.latUSec);
+        sloSearchSubtree.put("met", sloSearchStep.sloMet);
+
+        ptree.put_child("slo_search", sloSearchSubtree);
+    }
+
+    // throughput stability and fairness
+
+    if(progArgs.getShowThroughputStability() )
+    {
+        bpt::ptree stabilitySubtree;
+
+        if(throughputStability.getNumIntervals() )
+        {
+            stabilitySubtree.put("unit",
+                throughputStability.getUseBytes() ? "bytes/s" : "entries/s");
+            stabilitySubtree.put("intervals", throughputStability.getNumIntervals() );
+            stabilitySubtree.put("min", throughputStability.getMin() );
+            stabilitySubtree.put("p5", throughputStability.getPercentile(5) );
+            stabilitySubtree.put("p50", throughputStability.getPercentile(50) );
+            stabilitySubtree.put("p95", throughputStability.getPercentile(95) );
+            stabilitySubtree.put("max", throughputStability.getMax() );
+            stabilitySubtree.put("mean", (uint64_t)throughputStability.getMean() );
+            stabilitySubtree.put("cv_percent",
+                throughputStability.getCoefficientOfVariationPercent() );
+            stabilitySubtree.put("dip_percent", throughputStability.getDipPercent() );
+            stabilitySubtree.put("longest_dip_ms", throughputStability.getLongestDipMS() );
+        }
+
+        stabilitySubtree.put("fairness_index", phaseResults.fairnessIndex);
+        stabilitySubtree.put("fairness_workers", phaseResults.numFairnessWorkers);
+
+        ptree.put_child("stability", stabilitySubtree);
+    }
+
 
     // print json
 
@@ -2778,6 +3431,216 @@ void Statistics::printPhaseResultsAsJSON(const PhaseResults& phaseResults)
     }
 }
 
+/**
+ * Add throughput and latency of a completed phase to the current latency SLO search step.
+ */
+void Statistics::updateSLOSearchStep(const PhaseResults& phaseResults)
+{
+	LatencyHistogram iopsLatHisto; // incl. rwmix read, as SLO applies to all IOs
+
+	iopsLatHisto += phaseResults.iopsLatHisto;
+	iopsLatHisto += phaseResults.iopsLatHistoReadMix;
+
+	sloSearchStep.iopsPerSec = phaseResults.opsPerSec.numIOPSDone +
+		phaseResults.opsPerSecReadMix.numIOPSDone;
+	sloSearchStep.bytesPerSec = phaseResults.opsPerSec.numBytesDone +
+		phaseResults.opsPerSecReadMix.numBytesDone;
+
+	if(!iopsLatHisto.getNumStoredValues() )
+	{ // no IOs done, so nothing that could meet the SLO
+		sloSearchStep.latUSec = 0;
+		sloSearchStep.sloMet = false;
+		return;
+	}
+
+	sloSearchStep.latUSec = iopsLatHisto.getHistogramExceeded() ?
+		iopsLatHisto.getMaxMicroSecLat() : iopsLatHisto.getPercentile(progArgs.getSLOPercentile() );
+	sloSearchStep.sloMet = (sloSearchStep.latUSec <= progArgs.getSLOLatUSec() );
+}
+
+/**
+ * Get human-readable name and value of the setting that gets varied by the latency SLO search.
+ *
+ * @searchValue total IOPS limit (0 for unlimited) or IO depth.
+ * @return e.g. "iops_limit=5000" or "iodepth=16".
+ */
+std::string Statistics::getSLOSearchValueStr(uint64_t searchValue)
+{
+	if(progArgs.getSLOSearchType() == ARG_SLOSEARCH_IODEPTH)
+		return "iodepth=" + std::to_string(searchValue);
+
+	return "iops_limit=" + (searchValue ? std::to_string(searchValue) : "unlimited");
+}
+
+/**
+ * Print the throughput-vs-latency curve of all steps of a latency SLO capacity search to console
+ * and to human-readable results file (if specified by user).
+ *
+ * @stepsVec all completed search steps in the order in which they ran.
+ * @capacityStep the step with the highest IOPS that met the SLO; NULL if no step met the SLO.
+ */
+void Statistics::printSLOSearchSummary(const SLOSearchStepVec& stepsVec,
+	const SLOSearchStep* capacityStep)
+{
+	printSLOSearchSummaryToStream(stepsVec, capacityStep, std::cout);
+
+	if(!progArgs.getResFilePathTXT().empty() )
+	{
+		std::ofstream fileStream;
+
+		fileStream.open(progArgs.getResFilePathTXT(), std::ofstream::app);
+
+		if(!fileStream)
+		{
+			std::cerr << "ERROR: Opening results file failed: " << progArgs.getResFilePathTXT() <<
+				std::endl;
+
+			return;
+		}
+
+		printSLOSearchSummaryToStream(stepsVec, capacityStep, fileStream);
+
+		fileStream << std::endl;
+	}
+}
+
+/**
+ * Print the throughput-vs-latency curve of a latency SLO capacity search to the given stream.
+ *
+ * See printSLOSearchSummary() for params.
+ */
+void Statistics::printSLOSearchSummaryToStream(const SLOSearchStepVec& stepsVec,
+	const SLOSearchStep* capacityStep, std::ostream& outStream)
+{
+	const std::string formatStr("%|5| %|-20| %|12| %|12| %|12| %|5|");
+	const std::string throughputUnitStr = progArgs.getShowThroughputBase10() ? "MB/s" : "MiB/s";
+	const uint64_t throughputDivisor = progArgs.getShowThroughputBase10() ?
+		(1000*1000) : (1024*1024);
+
+	std::ostringstream latTitleStream;
+	latTitleStream << "p" << progArgs.getSLOPercentile() << " us";
+
+	outStream << "SLO SEARCH: p" << progArgs.getSLOPercentile() << " <= " <<
+		progArgs.getSLOLatUSec() << "us" << std::endl;
+
+	outStream << boost::format(formatStr)
+		% "STEP"
+		% "SETTING"
+		% "IOPS"
+		% throughputUnitStr
+		% latTitleStream.str()
+		% "MET" << std::endl;
+
+	for(const SLOSearchStep& step : stepsVec)
+		outStream << boost::format(formatStr)
+			% step.stepNum
+			% getSLOSearchValueStr(step.searchValue)
+			% step.iopsPerSec
+			% (step.bytesPerSec / throughputDivisor)
+			% (uint64_t)step.latUSec
+			% (step.sloMet ? "yes" : "no") << std::endl;
+
+	if(!capacityStep)
+		outStream << "CAPACITY: SLO not met in any step" << std::endl;
+	else
+		outStream << "CAPACITY: " << capacityStep->iopsPerSec << " IOPS, " <<
+			(capacityStep->bytesPerSec / throughputDivisor) << " " << throughputUnitStr <<
+			" (step " << capacityStep->stepNum << ", " <<
+			getSLOSearchValueStr(capacityStep->searchValue) << ")" << std::endl;
+
+	outStream << PHASERESULTS_CONSOLE_SEPARATOR_LINE << std::endl;
+}
+
+/**
+ * Get the throughput of a parameter sweep combination for plateau detection: Best bytes per sec
+ * of all phases of the combination or best entries per sec if no phase transferred any bytes.
+ *
+ * @combinationNum 1-based number of the sweep combination.
+ * @return 0 if no phase results exist for the given combination.
+ */
+uint64_t Statistics::getSweepCombinationPerSec(size_t combinationNum) const
+{
+	uint64_t maxBytesPerSec = 0;
+	uint64_t maxEntriesPerSec = 0;
+
+	for(const SweepResult& sweepResult : sweepResultsVec)
+	{
+		if(sweepResult.combinationNum != combinationNum)
+			continue;
+
+		maxBytesPerSec = std::max(maxBytesPerSec, sweepResult.opsPerSec.numBytesDone);
+		maxEntriesPerSec = std::max(maxEntriesPerSec, sweepResult.opsPerSec.numEntriesDone);
+	}
+
+	return maxBytesPerSec ? maxBytesPerSec : maxEntriesPerSec;
+}
+
+/**
+ * Print the results of all phases of all parameter sweep combinations as a single table to
+ * console and to human-readable results file (if specified by user).
+ */
+void Statistics::printSweepSummary()
+{
+	printSweepSummaryToStream(std::cout);
+
+	if(!progArgs.getResFilePathTXT().empty() )
+	{
+		std::ofstream fileStream;
+
+		fileStream.open(progArgs.getResFilePathTXT(), std::ofstream::app);
+
+		if(!fileStream)
+		{
+			std::cerr << "ERROR: Opening results file failed: " << progArgs.getResFilePathTXT() <<
+				std::endl;
+
+			return;
+		}
+
+		printSweepSummaryToStream(fileStream);
+
+		fileStream << std::endl;
+	}
+}
+
+/**
+ * Print the results of all parameter sweep combinations to the given stream.
+ */
+void Statistics::printSweepSummaryToStream(std::ostream& outStream)
+{
+	const std::string formatStr("%|5| %|8| %|8| %|8| %|8| %|-10| %|12| %|12| %|12|");
+	const std::string throughputUnitStr = progArgs.getShowThroughputBase10() ? "MB/s" : "MiB/s";
+	const uint64_t throughputDivisor = progArgs.getShowThroughputBase10() ?
+		(1000*1000) : (1024*1024);
+
+	outStream << "SWEEP RESULTS:" << std::endl;
+
+	outStream << boost::format(formatStr)
+		% "COMB"
+		% "THREADS"
+		% "IODEPTH"
+		% "BLOCK"
+		% "SIZE"
+		% "PHASE"
+		% "ENTRIES/s"
+		% "IOPS"
+		% throughputUnitStr << std::endl;
+
+	for(const SweepResult& sweepResult : sweepResultsVec)
+		outStream << boost::format(formatStr)
+			% sweepResult.combinationNum
+			% sweepResult.numThreads
+			% sweepResult.ioDepth
+			% UnitTk::numToHumanStrBase2(sweepResult.blockSize)
+			% UnitTk::numToHumanStrBase2(sweepResult.fileSize)
+			% sweepResult.phaseName
+			% sweepResult.opsPerSec.numEntriesDone
+			% sweepResult.opsPerSec.numIOPSDone
+			% (sweepResult.opsPerSec.numBytesDone / throughputDivisor) << std::endl;
+
+	outStream << PHASERESULTS_CONSOLE_SEPARATOR_LINE << std::endl;
+}
+
 /**
  * Get results of a completed benchmark phase.
  */
@@ -2790,6 +3653,15 @@ void Statistics::getBenchResultAsPropertyTreeForService(bpt::ptree& outTree)
 	LatencyHistogram iopsLatHistoReadMix; // sum of all histograms
 	LatencyHistogram entriesLatHisto; // sum of all histograms
 	LatencyHistogram entriesLatHistoReadMix; // sum of all histograms
+	LatencyHistogram iopsRespLatHisto; // sum of all histograms
+	LatencyHistogram entriesRespLatHisto; // sum of all histograms
+	IOBatchStats ioBatchStats; // sum of all workers
+	OpenLoopStats openLoopStats; // sum of all workers
+	SlowOpsStats slowOps; // slowest ops of all workers
+	FileLatStats fileLatStats; // sum of all workers
+	ResourceStats resourceStats; // sum of all workers
+
+	slowOps.reset(progArgs.getNumSlowOps() );
 
 	getLiveOps(liveOps, liveOpsReadMix, liveLatency);
 
@@ -2829,6 +3701,19 @@ void Statistics::getBenchResultAsPropertyTreeForService(bpt::ptree& outTree)
 
 		iopsLatHisto += worker->getIOPSLatencyHistogram();
 		entriesLatHisto += worker->getEntriesLatencyHistogram();
+		ioBatchStats += worker->getIOBatchStats();
+		slowOps += worker->getSlowOpsStats();
+		resourceStats += worker->getResourceStats();
+
+		if(progArgs.getShowFileLatBreakdown() )
+			fileLatStats += worker->getFileLatStats();
+
+		if(progArgs.getOpenLoopOpsPerSec() )
+		{
+			iopsRespLatHisto += worker->getIOPSRespLatencyHistogram();
+			entriesRespLatHisto += worker->getEntriesRespLatencyHistogram();
+			openLoopStats += worker->getOpenLoopStats();
+		}
 
 		if( (workersSharedData.currentBenchPhase == BenchPhase_CREATEFILES) &&
 			(progArgs.getRWMixReadPercent() || progArgs.getNumRWMixReadThreads() ||
@@ -2843,6 +3728,19 @@ void Statistics::getBenchResultAsPropertyTreeForService(bpt::ptree& outTree)
 
 	iopsLatHisto.getAsPropertyTreeForService(outTree, XFER_STATS_LAT_PREFIX_IOPS);
 	entriesLatHisto.getAsPropertyTreeForService(outTree, XFER_STATS_LAT_PREFIX_ENTRIES);
+	ioBatchStats.getAsPropertyTreeForService(outTree);
+	slowOps.getAsPropertyTreeForService(outTree);
+	resourceStats.getAsPropertyTreeForService(outTree);
+
+	if(progArgs.getShowFileLatBreakdown() )
+		fileLatStats.getAsPropertyTreeForService(outTree);
+
+	if(progArgs.getOpenLoopOpsPerSec() )
+	{
+		iopsRespLatHisto.getAsPropertyTreeForService(outTree, XFER_STATS_LAT_PREFIX_IOPS_RESP);
+		entriesRespLatHisto.getAsPropertyTreeForService(outTree, XFER_STATS_LAT_PREFIX_ENTRIES_RESP);
+		openLoopStats.getAsPropertyTreeForService(outTree);
+	}
 
 	if( (workersSharedData.currentBenchPhase == BenchPhase_CREATEFILES) &&
 		(progArgs.getRWMixReadPercent() || progArgs.getNumRWMixReadThreads() ||
@@ -2882,6 +3780,9 @@ void Statistics::printDryRunInfo()
 	if(progArgs.getRunReadPhase() )
 		printDryRunPhaseInfo(BenchPhase_READFILES);
 
+	if(progArgs.getRunReplayPhase() )
+		printDryRunPhaseInfo(BenchPhase_REPLAY);
+
 	if(progArgs.getRunDeleteFilesPhase() )
 		printDryRunPhaseInfo(BenchPhase_DELETEFILES);
 
@@ -2931,8 +3832,9 @@ void Statistics::printDryRunPhaseInfo(BenchPhase benchPhase)
 		(numEntriesTotal / 1000) << " K" " | " <<
 		(numEntriesTotal / (1000*1000) ) << " M" << std::endl;
 
-	// show bytes info only for create/write & read phases
-	if( (benchPhase != BenchPhase_CREATEFILES) && (benchPhase != BenchPhase_READFILES) )
+	// show bytes info only for create/write, read & replay phases
+	if( (benchPhase != BenchPhase_CREATEFILES) && (benchPhase != BenchPhase_READFILES) &&
+		(benchPhase != BenchPhase_REPLAY) )
 		return;
 
 	std::cout << "* Bytes per " << perUnitStr << ":   " << numBytesPerThread << " | " <<
@@ -2941,6 +3843,45 @@ void Statistics::printDryRunPhaseInfo(BenchPhase benchPhase)
 	std::cout << "* Bytes total:        " << numBytesTotal << " | " <<
 		(numBytesTotal / (1024*1024) ) << " MiB" " | " <<
 		(numBytesTotal / (1024*1024*1024) ) << " GiB" << std::endl;
+
+	if( (benchPhase == BenchPhase_CREATEFILES) && progArgs.getCompressRatio() )
+		printDryRunCompressInfo();
+
+	if( (benchPhase == BenchPhase_CREATEFILES) && progArgs.getDedupePercent() )
+		std::cout << "* Dedupe ratio:       " << boost::format("%.2f") %
+			DedupeDataGen::getExpectedDedupeRatio(progArgs.getDedupePercent() ) << ":1 expected | " <<
+			progArgs.getDedupePercent() << "% duplicate chunks of " <<
+			progArgs.getDedupeChunkSize() << " bytes" << std::endl;
+}
+
+/**
+ * Print the compression ratio of data from the generator for "--compressratio" based on the
+ * built-in LZ estimator, as a self-check for the user-given target ratio.
+ */
+void Statistics::printDryRunCompressInfo()
+{
+	const size_t sampleLen = DRYRUN_COMPRESS_SAMPLE_LEN;
+	const size_t blockSize = std::min(progArgs.getBlockSize(), sampleLen);
+
+	if(!blockSize)
+		return;
+
+	std::unique_ptr<RandAlgoInterface> randAlgo =
+		RandAlgoSelectorTk::stringToAlgo(progArgs.getBlockVarianceAlgo() );
+	CompressibleDataGen dataGen(*randAlgo, progArgs.getCompressRatio() );
+
+	// fill sample like consecutive writes of block size would do
+	std::vector<char> sampleBuf(sampleLen);
+
+	for(size_t offset = 0; offset < sampleLen; offset += blockSize)
+		dataGen.fillBuf(&sampleBuf[offset], std::min(blockSize, sampleLen - offset) );
+
+	const double estimatedRatio = CompressTk::estimateLZRatio(sampleBuf.data(), sampleLen);
+
+	std::cout << "* Compression ratio:  " <<
+		boost::format("%.2f") % progArgs.getCompressRatio() << ":1 target | " <<
+		boost::format("%.2f") % estimatedRatio << ":1 lz4-like estimate "
+		"(stronger compressors typically achieve closer to target)" << std::endl;
 }
 
 /**
@@ -3052,7 +3993,13 @@ void Statistics::prepLiveCSVFile()
 			"Lat IO us,"
 			"Active,"
 			"CPU,"
-			"Service," << std::endl;
+			"Service,";
+
+		for(const char* latTypeStr : {"Ent", "IO"} )
+			for(const char* percentageStr : LIVESTATS_LAT_PERCENTILES)
+				stream << "Lat " << latTypeStr << " p" << percentageStr << " us,";
+
+		stream << std::endl;
 
 		size_t streamLen = stream.tellp();
 
@@ -3125,6 +4072,9 @@ void Statistics::printLiveStatsCSV(const LiveResults& liveResults)
 		cpuUtil << ","
 		"" << ","; // service
 
+	addLivePercentilesCSV(stream, liveResults.liveLatency.entriesLatHisto);
+	addLivePercentilesCSV(stream, liveResults.liveLatency.ioLatHisto);
+
 	stream << std::endl;
 
 	// print rwmix total read line...
@@ -3156,6 +4106,9 @@ void Statistics::printLiveStatsCSV(const LiveResults& liveResults)
 			cpuUtil << ","
 			"" << ","; // service
 
+		addLivePercentilesCSV(stream, liveResults.liveLatency.entriesLatReadMixHisto);
+		addLivePercentilesCSV(stream, liveResults.liveLatency.ioLatReadMixHisto);
+
 		stream << std::endl;
 	}
 
@@ -3222,6 +4175,10 @@ void Statistics::printLiveStatsCSV(const LiveResults& liveResults)
 				progArgs.getHostsVec()[i] << ",";
 		}
 
+		// no per-worker live percentiles
+		addLivePercentilesCSV(stream, HdrHistogram() );
+		addLivePercentilesCSV(stream, HdrHistogram() );
+
 		stream << std::endl;
 
 		// print rwmix read worker result line
@@ -3272,6 +4229,10 @@ void Statistics::printLiveStatsCSV(const LiveResults& liveResults)
 					progArgs.getHostsVec()[i] << ",";
 			}
 
+			// no per-worker live percentiles
+			addLivePercentilesCSV(stream, HdrHistogram() );
+			addLivePercentilesCSV(stream, HdrHistogram() );
+
 			stream << std::endl;
 
 		} // end of rwmix worker read result
@@ -3285,6 +4246,226 @@ void Statistics::printLiveStatsCSV(const LiveResults& liveResults)
 	if(writeRes) {} // only exists to mute compiler warning about unused write() result
 }
 
+/**
+ * Add live latency percentile columns in microseconds to a live CSV line. Columns are empty if the
+ * given histogram has no values, e.g. because live percentiles are disabled.
+ */
+void Statistics::addLivePercentilesCSV(std::ostream& outStream, const HdrHistogram& latHisto)
+{
+	for(const char* percentageStr : LIVESTATS_LAT_PERCENTILES)
+	{
+		if(latHisto.getTotalCount() )
+			outStream << latHisto.getValueAtPercentile(std::stod(percentageStr) ) / 1000;
+
+		outStream << ",";
+	}
+}
+
+/**
+ * Open binary time-series file for live statistics.
+ * This is a no-op if user didn't set a live stats time-series file.
+ *
+ * @throw ProgException on error, e.g. unable to open file.
+ */
+void Statistics::prepLiveTimeSeriesFile()
+{
+	if(liveTimeSeriesFile.isOpen() )
+		return; // file already prepared in previous phase
+
+	if(progArgs.getLiveBinFilePath().empty() )
+		return; // nothing to do
+
+	liveTimeSeriesFile.openFile(progArgs.getLiveBinFilePath() );
+}
+
+/**
+ * Add total/aggregate and per-worker (i.e. per-thread in standalone mode or per-service in master
+ * mode) records of the current live stats interval to the time-series file.
+ * This is a no-op if no file for live time-series stats was specified.
+ *
+ * In contrast to the live csv file, this also contains per-sec values and latency for individual
+ * workers, because the per-worker latency gets retrieved together with the total by getLiveOps()
+ * and per-worker per-sec values are based on the live ops of the previous round in liveResults.
+ */
+void Statistics::printLiveStatsTimeSeries(LiveResults& liveResults)
+{
+	if(!liveTimeSeriesFile.isOpen() )
+		return; // output file not open => nothing to do
+
+	IF_UNLIKELY(!liveResults.intervalMS)
+		return; // no interval values yet (should not happen)
+
+	const bool isMasterMode = !progArgs.getHostsVec().empty();
+
+	if(!liveResults.timeSeriesPhaseAdded)
+	{
+		uint64_t startEpochMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+			workersSharedData.phaseStartLocalT.time_since_epoch() ).count();
+
+		liveTimeSeriesFile.addPhase(liveResults.phaseName, progArgs.getBenchLabel(),
+			workerVec.size(), isMasterMode, startEpochMS);
+
+		liveResults.timeSeriesPhaseAdded = true;
+	}
+
+	std::chrono::milliseconds elapsedMS =
+				std::chrono::duration_cast<std::chrono::milliseconds>
+				(std::chrono::steady_clock::now() - workersSharedData.phaseStartT);
+
+	const bool isRWMixPhase = (liveResults.newLiveOpsReadMix.numBytesDone ||
+		liveResults.newLiveOpsReadMix.numEntriesDone);
+
+	size_t numActiveWorkers = isMasterMode ?
+		liveResults.numRemoteThreadsLeft : (workerVec.size() - liveResults.numWorkersDone);
+	size_t cpuUtil = isMasterMode ?
+		liveResults.percentRemoteCPU : liveCpuUtil.getCPUUtilPercent();
+
+	// sets done and per-sec values of sample and adds it to file
+	auto addSample = [&](LiveTimeSeriesSample& sample, const LiveOps& liveOps,
+		const LiveOps& liveOpsPerSec)
+	{
+		sample.elapsedMS = elapsedMS.count();
+		sample.numBytesDone = liveOps.numBytesDone;
+		sample.numIOPSDone = liveOps.numIOPSDone;
+		sample.numEntriesDone = liveOps.numEntriesDone;
+		sample.bytesPerSec = liveOpsPerSec.numBytesDone;
+		sample.iopsPerSec = liveOpsPerSec.numIOPSDone;
+		sample.entriesPerSec = liveOpsPerSec.numEntriesDone;
+
+		liveTimeSeriesFile.addSample(sample);
+	};
+
+	// add total for all workers...
+
+	const LiveLatency& liveLat = liveResults.liveLatency;
+
+	LiveTimeSeriesSample sample = {};
+	sample.workerIndex = LIVETIMESERIES_WORKER_TOTAL;
+	sample.mixType = LIVETIMESERIES_MIX_NONE;
+	sample.cpuUtilPercent = cpuUtil;
+	sample.numActiveThreads = numActiveWorkers;
+
+	setLiveTimeSeriesLatency(liveLat.ioLatHisto, liveLat.numAvgIOLatValues,
+		liveLat.avgIOLatMicroSecsSum, sample.ioLatAvgMicroSec, sample.ioLatPercentilesMicroSec);
+	setLiveTimeSeriesLatency(liveLat.entriesLatHisto, liveLat.numAvgEntriesLatValues,
+		liveLat.avgEntriesLatMicroSecsSum, sample.entriesLatAvgMicroSec,
+		sample.entriesLatPercentilesMicroSec);
+
+	addSample(sample, liveResults.newLiveOps, liveResults.liveOpsPerSec);
+
+	if(isRWMixPhase)
+	{
+		sample.mixType = LIVETIMESERIES_MIX_READ;
+
+		setLiveTimeSeriesLatency(liveLat.ioLatReadMixHisto, liveLat.numAvgIOLatReadMixValues,
+			liveLat.avgIOLatReadMixMicroSecsSum, sample.ioLatAvgMicroSec,
+			sample.ioLatPercentilesMicroSec);
+		setLiveTimeSeriesLatency(liveLat.entriesLatReadMixHisto,
+			liveLat.numAvgEntriesLatReadMixValues, liveLat.avgEntriesLatReadMixMicrosSecsSum,
+			sample.entriesLatAvgMicroSec, sample.entriesLatPercentilesMicroSec);
+
+		addSample(sample, liveResults.newLiveOpsReadMix, liveResults.liveOpsPerSecReadMix);
+	}
+
+	// add individual workers...
+
+	const LiveLatency noWorkerLat = {}; // for the case that per-worker latency is not available
+
+	liveResults.lastWorkerLiveOpsVec.resize(workerVec.size() );
+	liveResults.lastWorkerLiveOpsReadMixVec.resize(workerVec.size() );
+
+	for(size_t i=0; i < workerVec.size(); i++)
+	{
+		LiveOps workerDone; // total (rwmix write) numbers
+		LiveOps workerDoneReadMix; // rwmix read numbers
+
+		workerVec[i]->getLiveOps(workerDone, workerDoneReadMix);
+
+		LiveOps workerPerSec = workerDone - liveResults.lastWorkerLiveOpsVec[i];
+		(workerPerSec *= 1000) /= liveResults.intervalMS;
+
+		LiveOps workerPerSecReadMix =
+			workerDoneReadMix - liveResults.lastWorkerLiveOpsReadMixVec[i];
+		(workerPerSecReadMix *= 1000) /= liveResults.intervalMS;
+
+		liveResults.lastWorkerLiveOpsVec[i] = workerDone;
+		liveResults.lastWorkerLiveOpsReadMixVec[i] = workerDoneReadMix;
+
+		sample = {};
+		sample.workerIndex = i;
+		sample.mixType = LIVETIMESERIES_MIX_NONE;
+		sample.cpuUtilPercent = LIVETIMESERIES_UNKNOWN_U16; // no per-thread cpu util
+		sample.numActiveThreads = LIVETIMESERIES_UNKNOWN_U32;
+
+		if(isMasterMode)
+		{
+			RemoteWorker* remoteWorker = static_cast<RemoteWorker*>(workerVec[i]);
+
+			sample.cpuUtilPercent = remoteWorker->getCPUUtilLive();
+			sample.numActiveThreads =
+				progArgs.getNumThreads() - remoteWorker->getNumWorkersDone();
+		}
+
+		const LiveLatency& workerLat = (i < liveResults.workerLiveLatencyVec.size() ) ?
+			liveResults.workerLiveLatencyVec[i] : noWorkerLat;
+
+		setLiveTimeSeriesLatency(workerLat.ioLatHisto, workerLat.numAvgIOLatValues,
+			workerLat.avgIOLatMicroSecsSum, sample.ioLatAvgMicroSec,
+			sample.ioLatPercentilesMicroSec);
+		setLiveTimeSeriesLatency(workerLat.entriesLatHisto, workerLat.numAvgEntriesLatValues,
+			workerLat.avgEntriesLatMicroSecsSum, sample.entriesLatAvgMicroSec,
+			sample.entriesLatPercentilesMicroSec);
+
+		addSample(sample, workerDone, workerPerSec);
+
+		if(isRWMixPhase)
+		{
+			sample.mixType = LIVETIMESERIES_MIX_READ;
+
+			setLiveTimeSeriesLatency(workerLat.ioLatReadMixHisto,
+				workerLat.numAvgIOLatReadMixValues, workerLat.avgIOLatReadMixMicroSecsSum,
+				sample.ioLatAvgMicroSec, sample.ioLatPercentilesMicroSec);
+			setLiveTimeSeriesLatency(workerLat.entriesLatReadMixHisto,
+				workerLat.numAvgEntriesLatReadMixValues,
+				workerLat.avgEntriesLatReadMixMicrosSecsSum, sample.entriesLatAvgMicroSec,
+				sample.entriesLatPercentilesMicroSec);
+
+			addSample(sample, workerDoneReadMix, workerPerSecReadMix);
+		}
+	}
+
+	liveTimeSeriesFile.flush(); // single write for all records of this interval
+}
+
+/**
+ * Set latency values of a live time-series sample. Values are set to LIVETIMESERIES_UNKNOWN_U32
+ * if there are no latency values in the current interval or if live percentiles are disabled.
+ *
+ * @numAvgLatValues number of values in avgLatMicroSec; 0 means no average available.
+ * @avgLatMicroSec average latency (i.e. after LiveLatency::divAllByNumValues() ).
+ * @outPercentilesMicroSec array with space for all LIVESTATS_LAT_PERCENTILES.
+ */
+void Statistics::setLiveTimeSeriesLatency(const HdrHistogram& latHisto,
+	uint64_t numAvgLatValues, uint64_t avgLatMicroSec, uint32_t& outAvgMicroSec,
+	uint32_t* outPercentilesMicroSec)
+{
+	outAvgMicroSec = numAvgLatValues ?
+		std::min(avgLatMicroSec, (uint64_t)LIVETIMESERIES_UNKNOWN_U32 - 1) :
+		LIVETIMESERIES_UNKNOWN_U32;
+
+	size_t percentileIndex = 0;
+
+	for(const char* percentageStr : LIVESTATS_LAT_PERCENTILES)
+	{
+		if(!latHisto.getTotalCount() )
+			outPercentilesMicroSec[percentileIndex++] = LIVETIMESERIES_UNKNOWN_U32;
+		else
+			outPercentilesMicroSec[percentileIndex++] = std::min(
+				latHisto.getValueAtPercentile(std::stod(percentageStr) ) / 1000,
+				(uint64_t)LIVETIMESERIES_UNKNOWN_U32 - 1);
+	}
+}
+
 /**
  * Check if the value left (i.e. column - 1) of the current element equals the given string value.
  *
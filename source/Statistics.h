@@ -16,7 +16,10 @@
 #include "CPUUtil.h"
 #include "Common.h"
 #include "LiveLatency.h"
+#include "LiveTimeSeriesFile.h"
 #include "ProgArgs.h"
+#include "SteadyStateDetector.h"
+#include "ThroughputStability.h"
 #include "toolkits/TranslatorTk.h"
 #include "workers/WorkerManager.h"
 #include "workers/WorkersSharedData.h"
@@ -45,8 +48,52 @@ class PhaseResults
 		LatencyHistogram iopsLatHistoReadMix; // rwmix read sum of all histograms
 		LatencyHistogram entriesLatHisto; // sum of all histograms
 		LatencyHistogram entriesLatHistoReadMix; // rwmix read sum of all histograms
+		LatencyHistogram iopsRespLatHisto; // open-loop response time sum of all histograms
+		LatencyHistogram entriesRespLatHisto; // open-loop response time sum of all histograms
+
+		IOBatchStats ioBatchStats; // async submit/reap batching sum of all workers
+		OpenLoopStats openLoopStats; // open-loop backlog of all workers
+		SlowOpsStats slowOps; // slowest ops of all workers
+		FileLatStats fileLatStats; // file open/xfer/close breakdown sum of all workers
+		ResourceStats resourceStats; // cpu time, faults etc sum of all workers
+
+		double fairnessIndex; // jain's index of work done by each worker until 1st finisher
+		size_t numFairnessWorkers; // number of workers included in fairnessIndex
+};
+
+/**
+ * Result of a single step (i.e. benchmark phase) of the latency SLO capacity search.
+ */
+class SLOSearchStep
+{
+	public:
+		size_t stepNum; // 1-based number of this step; 0 if no SLO search is running
+		uint64_t searchValue; // total IOPS limit (0 for unlimited) or IO depth of this step
+		uint64_t iopsPerSec; // achieved IOPS incl. rwmix read by last finisher
+		uint64_t bytesPerSec; // achieved throughput incl. rwmix read by last finisher
+		double latUSec; // IO latency at SLO percentile
+		bool sloMet; // true if latUSec is not larger than the SLO target
+};
+
+typedef std::vector<SLOSearchStep> SLOSearchStepVec;
+
+/**
+ * Result of a single phase of a parameter sweep combination.
+ */
+class SweepResult
+{
+	public:
+		size_t combinationNum; // 1-based number of the sweep combination
+		size_t numThreads; // threads per instance of this combination
+		size_t ioDepth; // IO depth of this combination
+		uint64_t blockSize; // block size of this combination
+		uint64_t fileSize; // file size of this combination
+		std::string phaseName; // read, write, mkdirs etc
+		LiveOps opsPerSec; // total per sec incl. rwmix read for all workers by last finisher
 };
 
+typedef std::vector<SweepResult> SweepResultVec;
+
 /**
  * Phase values for live stats
  */
@@ -90,6 +137,13 @@ class LiveResults
 		size_t percentDoneReadMix; // total percent done based on bytes (if any) or entries in phase
 
 		LiveLatency liveLatency; // avg latency across all workers for current live stats interval
+
+		// live time-series file values (only set if time-series file is open)
+		size_t intervalMS{0}; // elapsed time of current live stats interval
+		std::vector<LiveLatency> workerLiveLatencyVec; // avg latency of each worker in interval
+		std::vector<LiveOps> lastWorkerLiveOpsVec; // per-worker live ops from last round
+		std::vector<LiveOps> lastWorkerLiveOpsReadMixVec; // per-worker live ops from last round
+		bool timeSeriesPhaseAdded{false}; // true after phase record was added to time-series
 };
 
 /**
@@ -123,12 +177,18 @@ class Statistics
 		void printPhaseResults();
 
 		void getLiveOps(LiveOps& outLiveOps, LiveOps& outLiveRWMixReadOps,
-			LiveLatency& outLiveLatency);
+			LiveLatency& outLiveLatency, std::vector<LiveLatency>* outWorkerLiveLatencyVec = NULL);
 		void getLiveStatsAsPropertyTreeForService(bpt::ptree& outTree);
 		void getBenchResultAsPropertyTreeForService(bpt::ptree& outTree);
 
 		void printDryRunInfo();
 
+		void printSLOSearchSummary(const SLOSearchStepVec& stepsVec,
+			const SLOSearchStep* capacityStep);
+
+		uint64_t getSweepCombinationPerSec(size_t combinationNum) const;
+		void printSweepSummary();
+
 	private:
 		const ProgArgs& progArgs;
 		WorkerManager& workerManager;
@@ -140,6 +200,12 @@ class Statistics
 		const std::string phaseResultsFooterStr = std::string(3, '-');
 		CPUUtil liveCpuUtil; // updated by live stats loop or through http service live stat calls
 		int liveCSVFileFD = -1; // fd for live stats csv file
+		LiveTimeSeriesFile liveTimeSeriesFile; // binary live stats time-series file
+		SLOSearchStep sloSearchStep = {}; // current step of latency SLO capacity search
+		size_t sweepCombinationNum{0}; // 1-based current param sweep combination (0 for none)
+		SweepResultVec sweepResultsVec; // results of all phases of all param sweep combinations
+		SteadyStateDetector steadyStateDetector; // fed by live stats loops during precond soak
+		ThroughputStability throughputStability; // fed by live stats loops for phase results
 
 		void disableConsoleBuffering();
 		void resetConsoleBuffering();
@@ -154,7 +220,13 @@ class Statistics
 			std::string latTypeStr, std::ostream& outStream);
 		void printPhaseResultsLatencyToStringVec(const LatencyHistogram& latHisto,
 			std::string latTypeStr, StringVec& outLabelsVec, StringVec& outResultsVec);
+		static std::vector<double> getLatencyPercentagesVec(unsigned numPercentile9s);
 		void printPhaseResultsAsJSON(const PhaseResults& phaseResults);
+		void updateSLOSearchStep(const PhaseResults& phaseResults);
+		std::string getSLOSearchValueStr(uint64_t searchValue);
+		void printSLOSearchSummaryToStream(const SLOSearchStepVec& stepsVec,
+			const SLOSearchStep* capacityStep, std::ostream& outStream);
+		void printSweepSummaryToStream(std::ostream& outStream);
 
 		void printLiveCountdownLine(unsigned long long waittimeSec);
 
@@ -181,9 +253,17 @@ class Statistics
 
 		void printDryRunPhaseInfo(BenchPhase benchPhase);
 		void printDryRunInfoNetBench();
+		void printDryRunCompressInfo();
 
 		void prepLiveCSVFile();
 		void printLiveStatsCSV(const LiveResults& liveResults);
+		static void addLivePercentilesCSV(std::ostream& outStream, const HdrHistogram& latHisto);
+
+		void prepLiveTimeSeriesFile();
+		void printLiveStatsTimeSeries(LiveResults& liveResults);
+		static void setLiveTimeSeriesLatency(const HdrHistogram& latHisto,
+			uint64_t numAvgLatValues, uint64_t avgLatMicroSec, uint32_t& outAvgMicroSec,
+			uint32_t* outPercentilesMicroSec);
 
         bool checkIfVec2DLeftElemEquals(std::vector<StringVec>& vec, int row, int column,
             const char* value);
@@ -198,6 +278,60 @@ class Statistics
 			liveCpuUtil.update();
 		}
 
+		/**
+		 * To be called by coordinator before each phase of a latency SLO capacity search. The
+		 * results of the phase will be added to the given step by printPhaseResults().
+		 *
+		 * @stepNum 1-based number of the step; 0 to indicate that no search is running.
+		 * @searchValue total IOPS limit (0 for unlimited) or IO depth of this step.
+		 */
+		void setSLOSearchStep(size_t stepNum, uint64_t searchValue)
+		{
+			sloSearchStep = {};
+			sloSearchStep.stepNum = stepNum;
+			sloSearchStep.searchValue = searchValue;
+		}
+
+		const SLOSearchStep& getSLOSearchStep() const
+		{
+			return sloSearchStep;
+		}
+
+		/**
+		 * To be called by coordinator before the phases of a parameter sweep combination. The
+		 * results of the phases will be added to the sweep results by printPhaseResults().
+		 *
+		 * @combinationNum 1-based number of the combination; 0 to indicate that no sweep is
+		 * 	running.
+		 */
+		void setSweepCombinationNum(size_t combinationNum)
+		{
+			sweepCombinationNum = combinationNum;
+		}
+
+		/**
+		 * To be called by coordinator before the preconditioning soak phase. The live stats loops
+		 * will interrupt the phase like an expired time limit when steady state is reached.
+		 */
+		void startSteadyStateDetection()
+		{
+			steadyStateDetector.initStart(progArgs.getSteadyStateRoundSecs(),
+				progArgs.getSteadyStateWindowRounds() );
+		}
+
+		/**
+		 * To be called by coordinator after the preconditioning soak phase.
+		 */
+		void stopSteadyStateDetection()
+		{
+			steadyStateDetector.stop();
+		}
+
+		const SteadyStateDetector& getSteadyStateDetector() const
+		{
+			return steadyStateDetector;
+		}
+
 };
 
 #endif /* STATISTICS_H_ */
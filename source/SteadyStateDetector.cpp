@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <cmath>
+#include "SteadyStateDetector.h"
+
+/**
+ * Reset and enable detection. To be called before a new phase starts.
+ *
+ * @roundSecs duration of a round in seconds.
+ * @windowNumRounds number of rounds in the measurement window; at least 2.
+ */
+void SteadyStateDetector::initStart(size_t roundSecs, size_t windowNumRounds)
+{
+	this->roundMS = roundSecs * 1000;
+	this->windowNumRounds = windowNumRounds;
+
+	isActive = true;
+	isSteady = false;
+	roundsVec.clear();
+
+	currentRoundMS = 0;
+	currentRoundIOPSSum = 0;
+	currentRoundLatSum = 0;
+}
+
+/**
+ * Add values of a live stats interval. Completes the current round when its duration is reached
+ * and checks the measurement window for steady state.
+ *
+ * @elapsedMS duration of the interval.
+ * @iopsPerSec IOPS of the interval.
+ * @avgLatUSec average IO latency of the interval.
+ * @return true if steady state has been reached with this interval, false otherwise (also if it
+ * 	has been reached before or if detection is not active).
+ */
+bool SteadyStateDetector::addInterval(size_t elapsedMS, uint64_t iopsPerSec, uint64_t avgLatUSec)
+{
+	if(!isActive || isSteady)
+		return false;
+
+	currentRoundMS += elapsedMS;
+	currentRoundIOPSSum += (double)iopsPerSec * elapsedMS;
+	currentRoundLatSum += (double)avgLatUSec * elapsedMS;
+
+	if(currentRoundMS < roundMS)
+		return false;
+
+	roundsVec.push_back(Round{currentRoundIOPSSum / currentRoundMS,
+		currentRoundLatSum / currentRoundMS} );
+
+	currentRoundMS = 0;
+	currentRoundIOPSSum = 0;
+	currentRoundLatSum = 0;
+
+	isSteady = checkWindowSteady();
+
+	return isSteady;
+}
+
+/**
+ * Check if the last windowNumRounds rounds are in steady state for IOPS and latency.
+ */
+bool SteadyStateDetector::checkWindowSteady() const
+{
+	if(roundsVec.size() < windowNumRounds)
+		return false;
+
+	std::vector<double> iopsVec;
+	std::vector<double> latVec;
+
+	for(size_t i = roundsVec.size() - windowNumRounds; i < roundsVec.size(); i++)
+	{
+		iopsVec.push_back(roundsVec[i].iopsPerSec);
+		latVec.push_back(roundsVec[i].avgLatUSec);
+	}
+
+	return checkValuesSteady(iopsVec) && checkValuesSteady(latVec);
+}
+
+/**
+ * Check SNIA PTS steady state criteria for the values of a measurement window: The range of the
+ * values and the change of the least squares linear fit across the window must stay within the
+ * given percentages of the window average.
+ *
+ * @valuesVec values of the measurement window in the order of the rounds; at least 2.
+ */
+bool SteadyStateDetector::checkValuesSteady(const std::vector<double>& valuesVec)
+{
+	const size_t numValues = valuesVec.size();
+
+	double sumX = 0;
+	double sumY = 0;
+	double sumXY = 0;
+	double sumXX = 0;
+	double minY = valuesVec[0];
+	double maxY = valuesVec[0];
+
+	for(size_t x = 0; x < numValues; x++)
+	{
+		const double y = valuesVec[x];
+
+		sumX += x;
+		sumY += y;
+		sumXY += x * y;
+		sumXX += (double)x * x;
+		minY = std::min(minY, y);
+		maxY = std::max(maxY, y);
+	}
+
+	const double avgY = sumY / numValues;
+
+	if(avgY <= 0)
+		return false; // no IOs done in window
+
+	// data excursion
+
+	if( (maxY - minY) > (avgY * STEADYSTATE_MAX_EXCURSION_PCT / 100) )
+		return false;
+
+	// slope excursion
+
+	const double slope = ( (numValues * sumXY) - (sumX * sumY) ) /
+		( (numValues * sumXX) - (sumX * sumX) );
+
+	if(std::fabs(slope * (numValues - 1) ) > (avgY * STEADYSTATE_MAX_SLOPE_PCT / 100) )
+		return false;
+
+	return true;
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef STEADYSTATEDETECTOR_H_
+#define STEADYSTATEDETECTOR_H_
+
+#include <algorithm>
+#include <vector>
+#include "Common.h"
+
+#define STEADYSTATE_MAX_EXCURSION_PCT	20 // max-min of window in % of window average (SNIA PTS)
+#define STEADYSTATE_MAX_SLOPE_PCT		10 // best linear fit change across window in % of avg
+
+
+/**
+ * Steady state detection in the style of the SNIA Performance Test Specification: Live stats
+ * intervals get aggregated into rounds of fixed duration. Steady state is reached when the last
+ * rounds in the measurement window stay within the data excursion and slope excursion limits, both
+ * for IOPS and for average latency.
+ */
+class SteadyStateDetector
+{
+	public:
+		void initStart(size_t roundSecs, size_t windowNumRounds);
+		bool addInterval(size_t elapsedMS, uint64_t iopsPerSec, uint64_t avgLatUSec);
+
+	private:
+		/**
+		 * Time-weighted averages of a completed round.
+		 */
+		struct Round
+		{
+			double iopsPerSec;
+			double avgLatUSec;
+		};
+
+		bool isActive{false}; // false if detection is disabled
+		bool isSteady{false}; // true after steady state has been reached
+		size_t roundMS{0}; // duration of a round in milliseconds
+		size_t windowNumRounds{0}; // number of rounds in the measurement window
+		std::vector<Round> roundsVec; // all completed rounds
+
+		size_t currentRoundMS{0}; // elapsed time of the current (incomplete) round
+		double currentRoundIOPSSum{0}; // sum of iopsPerSec*elapsedMS of current round
+		double currentRoundLatSum{0}; // sum of avgLatUSec*elapsedMS of current round
+
+		bool checkWindowSteady() const;
+		static bool checkValuesSteady(const std::vector<double>& valuesVec);
+
+	// inliners
+	public:
+		/**
+		 * Disable detection, e.g. at the end of a phase.
+		 */
+		void stop()
+		{
+			isActive = false;
+		}
+
+		bool getIsActive() const { return isActive; }
+		bool getIsSteady() const { return isSteady; }
+		size_t getNumRounds() const { return roundsVec.size(); }
+
+		/**
+		 * @return avg IOPS of the rounds in the measurement window (or of all rounds if there are
+		 * 	less rounds than the window size); 0 if no round completed.
+		 */
+		double getWindowAvgIOPS() const
+		{
+			if(roundsVec.empty() )
+				return 0;
+
+			const size_t numWindowRounds = std::min(windowNumRounds, roundsVec.size() );
+			double sum = 0;
+
+			for(size_t i = roundsVec.size() - numWindowRounds; i < roundsVec.size(); i++)
+				sum += roundsVec[i].iopsPerSec;
+
+			return sum / numWindowRounds;
+		}
+};
+
+#endif /* STEADYSTATEDETECTOR_H_ */
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <cmath>
+#include "ThroughputStability.h"
+
+/**
+ * Reset for a new phase.
+ *
+ * @useBytes true if the added values will be bytes per sec, false for entries per sec.
+ * @dipPercent intervals with throughput below this percentage of the mean count as dip for
+ * 	getLongestDipMS().
+ */
+void ThroughputStability::initStart(bool useBytes, unsigned dipPercent)
+{
+	this->useBytes = useBytes;
+	this->dipPercent = dipPercent;
+
+	intervalsVec.clear();
+}
+
+/**
+ * Add throughput of a live stats interval.
+ *
+ * @intervalMS duration of the interval.
+ * @valuePerSec bytes or entries per sec in this interval.
+ */
+void ThroughputStability::addInterval(size_t intervalMS, uint64_t valuePerSec)
+{
+	intervalsVec.push_back(Interval{intervalMS, valuePerSec} );
+}
+
+/**
+ * Get throughput percentile of intervals (nearest rank).
+ *
+ * @percentage 0 for min, 100 for max.
+ * @return 0 if no intervals.
+ */
+uint64_t ThroughputStability::getPercentile(double percentage) const
+{
+	if(intervalsVec.empty() )
+		return 0;
+
+	std::vector<uint64_t> valuesVec;
+	valuesVec.reserve(intervalsVec.size() );
+
+	for(const Interval& interval : intervalsVec)
+		valuesVec.push_back(interval.valuePerSec);
+
+	std::sort(valuesVec.begin(), valuesVec.end() );
+
+	size_t rank = (size_t)std::ceil(percentage / 100 * valuesVec.size() );
+
+	return valuesVec[std::min(rank ? (rank - 1) : 0, valuesVec.size() - 1)];
+}
+
+/**
+ * @return time-weighted mean throughput of intervals; 0 if no intervals.
+ */
+double ThroughputStability::getMean() const
+{
+	double weightedSum = 0;
+	size_t totalMS = 0;
+
+	for(const Interval& interval : intervalsVec)
+	{
+		weightedSum += (double)interval.valuePerSec * interval.durationMS;
+		totalMS += interval.durationMS;
+	}
+
+	return totalMS ? (weightedSum / totalMS) : 0;
+}
+
+/**
+ * @return time-weighted standard deviation in percent of the mean; 0 if mean is 0.
+ */
+double ThroughputStability::getCoefficientOfVariationPercent() const
+{
+	const double mean = getMean();
+
+	if(!mean)
+		return 0;
+
+	double weightedSquareDiffSum = 0;
+	size_t totalMS = 0;
+
+	for(const Interval& interval : intervalsVec)
+	{
+		const double diff = interval.valuePerSec - mean;
+
+		weightedSquareDiffSum += diff * diff * interval.durationMS;
+		totalMS += interval.durationMS;
+	}
+
+	return 100 * std::sqrt(weightedSquareDiffSum / totalMS) / mean;
+}
+
+/**
+ * @return longest duration of consecutive intervals with throughput below dipPercent of the mean.
+ */
+size_t ThroughputStability::getLongestDipMS() const
+{
+	const double dipThreshold = getMean() * dipPercent / 100;
+
+	size_t longestDipMS = 0;
+	size_t currentDipMS = 0;
+
+	for(const Interval& interval : intervalsVec)
+	{
+		if(interval.valuePerSec >= dipThreshold)
+		{
+			currentDipMS = 0;
+			continue;
+		}
+
+		currentDipMS += interval.durationMS;
+		longestDipMS = std::max(longestDipMS, currentDipMS);
+	}
+
+	return longestDipMS;
+}
+
+/**
+ * Jain's fairness index: (sum x)^2 / (n * sum x^2). 1 means all values are equal, 1/n means that
+ * a single value got everything.
+ *
+ * @valuesVec e.g. bytes done by each worker.
+ * @return fairness index; 1 if valuesVec is empty or all values are 0.
+ */
+double ThroughputStability::getFairnessIndex(const std::vector<uint64_t>& valuesVec)
+{
+	double sum = 0;
+	double squareSum = 0;
+
+	for(uint64_t value : valuesVec)
+	{
+		sum += value;
+		squareSum += (double)value * value;
+	}
+
+	if(!squareSum)
+		return 1;
+
+	return (sum * sum) / (valuesVec.size() * squareSum);
+}
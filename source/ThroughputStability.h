@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef THROUGHPUTSTABILITY_H_
+#define THROUGHPUTSTABILITY_H_
+
+#include <vector>
+#include "Common.h"
+
+
+/**
+ * Throughput stability metrics of a benchmark phase, based on the per-sec throughput of the live
+ * stats intervals: min/max/percentiles, coefficient of variation and the longest time window in
+ * which throughput stayed below a given percentage of the mean. Two systems with the same average
+ * throughput can differ a lot in jitter, which these metrics make visible.
+ */
+class ThroughputStability
+{
+	public:
+		void initStart(bool useBytes, unsigned dipPercent);
+		void addInterval(size_t intervalMS, uint64_t valuePerSec);
+
+		uint64_t getPercentile(double percentage) const;
+		double getMean() const;
+		double getCoefficientOfVariationPercent() const;
+		size_t getLongestDipMS() const;
+
+		static double getFairnessIndex(const std::vector<uint64_t>& valuesVec);
+
+	private:
+		/**
+		 * A single live stats interval.
+		 */
+		struct Interval
+		{
+			size_t durationMS;
+			uint64_t valuePerSec; // bytes or entries per sec
+		};
+
+		bool useBytes{false}; // true if values are bytes per sec, false for entries per sec
+		unsigned dipPercent{0}; // intervals below this % of the mean count as dip
+		std::vector<Interval> intervalsVec; // all intervals of the current phase
+
+	// inliners
+	public:
+		bool getUseBytes() const { return useBytes; }
+		unsigned getDipPercent() const { return dipPercent; }
+		size_t getNumIntervals() const { return intervalsVec.size(); }
+
+		uint64_t getMin() const { return getPercentile(0); }
+		uint64_t getMax() const { return getPercentile(100); }
+};
+
+#endif /* THROUGHPUTSTABILITY_H_ */
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "toolkits/CompressTk.h"
+
+#define COMPRESSTK_WINDOW_LEN		(64*1024) // max back reference distance (like lz4)
+#define COMPRESSTK_HASH_BITS		14 // number of bits for hash table of 4 byte sequences
+#define COMPRESSTK_MIN_MATCH_LEN	4 // min length of back reference
+
+
+/**
+ * Estimate the size of the given buffer after LZ compression. The estimate is based on a greedy
+ * single-pass match finder with lz4 sequence encoding cost (token, literal length, literals,
+ * 2 byte offset, match length), so it's a fast approximation of what lz4 would achieve. Stronger
+ * compressors with entropy coding (e.g. zstd) typically achieve slightly better ratios.
+ *
+ * Buffers larger than the compressor window are handled as independent pieces of window size.
+ *
+ * @return estimated number of bytes after compression.
+ */
+uint64_t CompressTk::estimateLZCompressedLen(const char* buf, size_t bufLen)
+{
+	uint64_t compressedLen = 0;
+
+	for(size_t pieceStart = 0; pieceStart < bufLen; pieceStart += COMPRESSTK_WINDOW_LEN)
+	{
+		const size_t pieceLen = std::min(bufLen - pieceStart, (size_t)COMPRESSTK_WINDOW_LEN);
+
+		compressedLen += estimateLZCompressedLenWindow(&buf[pieceStart], pieceLen);
+	}
+
+	return compressedLen;
+}
+
+/**
+ * Estimate the compression ratio of the given buffer, e.g. 2.0 for "2:1".
+ *
+ * @return estimated ratio; 1.0 for empty buffer.
+ */
+double CompressTk::estimateLZRatio(const char* buf, size_t bufLen)
+{
+	const uint64_t compressedLen = estimateLZCompressedLen(buf, bufLen);
+
+	if(!bufLen || !compressedLen)
+		return 1;
+
+	return (double)bufLen / compressedLen;
+}
+
+/**
+ * Estimate compressed size for a buffer that is not larger than the compressor window.
+ */
+uint64_t CompressTk::estimateLZCompressedLenWindow(const char* buf, size_t bufLen)
+{
+	const size_t hashTableSize = (1 << COMPRESSTK_HASH_BITS);
+	const size_t noPos = ~(size_t)0;
+
+	std::vector<size_t> hashTable(hashTableSize, noPos); // last position of 4 byte sequence
+
+	uint64_t compressedLen = 0;
+	size_t literalStart = 0; // start of pending literals
+	size_t pos = 0;
+
+	// cost of a literal or match length field in lz4 sequence encoding (15 fits in token nibble)
+	auto lengthFieldCost = [](size_t len) -> uint64_t
+		{ return (len < 15) ? 0 : (1 + ( (len - 15) / 255) ); };
+
+	while( (pos + COMPRESSTK_MIN_MATCH_LEN) <= bufLen)
+	{
+		uint32_t sequence;
+		memcpy(&sequence, &buf[pos], sizeof(sequence) );
+
+		const size_t hashIdx = (sequence * 2654435761U) >> (32 - COMPRESSTK_HASH_BITS);
+		const size_t matchPos = hashTable[hashIdx];
+
+		hashTable[hashIdx] = pos;
+
+		if( (matchPos == noPos) || memcmp(&buf[matchPos], &buf[pos], COMPRESSTK_MIN_MATCH_LEN) )
+		{ // no match
+			pos++;
+			continue;
+		}
+
+		// extend match (can overlap with current position, as in LZ decoding)
+
+		size_t matchLen = COMPRESSTK_MIN_MATCH_LEN;
+
+		while( ( (pos + matchLen) < bufLen) && (buf[matchPos + matchLen] == buf[pos + matchLen]) )
+			matchLen++;
+
+		const size_t literalLen = pos - literalStart;
+
+		// token + literal length + literals + offset + match length
+		compressedLen += 1 + lengthFieldCost(literalLen) + literalLen + 2 +
+			lengthFieldCost(matchLen - COMPRESSTK_MIN_MATCH_LEN);
+
+		pos += matchLen;
+		literalStart = pos;
+	}
+
+	// last literals
+
+	const size_t lastLiteralLen = bufLen - literalStart;
+
+	if(lastLiteralLen)
+		compressedLen += 1 + lengthFieldCost(lastLiteralLen) + lastLiteralLen;
+
+	return compressedLen;
+}
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_COMPRESSTK_H_
+#define TOOLKITS_COMPRESSTK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Toolkit to estimate data compressibility.
+ */
+class CompressTk
+{
+	public:
+		static uint64_t estimateLZCompressedLen(const char* buf, size_t bufLen);
+		static double estimateLZRatio(const char* buf, size_t bufLen);
+
+	private:
+		CompressTk() {}
+
+		static uint64_t estimateLZCompressedLenWindow(const char* buf, size_t bufLen);
+};
+
+#endif /* TOOLKITS_COMPRESSTK_H_ */
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_OPENLOOPSCHEDULER_H_
+#define TOOLKITS_OPENLOOPSCHEDULER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "Common.h"
+#include "OpenLoopStats.h"
+#include "toolkits/random/RandAlgoXoshiro256ss.h"
+
+#define OPENLOOP_MAX_SLEEP_MS		100 // max sleep per round to check for interruption requests
+
+
+/**
+ * Arrival schedule for open-loop load generation. Ops are intended to be issued at a fixed rate
+ * (same interval between all ops) or with Poisson arrivals (exponentially distributed intervals
+ * with the same mean), independent of how long previous ops took to complete.
+ *
+ * The intended issue time is the reference for the latency that users of a service would see
+ * (response time), so that a slow op which delays the following ops does not hide their waiting
+ * time (coordinated omission).
+ */
+class OpenLoopScheduler
+{
+	private:
+		uint64_t opsPerSec{0}; // 0 means open-loop is disabled
+		bool usePoissonArrivals{false}; // false for fixed interval
+		double meanIntervalNanoSec{0};
+		std::chrono::steady_clock::time_point startT; // intended issue time of first op
+		uint64_t numOpsScheduled{0}; // number of ops that got their intended time popped
+		double nextOffsetNanoSec{0}; // intended time of next op, relative to startT
+		RandAlgoXoshiro256ss randAlgo{0}; // for poisson arrivals (reseeded in initStart() )
+
+		/**
+		 * Calculate the offset of the next op after numOpsScheduled got incremented.
+		 */
+		void calcNextOffset()
+		{
+			if(!usePoissonArrivals)
+			{ // multiply instead of sum up to avoid accumulation of rounding errors
+				nextOffsetNanoSec = numOpsScheduled * meanIntervalNanoSec;
+				return;
+			}
+
+			// exponentially distributed interval via inverse transform of uniform in (0,1]
+			const double uniformVal = ( (randAlgo.next() >> 11) + 1) * (1.0 / (1ULL << 53) );
+
+			nextOffsetNanoSec += -std::log(uniformVal) * meanIntervalNanoSec;
+		}
+
+	// inliners
+	public:
+		/**
+		 * @opsPerSec target rate; 0 disables open-loop.
+		 * @usePoissonArrivals true for exponentially distributed intervals, false for fixed.
+		 * @seed seed for poisson arrivals, so that each worker gets its own sequence.
+		 */
+		void initStart(uint64_t opsPerSec, bool usePoissonArrivals, uint64_t seed)
+		{
+			this->opsPerSec = opsPerSec;
+			this->usePoissonArrivals = usePoissonArrivals;
+			this->meanIntervalNanoSec = opsPerSec ? (1e9 / opsPerSec) : 0;
+			this->startT = std::chrono::steady_clock::now();
+			this->numOpsScheduled = 0;
+			this->nextOffsetNanoSec = 0;
+
+			randAlgo.reseed(seed);
+		}
+
+		bool isEnabled() const { return opsPerSec != 0; }
+
+		std::chrono::steady_clock::time_point getNextIntendedT() const
+		{
+			return startT + std::chrono::nanoseconds( (uint64_t)nextOffsetNanoSec);
+		}
+
+		/**
+		 * Take the intended time of the next op from the schedule and update backlog stats. The
+		 * caller is expected to issue the op now.
+		 *
+		 * @nowT current time as reference for the backlog.
+		 * @return intended issue time of the op.
+		 */
+		std::chrono::steady_clock::time_point popNextIntendedT(
+			std::chrono::steady_clock::time_point nowT, OpenLoopStats& outStats)
+		{
+			const std::chrono::steady_clock::time_point intendedT = getNextIntendedT();
+
+			outStats.numOps++;
+
+			IF_UNLIKELY(nowT > intendedT)
+			{ // we are behind schedule => number of other ops that are due is our backlog
+				const uint64_t backlog = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					nowT - intendedT).count() / meanIntervalNanoSec;
+
+				if(backlog)
+					outStats.numLateOps++;
+
+				if(backlog > outStats.maxBacklog)
+					outStats.maxBacklog = backlog;
+			}
+
+			numOpsScheduled++;
+			calcNextOffset();
+
+			return intendedT;
+		}
+
+		/**
+		 * Sleep until the intended time of the next op (if it's in the future).
+		 *
+		 * @isInterruptionRequested sleep gets cancelled if this becomes true, so caller should
+		 * 	check for interruption after return.
+		 * @return current time after the wait.
+		 */
+		std::chrono::steady_clock::time_point waitForNextIntendedT(
+			const std::atomic_bool& isInterruptionRequested) const
+		{
+			const std::chrono::steady_clock::time_point intendedT = getNextIntendedT();
+			std::chrono::steady_clock::time_point nowT = std::chrono::steady_clock::now();
+
+			while( (nowT < intendedT) && !isInterruptionRequested)
+			{
+				std::this_thread::sleep_until(std::min(intendedT,
+					nowT + std::chrono::milliseconds(OPENLOOP_MAX_SLEEP_MS) ) );
+
+				nowT = std::chrono::steady_clock::now();
+			}
+
+			return nowT;
+		}
+
+		/**
+		 * Sleep until the intended time of the next op (if it's in the future) and take it from
+		 * the schedule.
+		 *
+		 * @isInterruptionRequested sleep gets cancelled if this becomes true, so caller should
+		 * 	check for interruption after return.
+		 * @return intended issue time of the op.
+		 */
+		std::chrono::steady_clock::time_point waitAndPopNextIntendedT(
+			const std::atomic_bool& isInterruptionRequested, OpenLoopStats& outStats)
+		{
+			const std::chrono::steady_clock::time_point nowT =
+				waitForNextIntendedT(isInterruptionRequested);
+
+			return popNextIntendedT(nowT, outStats);
+		}
+
+		/**
+		 * Get the number of ops that are due at the given time, e.g. to decide how many async IOs
+		 * to submit. This does not modify the schedule.
+		 *
+		 * @maxNumOps stop counting when this number is reached.
+		 */
+		size_t getNumDue(std::chrono::steady_clock::time_point nowT, size_t maxNumOps) const
+		{
+			OpenLoopScheduler peekScheduler(*this);
+			size_t numDue = 0;
+
+			while( (numDue < maxNumOps) && (peekScheduler.getNextIntendedT() <= nowT) )
+			{
+				numDue++;
+				peekScheduler.numOpsScheduled++;
+				peekScheduler.calcNextOffset();
+			}
+
+			return numDue;
+		}
+
+		/**
+		 * Get the time until the next op is due; 0 if it is already due.
+		 */
+		uint64_t getNanoSecUntilNextIntendedT(std::chrono::steady_clock::time_point nowT) const
+		{
+			const std::chrono::steady_clock::time_point intendedT = getNextIntendedT();
+
+			if(nowT >= intendedT)
+				return 0;
+
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(intendedT - nowT).count();
+		}
+};
+
+#endif /* TOOLKITS_OPENLOOPSCHEDULER_H_ */
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_OPSLOGRINGBUFFER_H_
+#define TOOLKITS_OPSLOGRINGBUFFER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include "Common.h"
+
+
+/**
+ * Lock-free single producer, single consumer ring buffer of bytes for the binary ops log. The
+ * producer is the worker thread that logs ops, the consumer is the background writer thread.
+ * Records get copied in and out as plain bytes, so they may wrap around the end of the buffer.
+ */
+class OpsLogRingBuffer
+{
+	public:
+		/**
+		 * @size buffer size in bytes; must be a power of 2.
+		 */
+		void init(size_t size)
+		{
+			buf.resize(size);
+			sizeMask = size - 1;
+			head = 0;
+			tail = 0;
+		}
+
+		/**
+		 * Copy data into the buffer. To be called by the producer only.
+		 *
+		 * @return false if there is not enough free space in the buffer.
+		 */
+		bool tryPush(const void* data, size_t len)
+		{
+			const uint64_t currentHead = head.load(std::memory_order_relaxed);
+			const uint64_t currentTail = tail.load(std::memory_order_acquire);
+
+			if( (buf.size() - (currentHead - currentTail) ) < len)
+				return false; // not enough free space
+
+			copyIn(currentHead, (const char*)data, len);
+
+			head.store(currentHead + len, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 * Append all currently available data to outVec. To be called by the consumer only.
+		 *
+		 * @return number of bytes appended.
+		 */
+		size_t popAll(std::vector<char>& outVec)
+		{
+			const uint64_t currentTail = tail.load(std::memory_order_relaxed);
+			const uint64_t currentHead = head.load(std::memory_order_acquire);
+			const size_t len = currentHead - currentTail;
+
+			if(!len)
+				return 0;
+
+			const size_t outOffset = outVec.size();
+			outVec.resize(outOffset + len);
+
+			copyOut(currentTail, &outVec[outOffset], len);
+
+			tail.store(currentHead, std::memory_order_release);
+
+			return len;
+		}
+
+		/**
+		 * @return number of used bytes; only a snapshot if called concurrently to push/pop.
+		 */
+		size_t getNumUsed() const
+		{
+			return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed);
+		}
+
+		size_t getSize() const { return buf.size(); }
+
+	private:
+		std::vector<char> buf;
+		size_t sizeMask{0}; // buf.size() - 1 for fast modulo
+		std::atomic_uint64_t head{0}; // total bytes pushed (written by producer)
+		std::atomic_uint64_t tail{0}; // total bytes popped (written by consumer)
+
+		void copyIn(uint64_t pos, const char* data, size_t len)
+		{
+			const size_t bufOffset = pos & sizeMask;
+			const size_t firstLen = std::min(len, buf.size() - bufOffset);
+
+			memcpy(&buf[bufOffset], data, firstLen);
+			memcpy(buf.data(), data + firstLen, len - firstLen); // wrapped part (if any)
+		}
+
+		void copyOut(uint64_t pos, char* outData, size_t len) const
+		{
+			const size_t bufOffset = pos & sizeMask;
+			const size_t firstLen = std::min(len, buf.size() - bufOffset);
+
+			memcpy(outData, &buf[bufOffset], firstLen);
+			memcpy(outData + firstLen, buf.data(), len - firstLen); // wrapped part (if any)
+		}
+};
+
+#endif /* TOOLKITS_OPSLOGRINGBUFFER_H_ */
@@ -1,21 +1,249 @@
 // SPDX-FileCopyrightText: 2020-2025 Sven Breuner and elbencho contributors
 // SPDX-License-Identifier: GPL-3.0-only
 
+#include <condition_variable>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <tuple>
 #include "OpsLogger.h"
 #include "ProgArgs.h"
+#include "ProgException.h"
+
+static_assert(sizeof(OpsLogBinFileHeader) == 16, "Unexpected binary ops log file header size");
+static_assert(sizeof(OpsLogBinRecordHeader) == 8, "Unexpected binary ops log record header size");
+static_assert(sizeof(OpsLogBinName) == 16, "Unexpected binary ops log name record size");
+static_assert(sizeof(OpsLogBinOp) == 64, "Unexpected binary ops log op record size");
+
+
+/**
+ * Background writer for the binary ops log. Drains the ring buffers of all registered loggers
+ * every OPSLOGBIN_FLUSH_INTERVAL_MS (or earlier when a logger notifies that its buffer is getting
+ * full) and appends their contents to the log file with a single write.
+ *
+ * The writer thread gets started on first registration. The log file gets closed and the writer
+ * thread gets stopped when the last logger unregisters, so that no thread is left waiting on the
+ * static condition variable at process exit.
+ */
+class OpsLogBinWriter
+{
+	public:
+		static void registerRingBuf(const std::string& path, OpsLogRingBuffer* ringBuf);
+		static void unregisterRingBuf(OpsLogRingBuffer* ringBuf);
+
+		/**
+		 * Wake up writer thread to drain ring buffers before the flush interval expires.
+		 */
+		static void notifyWriter()
+		{
+			condition.notify_one();
+		}
+
+	private:
+		static std::mutex mutex; // protects all static members below
+		static std::condition_variable condition; // to wake up the writer thread
+		static std::vector<OpsLogRingBuffer*> ringBufVec; // ring bufs of registered loggers
+		static std::vector<char> writeBuf; // drained ring buffer contents for next write
+		static int fd; // log file fd; -1 if no loggers registered
+		static std::thread writerThread;
+		static unsigned writerGeneration; // incremented to tell current writer thread to exit
+
+		static void openLogFileUnlocked(const std::string& path);
+		static void drainAllUnlocked();
+		static void writerThreadLoop(unsigned generation);
+};
+
+std::mutex OpsLogBinWriter::mutex;
+std::condition_variable OpsLogBinWriter::condition;
+std::vector<OpsLogRingBuffer*> OpsLogBinWriter::ringBufVec;
+std::vector<char> OpsLogBinWriter::writeBuf;
+int OpsLogBinWriter::fd = -1;
+std::thread OpsLogBinWriter::writerThread;
+unsigned OpsLogBinWriter::writerGeneration = 0;
+
+/**
+ * Register a logger's ring buffer for draining. Opens the log file if this is the first logger.
+ *
+ * @throw WorkerException if log file can't be opened or is not a binary ops log.
+ */
+void OpsLogBinWriter::registerRingBuf(const std::string& path, OpsLogRingBuffer* ringBuf)
+{
+	std::unique_lock<std::mutex> lock(mutex); // L O C K (scoped)
+
+	if(fd == -1)
+		openLogFileUnlocked(path);
+
+	ringBufVec.push_back(ringBuf);
+
+	if(!writerThread.joinable() )
+		writerThread = std::thread(writerThreadLoop, writerGeneration);
+}
+
+/**
+ * Write remaining records of the given ring buffer and stop draining it. Closes the log file if
+ * this was the last registered logger.
+ */
+void OpsLogBinWriter::unregisterRingBuf(OpsLogRingBuffer* ringBuf)
+{
+	std::unique_lock<std::mutex> lock(mutex); // L O C K
+
+
+	drainAllUnlocked();
+
+	for(auto iter = ringBufVec.begin(); iter != ringBufVec.end(); iter++)
+	{
+		if(*iter == ringBuf)
+		{
+			ringBufVec.erase(iter);
+			break;
+		}
+	}
+
+	if(!ringBufVec.empty() )
+		return;
+
+	if(fd != -1)
+	{
+		close(fd);
+		fd = -1;
+	}
+
+	// stop writer thread (join without lock, because it needs the lock to see the stop request)
+
+	std::thread stoppingThread(std::move(writerThread) );
+
+	writerGeneration++;
+	condition.notify_all();
+
+	lock.unlock(); // U N L O C K
+
+	if(stoppingThread.joinable() )
+		stoppingThread.join();
+}
+
+/**
+ * Open log file for appending. Writes the file header if the file is empty, otherwise checks that
+ * the existing file is a compatible binary ops log.
+ *
+ * @throw WorkerException on error.
+ */
+void OpsLogBinWriter::openLogFileUnlocked(const std::string& path)
+{
+	fd = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, OPSLOGFILE_MODE);
+
+	if(fd == -1)
+		throw WorkerException("Unable to open ops log file: " + path + "; "
+			"SysErr: " + strerror(errno) );
+
+	OpsLogBinFileHeader fileHeader;
+	memset(&fileHeader, 0, sizeof(fileHeader) );
+
+	ssize_t readRes = pread(fd, &fileHeader, sizeof(fileHeader), 0);
+
+	if(readRes == 0)
+	{ // new file => write header
+		memcpy(fileHeader.magic, OPSLOGBIN_MAGIC, sizeof(fileHeader.magic) );
+		fileHeader.version = OPSLOGBIN_VERSION;
+		fileHeader.byteOrderMark = OPSLOGBIN_BYTEORDERMARK;
+
+		if(write(fd, &fileHeader, sizeof(fileHeader) ) == sizeof(fileHeader) )
+			return;
+	}
+	else
+	if( (readRes == sizeof(fileHeader) ) &&
+		!memcmp(fileHeader.magic, OPSLOGBIN_MAGIC, sizeof(fileHeader.magic) ) &&
+		(fileHeader.version == OPSLOGBIN_VERSION) &&
+		(fileHeader.byteOrderMark == OPSLOGBIN_BYTEORDERMARK) )
+		return; // existing compatible file
+
+	close(fd);
+	fd = -1;
+
+	throw WorkerException("Existing file is not a compatible binary ops log file or file header "
+		"could not be written: " + path);
+}
+
+/**
+ * Drain all registered ring buffers and write their contents to the log file. Write errors are
+ * ignored like for live stats files, because they shouldn't abort the benchmark.
+ */
+void OpsLogBinWriter::drainAllUnlocked()
+{
+	writeBuf.clear(); // (keeps capacity for next round)
+
+	for(OpsLogRingBuffer* ringBuf : ringBufVec)
+		ringBuf->popAll(writeBuf);
+
+	size_t numBytesWritten = 0;
+
+	while( (fd != -1) && (numBytesWritten < writeBuf.size() ) )
+	{
+		ssize_t writeRes = write(fd, &writeBuf[numBytesWritten],
+			writeBuf.size() - numBytesWritten);
+
+		if(writeRes <= 0)
+			break;
+
+		numBytesWritten += writeRes;
+	}
+}
+
+/**
+ * @generation the writer thread exits when writerGeneration no longer matches this value.
+ */
+void OpsLogBinWriter::writerThreadLoop(unsigned generation)
+{
+	std::unique_lock<std::mutex> lock(mutex); // L O C K (scoped)
+
+	while(generation == writerGeneration)
+	{
+		condition.wait_for(lock, std::chrono::milliseconds(OPSLOGBIN_FLUSH_INTERVAL_MS) );
+
+		if(generation == writerGeneration)
+			drainAllUnlocked();
+	}
+}
+
 
 /**
  * Open the log file. This has to be called before any op can be logged. This is a no-op
  * if ops logging is not enabled or if log file is already open. Log file close is done in
- * constructor but can also be done earlier through closeLogFile().
+ * constructor but can also be done earlier through closeLogFile(). This also enables ops tracing
+ * for worker threads if a trace file is given.
  *
  * @throw WorkerException on error.
  */
 void OpsLogger::openLogFile()
 {
-	if(progArgs->getOpsLogPath().empty() || (logFileFD != -1) )
+	// tracing is independent of ops log; trace events get only collected in worker threads
+	if( (workerRank != -1) && !tracer.isEnabled() )
+		tracer.enable();
+
+	if(progArgs->getOpsLogPath().empty() || (logFileFD != -1) || isBinaryLogOpen)
 		return;
 
+	if(progArgs->getUseOpsLogBinary() )
+	{
+		static std::atomic_uint32_t nextLoggerID(0);
+
+		if(!binRingBuf.getSize() )
+		{ // first open of this logger
+			binRingBuf.init(OPSLOGBIN_RINGBUF_SIZE);
+			binLoggerID = nextLoggerID++;
+		}
+
+		binSampleN = progArgs->getOpsLogSampleN();
+
+		OpsLogBinWriter::registerRingBuf(progArgs->getOpsLogPath(), &binRingBuf);
+
+		isBinaryLogOpen = true;
+
+		return;
+	}
+
 	logFileFD = open(progArgs->getOpsLogPath().c_str(), O_WRONLY | O_CREAT | O_APPEND,
 		OPSLOGFILE_MODE);
 
@@ -31,6 +259,13 @@ void OpsLogger::openLogFile()
  */
 void OpsLogger::closeLogFile()
 {
+	if(isBinaryLogOpen)
+	{
+		OpsLogBinWriter::unregisterRingBuf(&binRingBuf); // (writes remaining records)
+
+		isBinaryLogOpen = false;
+	}
+
 	if(logFileFD == -1)
 		return;
 
@@ -58,27 +293,16 @@ void OpsLogger::closeLogFile()
  *
  * @throw WorkerException on error.
  */
-void OpsLogger::logOpJSON(std::string opName, std::string entryName,
+void OpsLogger::logOpJSON(const std::string& opName, const std::string& entryName,
 	uint64_t offset, uint64_t length, bool isOpFinished, bool isError)
 {
-	if(!isEnabled() )
+	if(logFileFD == -1)
 		return;
 
 	if(progArgs->getUseOpsLogLocking() )
 		flock(logFileFD, LOCK_EX);
 
-	auto now = std::chrono::system_clock::now();
-	time_t time = std::chrono::system_clock::to_time_t(now);
-	auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
-		now.time_since_epoch()).count() % 1000;
-
-    struct tm localTimeInfo;
-    localtime_r(&time, &localTimeInfo);
-
-	std::stringstream dateStream;
-	dateStream << std::put_time(&localTimeInfo, "%FT%T") << "."
-		<< std::setfill('0') << std::setw(3) << milliseconds
-		<< std::put_time(&localTimeInfo, "%z");
+	std::string dateStr = timeToISODateStr(std::chrono::system_clock::now() );
 
 	dprintf(logFileFD,
 		"{ "
@@ -91,10 +315,408 @@ void OpsLogger::logOpJSON(std::string opName, std::string entryName,
 		"\"is_finished\": %s, "
 		"\"is_error\": %s "
 		"}\n",
-		dateStream.str().c_str(), workerRank, opName.c_str(), entryName.c_str(), offset,
+		dateStr.c_str(), workerRank, opName.c_str(), entryName.c_str(), offset,
 		length, isOpFinished ? "true" : "false", isError ? "true" : "false");
 
 	if(progArgs->getUseOpsLogLocking() )
 		flock(logFileFD, LOCK_UN);
 }
 
+/**
+ * Log this operation as binary record to the ring buffer of this logger. This requires a previous
+ * call to openLogFile(). See logOpJSON() for the parameters.
+ *
+ * With sampling, the decision whether to log an op is based on a hash of op name, entry name and
+ * offset, so that pre-op and finished records of the same op get either both logged or both
+ * skipped.
+ *
+ * @opName string literal; name IDs are assigned based on the address.
+ * @errorNum errno value after the op; only logged if isError is true.
+ */
+void OpsLogger::logOpBinary(const char* opName, const std::string& entryName,
+	uint64_t offset, uint64_t length, bool isOpFinished, bool isError, int errorNum)
+{
+	const uint64_t timestampNS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch() ).count();
+
+	// look up name IDs (name records get logged below only if this op gets sampled)
+
+	auto opNameIter = binOpNameMap.find(opName);
+
+	if(opNameIter == binOpNameMap.end() )
+		opNameIter = binOpNameMap.emplace(opName,
+			BinNameID{(uint32_t)binOpNameMap.size(), false} ).first;
+
+	if(entryName != binLastEntryName)
+	{
+		binLastEntryName = entryName;
+		binLastEntryNameID = BinNameID{binNextEntryNameID++, false};
+	}
+
+	// sampling and latency key (splitmix64 finalizer for well distributed bits)
+
+	uint64_t opKey = offset ^
+		( (uint64_t)opNameIter->second.nameID << 48) ^
+		( (uint64_t)binLastEntryNameID.nameID << 16);
+
+	opKey = (opKey ^ (opKey >> 30) ) * 0xbf58476d1ce4e5b9ULL;
+	opKey = (opKey ^ (opKey >> 27) ) * 0x94d049bb133111ebULL;
+	opKey = opKey ^ (opKey >> 31);
+
+	if( (binSampleN > 1) && (opKey % binSampleN) )
+		return; // not sampled
+
+	if(!opNameIter->second.isLogged)
+	{
+		logBinaryName(OPSLOGBIN_RECORD_OPNAME, opNameIter->second.nameID, opName,
+			strlen(opName) );
+		opNameIter->second.isLogged = true;
+	}
+
+	if(!binLastEntryNameID.isLogged)
+	{
+		logBinaryName(OPSLOGBIN_RECORD_ENTRYNAME, binLastEntryNameID.nameID,
+			binLastEntryName.c_str(), binLastEntryName.length() );
+		binLastEntryNameID.isLogged = true;
+	}
+
+	struct
+	{
+		OpsLogBinRecordHeader header;
+		OpsLogBinOp op;
+	} record;
+
+	memset(&record, 0, sizeof(record) );
+
+	record.header.type = OPSLOGBIN_RECORD_OP;
+	record.header.payloadLen = sizeof(record.op);
+
+	record.op.timestampNS = timestampNS;
+	record.op.offset = offset;
+	record.op.length = length;
+	record.op.workerRank = workerRank;
+	record.op.pid = getpid();
+	record.op.loggerID = binLoggerID;
+	record.op.entryNameID = binLastEntryNameID.nameID;
+	record.op.opNameID = opNameIter->second.nameID;
+	record.op.flags = (isOpFinished ? OPSLOGBIN_FLAG_FINISHED : 0) |
+		(isError ? OPSLOGBIN_FLAG_ERROR : 0);
+	record.op.errorNum = isError ? errorNum : 0;
+
+	if(!isOpFinished)
+	{
+		record.op.latencyNS = OPSLOGBIN_UNKNOWN_LATENCY;
+
+		binLastPreOpKey = opKey;
+		binLastPreOpNS = timestampNS;
+	}
+	else
+	{ // (async ops have no finished record, so the last pre-op is the matching one if any)
+		record.op.latencyNS = ( (opKey == binLastPreOpKey) && (timestampNS >= binLastPreOpNS) ) ?
+			(timestampNS - binLastPreOpNS) : OPSLOGBIN_UNKNOWN_LATENCY;
+
+		binLastPreOpKey = 0;
+	}
+
+	pushBinaryRecord(&record, sizeof(record) );
+}
+
+/**
+ * Log a name record (i.e. definition of an op or entry name ID).
+ */
+void OpsLogger::logBinaryName(uint16_t recordType, uint32_t nameID, const char* name,
+	size_t nameLen)
+{
+	nameLen = std::min(nameLen, (size_t)OPSLOGBIN_MAX_NAME_LEN);
+
+	OpsLogBinRecordHeader header;
+	memset(&header, 0, sizeof(header) );
+
+	header.type = recordType;
+	header.payloadLen = sizeof(OpsLogBinName) + nameLen;
+
+	OpsLogBinName nameRecord;
+	nameRecord.pid = getpid();
+	nameRecord.loggerID = binLoggerID;
+	nameRecord.nameID = nameID;
+	nameRecord.nameLen = nameLen;
+
+	binNameRecordBuf.resize(sizeof(header) + header.payloadLen);
+
+	memcpy(binNameRecordBuf.data(), &header, sizeof(header) );
+	memcpy(&binNameRecordBuf[sizeof(header)], &nameRecord, sizeof(nameRecord) );
+	memcpy(&binNameRecordBuf[sizeof(header) + sizeof(nameRecord)], name, nameLen);
+
+	pushBinaryRecord(binNameRecordBuf.data(), binNameRecordBuf.size() );
+}
+
+/**
+ * Add record to ring buffer. If the ring buffer is full, wait for the background writer to drain
+ * it, so that no records get lost.
+ */
+void OpsLogger::pushBinaryRecord(const void* record, size_t recordLen)
+{
+	const size_t numUsedBefore = binRingBuf.getNumUsed();
+
+	while(!binRingBuf.tryPush(record, recordLen) )
+	{
+		OpsLogBinWriter::notifyWriter();
+		std::this_thread::yield();
+	}
+
+	// wake up writer early when the buffer gets half full
+	const size_t halfSize = binRingBuf.getSize() / 2;
+
+	if( (numUsedBefore < halfSize) && ( (numUsedBefore + recordLen) >= halfSize) )
+		OpsLogBinWriter::notifyWriter();
+}
+
+/**
+ * Convert a binary ops log file to the JSON lines format of logOpJSON(). Finished ops with known
+ * latency get an additional "latency_ns" field and failed ops get an additional "errno" field.
+ *
+ * @outStream where to write the JSON lines.
+ * @throw ProgException if the file cannot be read or is not a valid binary ops log.
+ */
+void OpsLogger::convertBinaryToJSON(const std::string& path, std::ostream& outStream)
+{
+	std::ifstream fileStream(path, std::ios::binary);
+	if(!fileStream)
+		throw ProgException("Unable to open binary ops log file: " + path);
+
+	readBinaryLogFile(path, fileStream, [&](const OpsLogEntry& entry)
+	{
+		std::chrono::system_clock::time_point timePoint(
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(
+				std::chrono::nanoseconds(entry.timestampNS) ) );
+
+		outStream << "{ "
+			"\"date\": \"" << timeToISODateStr(timePoint) << "\", "
+			"\"worker_rank\": " << entry.workerRank << ", "
+			"\"op_name\": \"" << entry.opName << "\", "
+			"\"entry_name\": \"" << entry.entryName << "\", "
+			"\"offset\": " << entry.offset << ", "
+			"\"length\": " << entry.length << ", "
+			"\"is_finished\": " << (entry.isOpFinished ? "true" : "false") << ", "
+			"\"is_error\": " << (entry.isError ? "true" : "false");
+
+		if(entry.isOpFinished && (entry.latencyNS != OPSLOGBIN_UNKNOWN_LATENCY) )
+			outStream << ", \"latency_ns\": " << entry.latencyNS;
+
+		if(entry.isError)
+			outStream << ", \"errno\": " << entry.errorNum;
+
+		outStream << " }\n";
+	} );
+}
+
+/**
+ * Read all op events from a JSON or binary ops log file in the order in which they appear in the
+ * file. The format is detected from the file header.
+ *
+ * @entryHandler called for each op event.
+ * @throw ProgException if the file cannot be read or parsed.
+ */
+void OpsLogger::readLogFile(const std::string& path, OpsLogEntryHandler entryHandler)
+{
+	std::ifstream fileStream(path, std::ios::binary);
+	if(!fileStream)
+		throw ProgException("Unable to open ops log file: " + path);
+
+	char magic[sizeof(OpsLogBinFileHeader::magic)];
+
+	const bool isBinary = fileStream.read(magic, sizeof(magic) ) &&
+		!memcmp(magic, OPSLOGBIN_MAGIC, sizeof(magic) );
+
+	fileStream.clear();
+	fileStream.seekg(0);
+
+	if(isBinary)
+		readBinaryLogFile(path, fileStream, entryHandler);
+	else
+		readJSONLogFile(path, fileStream, entryHandler);
+}
+
+/**
+ * Read op events from a binary ops log file stream that is positioned at the file header.
+ *
+ * @path only for error messages.
+ * @throw ProgException if the file is not a valid binary ops log.
+ */
+void OpsLogger::readBinaryLogFile(const std::string& path, std::istream& fileStream,
+	OpsLogEntryHandler entryHandler)
+{
+	OpsLogBinFileHeader fileHeader;
+
+	if(!fileStream.read( (char*)&fileHeader, sizeof(fileHeader) ) ||
+		memcmp(fileHeader.magic, OPSLOGBIN_MAGIC, sizeof(fileHeader.magic) ) )
+		throw ProgException("Not a binary ops log file: " + path);
+
+	if(fileHeader.byteOrderMark != OPSLOGBIN_BYTEORDERMARK)
+		throw ProgException("Binary ops log file was written on a host with different byte "
+			"order: " + path);
+
+	if(fileHeader.version != OPSLOGBIN_VERSION)
+		throw ProgException("Unsupported binary ops log file version: " +
+			std::to_string(fileHeader.version) + "; File: " + path);
+
+	// name maps; key is pid, loggerID and nameID
+	typedef std::tuple<uint32_t, uint32_t, uint32_t> NameKey;
+	std::map<NameKey, std::string> opNameMap;
+	std::map<NameKey, std::string> entryNameMap;
+
+	std::vector<char> payloadBuf;
+	OpsLogBinRecordHeader recordHeader;
+	OpsLogEntry entry;
+
+	while(fileStream.read( (char*)&recordHeader, sizeof(recordHeader) ) )
+	{
+		payloadBuf.resize(recordHeader.payloadLen);
+
+		if(!fileStream.read(payloadBuf.data(), recordHeader.payloadLen) )
+			throw ProgException("Binary ops log file ends with incomplete record: " + path);
+
+		if( ( (recordHeader.type == OPSLOGBIN_RECORD_OPNAME) ||
+			(recordHeader.type == OPSLOGBIN_RECORD_ENTRYNAME) ) &&
+			(recordHeader.payloadLen >= sizeof(OpsLogBinName) ) )
+		{
+			OpsLogBinName nameRecord;
+			memcpy(&nameRecord, payloadBuf.data(), sizeof(nameRecord) );
+
+			const size_t nameLen = std::min( (size_t)nameRecord.nameLen,
+				recordHeader.payloadLen - sizeof(nameRecord) );
+
+			std::map<NameKey, std::string>& nameMap =
+				(recordHeader.type == OPSLOGBIN_RECORD_OPNAME) ? opNameMap : entryNameMap;
+
+			nameMap[NameKey(nameRecord.pid, nameRecord.loggerID, nameRecord.nameID)] =
+				std::string(&payloadBuf[sizeof(nameRecord)], nameLen);
+
+			continue;
+		}
+
+		if( (recordHeader.type != OPSLOGBIN_RECORD_OP) ||
+			(recordHeader.payloadLen < sizeof(OpsLogBinOp) ) )
+			continue; // unknown record type (e.g. from newer version) => skip
+
+		OpsLogBinOp op;
+		memcpy(&op, payloadBuf.data(), sizeof(op) );
+
+		entry.timestampNS = op.timestampNS;
+		entry.workerRank = op.workerRank;
+		entry.opName = opNameMap[NameKey(op.pid, op.loggerID, op.opNameID)];
+		entry.entryName = entryNameMap[NameKey(op.pid, op.loggerID, op.entryNameID)];
+		entry.offset = op.offset;
+		entry.length = op.length;
+		entry.isOpFinished = (op.flags & OPSLOGBIN_FLAG_FINISHED);
+		entry.isError = (op.flags & OPSLOGBIN_FLAG_ERROR);
+		entry.latencyNS = op.latencyNS;
+		entry.errorNum = op.errorNum;
+
+		entryHandler(entry);
+	}
+}
+
+/**
+ * Read op events from a JSON lines ops log file stream (as written by logOpJSON() ). Empty lines
+ * are ignored.
+ *
+ * @path only for error messages.
+ * @throw ProgException if a line cannot be parsed.
+ */
+void OpsLogger::readJSONLogFile(const std::string& path, std::istream& fileStream,
+	OpsLogEntryHandler entryHandler)
+{
+	std::string line;
+	size_t lineNum = 0;
+	OpsLogEntry entry;
+
+	entry.latencyNS = OPSLOGBIN_UNKNOWN_LATENCY;
+	entry.errorNum = 0;
+
+	while(std::getline(fileStream, line) )
+	{
+		lineNum++;
+
+		if(line.empty() )
+			continue;
+
+		try
+		{
+			std::istringstream lineStream(line);
+			bpt::ptree tree;
+
+			bpt::read_json(lineStream, tree);
+
+			entry.timestampNS = isoDateStrToNS(tree.get<std::string>("date") );
+			entry.workerRank = tree.get<int64_t>("worker_rank");
+			entry.opName = tree.get<std::string>("op_name");
+			entry.entryName = tree.get<std::string>("entry_name");
+			entry.offset = tree.get<uint64_t>("offset");
+			entry.length = tree.get<uint64_t>("length");
+			entry.isOpFinished = tree.get<bool>("is_finished");
+			entry.isError = tree.get<bool>("is_error");
+			entry.latencyNS = tree.get<uint64_t>("latency_ns", OPSLOGBIN_UNKNOWN_LATENCY);
+			entry.errorNum = tree.get<int>("errno", 0);
+		}
+		catch(std::exception& e)
+		{
+			throw ProgException("Unable to parse ops log file line. "
+				"File: " + path + "; "
+				"Line: " + std::to_string(lineNum) + "; "
+				"Error: " + e.what() );
+		}
+
+		entryHandler(entry);
+	}
+}
+
+/**
+ * Convert time to local time ISO date string with milliseconds, e.g.
+ * "2025-01-31T13:45:10.123+0100".
+ */
+std::string OpsLogger::timeToISODateStr(std::chrono::system_clock::time_point timePoint)
+{
+	time_t time = std::chrono::system_clock::to_time_t(timePoint);
+	auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+		timePoint.time_since_epoch()).count() % 1000;
+
+    struct tm localTimeInfo;
+    localtime_r(&time, &localTimeInfo);
+
+	std::stringstream dateStream;
+	dateStream << std::put_time(&localTimeInfo, "%FT%T") << "."
+		<< std::setfill('0') << std::setw(3) << milliseconds
+		<< std::put_time(&localTimeInfo, "%z");
+
+	return dateStream.str();
+}
+
+/**
+ * Convert ISO date string of timeToISODateStr() back to nanoseconds since the epoch.
+ *
+ * @throw ProgException if the string cannot be parsed.
+ */
+uint64_t OpsLogger::isoDateStrToNS(const std::string& dateStr)
+{
+	struct tm timeInfo;
+	memset(&timeInfo, 0, sizeof(timeInfo) );
+
+	const char* msStr = strptime(dateStr.c_str(), "%Y-%m-%dT%H:%M:%S", &timeInfo);
+
+	unsigned milliseconds;
+	char tzSign;
+	unsigned tzHours;
+	unsigned tzMinutes;
+
+	if(!msStr ||
+		(sscanf(msStr, ".%3u%c%2u%2u", &milliseconds, &tzSign, &tzHours, &tzMinutes) != 4) ||
+		( (tzSign != '+') && (tzSign != '-') ) )
+		throw ProgException("Invalid ops log date: " + dateStr);
+
+	const int64_t tzOffsetSecs = ( (tzSign == '-') ? -1 : 1) *
+		(int64_t)(tzHours * 3600 + tzMinutes * 60);
+	const int64_t epochSecs = (int64_t)timegm(&timeInfo) - tzOffsetSecs;
+
+	return (uint64_t)epochSecs * 1000000000ULL + (uint64_t)milliseconds * 1000000ULL;
+}
@@ -4,17 +4,38 @@
 #ifndef TOOLKITS_OPSLOGGER_H_
 #define TOOLKITS_OPSLOGGER_H_
 
+#include <chrono>
 #include <fcntl.h>
+#include <functional>
 #include <inttypes.h>
+#include <ostream>
 #include <stdio.h>
 #include <sys/file.h>
+#include <unordered_map>
 
 #include "Common.h"
+#include "toolkits/OpsLogRingBuffer.h"
+#include "toolkits/OpsTracer.h"
 #include "workers/WorkersSharedData.h"
 
 
 #define OPSLOGFILE_MODE		(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH)
 
+#define OPSLOGBIN_MAGIC					"ELBOPL01" // 8 bytes at start of file (without '\0')
+#define OPSLOGBIN_VERSION				1
+#define OPSLOGBIN_BYTEORDERMARK			0x01020304 // to detect files from other architectures
+#define OPSLOGBIN_RINGBUF_SIZE			(1024*1024) // per logger; must be a power of 2
+#define OPSLOGBIN_FLUSH_INTERVAL_MS		100 // max time until background writer flushes ring bufs
+#define OPSLOGBIN_MAX_NAME_LEN			4096 // longer op/entry names get truncated
+#define OPSLOGBIN_UNKNOWN_LATENCY		UINT64_MAX // latencyNS if no matching pre-op record
+
+#define OPSLOGBIN_RECORD_OPNAME			1 // payload is OpsLogBinName + name
+#define OPSLOGBIN_RECORD_ENTRYNAME		2 // payload is OpsLogBinName + name
+#define OPSLOGBIN_RECORD_OP				3 // payload is OpsLogBinOp
+
+#define OPSLOGBIN_FLAG_FINISHED			1 // op is finished (otherwise this is the pre-op record)
+#define OPSLOGBIN_FLAG_ERROR			2 // op failed
+
 // macro to avoid function call overhead if ops logging is not enabled; saves/restores errno
 #define OPLOG(opsLogger, opName, entryName, offset, length, isOpFinished, isError) \
     do { \
@@ -22,8 +43,8 @@
         { \
             const int errnoCopy = errno; \
             \
-            opsLogger.logOpJSON(opName, entryName, offset, length, isOpFinished, \
-                isError); \
+            opsLogger.logOp(opName, entryName, offset, length, isOpFinished, \
+                isError, errnoCopy); \
             \
             errno = errnoCopy; /* restore to not spoil val for callers that check after opslog */ \
         } \
@@ -39,8 +60,86 @@
 class ProgArgs; // forward declaration to avoid cyclic #include
 
 
+/**
+ * Binary ops log file header. Followed by records, each of which starts with an
+ * OpsLogBinRecordHeader. All values are in native byte order of the writing host.
+ */
+struct OpsLogBinFileHeader
+{
+	char magic[8]; // OPSLOGBIN_MAGIC
+	uint32_t version; // OPSLOGBIN_VERSION
+	uint32_t byteOrderMark; // OPSLOGBIN_BYTEORDERMARK
+};
+
+/**
+ * Header of each binary ops log record. Readers skip records of unknown type based on payloadLen.
+ */
+struct OpsLogBinRecordHeader
+{
+	uint16_t type; // OPSLOGBIN_RECORD_...
+	uint16_t reserved;
+	uint32_t payloadLen; // number of bytes following this header
+};
+
+/**
+ * Definition of an op name or entry name ID, followed by nameLen bytes of the name (without '\0').
+ * IDs are only unique within a logger, which is identified by pid and loggerID.
+ */
+struct OpsLogBinName
+{
+	uint32_t pid;
+	uint32_t loggerID;
+	uint32_t nameID;
+	uint32_t nameLen;
+};
+
+/**
+ * A single logged op event. Names are referenced by ID and defined by earlier name records of the
+ * same logger.
+ */
+struct OpsLogBinOp
+{
+	uint64_t timestampNS; // nanoseconds since the epoch
+	uint64_t offset;
+	uint64_t length;
+	uint64_t latencyNS; // time since pre-op record for finished ops; OPSLOGBIN_UNKNOWN_LATENCY
+	int64_t workerRank; // -1 if logger doesn't belong to a worker thread
+	uint32_t pid;
+	uint32_t loggerID;
+	uint32_t entryNameID;
+	uint16_t opNameID;
+	uint16_t flags; // OPSLOGBIN_FLAG_...
+	int32_t errorNum; // errno if op failed, 0 otherwise
+	uint32_t reserved;
+};
+
+/**
+ * A single op event as read back from a JSON or binary ops log file.
+ */
+struct OpsLogEntry
+{
+	uint64_t timestampNS; // nanoseconds since the epoch (millisecond resolution for JSON logs)
+	int64_t workerRank;
+	std::string opName;
+	std::string entryName;
+	uint64_t offset;
+	uint64_t length;
+	bool isOpFinished;
+	bool isError;
+	uint64_t latencyNS; // OPSLOGBIN_UNKNOWN_LATENCY if unknown (always for JSON logs)
+	int errorNum; // 0 if unknown (always for JSON logs)
+};
+
+typedef std::function<void(const OpsLogEntry& entry)> OpsLogEntryHandler;
+
+
 /**
  * Log file writer for IO operations.
+ *
+ * In JSON mode, each op gets directly appended to the log file as a line of text. In binary mode,
+ * ops get added as fixed-size records to a per-logger lock-free ring buffer, which a background
+ * writer thread flushes to the log file. Names get logged only once per change as separate
+ * records, so that the common case of many ops on the same file only copies a small record.
  */
 class OpsLogger
 {
@@ -53,7 +152,7 @@ class OpsLogger
 		 *      worker thread.
 		 */
 		OpsLogger(const ProgArgs* progArgs, ssize_t workerRank) :
-		    progArgs(progArgs), workerRank(workerRank) {}
+		    progArgs(progArgs), workerRank(workerRank), tracer(progArgs, workerRank) {}
 
 		~OpsLogger()
 		{
@@ -62,27 +161,100 @@ class OpsLogger
 
 		void openLogFile();
 		void closeLogFile();
-		void logOpJSON(std::string opName, std::string entryName,
+		void logOpJSON(const std::string& opName, const std::string& entryName,
 			uint64_t offset, uint64_t length, bool isOpFinished, bool isError);
+		void logOpBinary(const char* opName, const std::string& entryName,
+			uint64_t offset, uint64_t length, bool isOpFinished, bool isError, int errorNum);
+
+		static void convertBinaryToJSON(const std::string& path, std::ostream& outStream);
+		static void readLogFile(const std::string& path, OpsLogEntryHandler entryHandler);
 
 
 	private:
 		const ProgArgs* progArgs;
 		ssize_t workerRank{-1};
 		int logFileFD{-1};
+		OpsTracer tracer; // timeline of ops for trace file (only for worker threads)
+
+		// binary mode...
+
+		/**
+		 * ID of an op or entry name and whether the name record has been logged already. (Name
+		 * records get only logged for names of sampled ops.)
+		 */
+		struct BinNameID
+		{
+			uint32_t nameID;
+			bool isLogged;
+		};
+
+		bool isBinaryLogOpen{false}; // true if registered with background writer
+		OpsLogRingBuffer binRingBuf; // records to be written by background writer
+		uint32_t binLoggerID{0}; // unique ID of this logger within the process
+		size_t binSampleN{1}; // log only 1 in N ops
+		std::unordered_map<const char*, BinNameID> binOpNameMap; // key is string literal addr
+		std::string binLastEntryName; // entry name of previous op
+		BinNameID binLastEntryNameID{0, false};
+		uint32_t binNextEntryNameID{0};
+		uint64_t binLastPreOpKey{0}; // sampling key of last pre-op record (for latency calc)
+		uint64_t binLastPreOpNS{0}; // timestamp of last pre-op record (for latency calc)
+		std::vector<char> binNameRecordBuf; // buffer to prepare name records
+
+		void logBinaryName(uint16_t recordType, uint32_t nameID, const char* name,
+			size_t nameLen);
+		void pushBinaryRecord(const void* record, size_t recordLen);
+
+		static void readBinaryLogFile(const std::string& path, std::istream& fileStream,
+			OpsLogEntryHandler entryHandler);
+		static void readJSONLogFile(const std::string& path, std::istream& fileStream,
+			OpsLogEntryHandler entryHandler);
+
+		static std::string timeToISODateStr(std::chrono::system_clock::time_point timePoint);
+		static uint64_t isoDateStrToNS(const std::string& dateStr);
 
 		// inliners
 	public:
 		/**
-         * Check if ops logging is enabled. This is an efficient check for the OPLOG() macro.
+         * Check if ops logging or tracing is enabled. This is an efficient check for the OPLOG()
+         * macro.
          *
-         * @return true if ops logging is enabled.
+         * @return true if ops logging or tracing is enabled.
          */
 		inline bool isEnabled() const
 		{
-			return (logFileFD != -1);
+			return (logFileFD != -1) || isBinaryLogOpen || tracer.isEnabled();
 		}
 
+		/**
+		 * Log op in the format selected by the user. This requires a previous call to
+		 * openLogFile().
+		 *
+		 * Most likely you don't want to call this directly. Call the OPLOG() macro instead.
+		 */
+		inline void logOp(const char* opName, const std::string& entryName,
+			uint64_t offset, uint64_t length, bool isOpFinished, bool isError, int errorNum)
+		{
+			if(tracer.isEnabled() )
+				tracer.traceOp(opName, entryName, offset, length, isOpFinished, isError, errorNum);
+
+			if(isBinaryLogOpen)
+				logOpBinary(opName, entryName, offset, length, isOpFinished, isError, errorNum);
+			else
+			if(logFileFD != -1)
+				logOpJSON(opName, entryName, offset, length, isOpFinished, isError);
+		}
+
+		/**
+		 * Start buffering trace events for a new phase. To be called by the worker thread.
+		 */
+		void beginTracePhase() { tracer.beginPhase(); }
+
+		/**
+		 * Write buffered trace events of the current phase to the trace file. To be called by
+		 * the worker thread.
+		 */
+		void endTracePhase(const std::string& phaseName) { tracer.endPhase(phaseName); }
+
 };
 
 #endif /* TOOLKITS_OPSLOGGER_H_ */
@@ -0,0 +1,347 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <mutex>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Logger.h"
+#include "OpsLogger.h"
+#include "OpsTracer.h"
+#include "ProgArgs.h"
+
+
+/**
+ * Start tracing. Events get buffered until the end of the next phase.
+ */
+void OpsTracer::enable()
+{
+	if(progArgs->getTraceFilePath().empty() )
+		return;
+
+	sampleN = progArgs->getTraceSampleN();
+
+	isTracingEnabled = true;
+}
+
+/**
+ * Reset the event buffer and remember the phase start time. To be called by the worker thread at
+ * the start of each phase.
+ */
+void OpsTracer::beginPhase()
+{
+	if(!isTracingEnabled)
+		return;
+
+	phaseStartNS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch() ).count();
+
+	events.clear();
+	entryNames.clear();
+	numDroppedEvents = 0;
+	hasPendingPreOp = false;
+}
+
+/**
+ * Append the buffered events of the current phase to the trace file. To be called by the worker
+ * thread at the end of each phase. Errors only get logged, as tracing shouldn't fail the
+ * benchmark.
+ *
+ * @phaseName name of the phase for the phase span in the trace.
+ */
+void OpsTracer::endPhase(const std::string& phaseName)
+{
+	if(!isTracingEnabled || !phaseStartNS)
+		return; // tracing disabled or no phase started
+
+	const uint64_t phaseEndNS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch() ).count();
+
+	if(hasPendingPreOp && isPendingPreOpSampled)
+		addEvent(pendingPreOp); // e.g. last async submission of the phase => instant event
+
+	writeEvents(phaseName, phaseEndNS);
+
+	if(numDroppedEvents)
+		LOGGER(Log_NORMAL, "Warning: Trace event limit reached. "
+			"Dropped events: " << numDroppedEvents << "; "
+			"Rank: " << workerRank << "; "
+			"Phase: " << phaseName << "; "
+			"Limit: " << OPSTRACE_MAX_EVENTS << "; "
+			"(Consider \"--" ARG_TRACESAMPLE_LONG "\".)" << std::endl);
+
+	phaseStartNS = 0;
+	events.clear();
+	events.shrink_to_fit(); // don't keep memory of large traces between phases
+	entryNames.clear();
+	hasPendingPreOp = false;
+}
+
+/**
+ * Add an op to the trace. A pre-op gets kept pending until the matching post-op arrives to create
+ * a complete event. If another pre-op arrives first, the pending one had no post-op (e.g. async
+ * submission) and becomes an instant event.
+ *
+ * Most likely you don't want to call this directly. Call the OPLOG() macro instead.
+ *
+ * @opName must be a string literal, as only the pointer gets stored.
+ */
+void OpsTracer::traceOp(const char* opName, const std::string& entryName, uint64_t offset,
+	uint64_t length, bool isOpFinished, bool isError, int errorNum)
+{
+	if(!phaseStartNS)
+		return; // op outside of a phase (e.g. during preparation)
+
+	const uint64_t nowNS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch() ).count();
+
+	if(!isOpFinished)
+	{ // pre-op
+		if(hasPendingPreOp && isPendingPreOpSampled)
+			addEvent(pendingPreOp); // previous pre-op had no post-op => instant event
+
+		hasPendingPreOp = true;
+		isPendingPreOpSampled = !(numSampleOps++ % sampleN);
+
+		pendingPreOp.opName = opName;
+		pendingPreOp.offset = offset;
+
+		if(!isPendingPreOpSampled)
+			return;
+
+		pendingPreOp.entryNameIdx = getEntryNameIdx(entryName);
+		pendingPreOp.errorNum = 0;
+		pendingPreOp.startNS = nowNS;
+		pendingPreOp.durationNS = OPSTRACE_INSTANT_DURATION;
+		pendingPreOp.length = length;
+		pendingPreOp.isError = false;
+
+		return;
+	}
+
+	// post-op
+
+	if(hasPendingPreOp && (pendingPreOp.offset == offset) &&
+		( (pendingPreOp.opName == opName) || !strcmp(pendingPreOp.opName, opName) ) )
+	{ // post-op of pending pre-op => complete event
+		hasPendingPreOp = false;
+
+		if(!isPendingPreOpSampled)
+			return;
+
+		OpsTraceEvent event = pendingPreOp;
+		event.durationNS = nowNS - pendingPreOp.startNS;
+		event.length = length;
+		event.isError = isError;
+		event.errorNum = isError ? errorNum : 0;
+
+		addEvent(event);
+
+		return;
+	}
+
+	// post-op without matching pre-op => instant event
+
+	if(hasPendingPreOp && isPendingPreOpSampled)
+		addEvent(pendingPreOp);
+
+	hasPendingPreOp = false;
+
+	if(numSampleOps++ % sampleN)
+		return;
+
+	OpsTraceEvent event;
+	event.opName = opName;
+	event.entryNameIdx = getEntryNameIdx(entryName);
+	event.errorNum = isError ? errorNum : 0;
+	event.startNS = nowNS;
+	event.durationNS = OPSTRACE_INSTANT_DURATION;
+	event.offset = offset;
+	event.length = length;
+	event.isError = isError;
+
+	addEvent(event);
+}
+
+/**
+ * Append event to buffer or count it as dropped if the buffer is full.
+ */
+void OpsTracer::addEvent(const OpsTraceEvent& event)
+{
+	if(events.size() >= OPSTRACE_MAX_EVENTS)
+	{
+		numDroppedEvents++;
+		return;
+	}
+
+	events.push_back(event);
+}
+
+/**
+ * Get index of entry name in entryNames. Only compares to the previous entry name, as consecutive
+ * ops typically refer to the same entry (e.g. all reads of a file).
+ */
+uint32_t OpsTracer::getEntryNameIdx(const std::string& entryName)
+{
+	if(entryNames.empty() || (entryNames.back() != entryName) )
+		entryNames.push_back(entryName);
+
+	return entryNames.size() - 1;
+}
+
+/**
+ * Append phase span and buffered events to trace file. Appends of all workers get serialized, so
+ * that each event line is complete.
+ */
+void OpsTracer::writeEvents(const std::string& phaseName, uint64_t phaseEndNS)
+{
+	static std::mutex writeMutex; // serializes appends of all workers of this process
+	static bool isProcessNameWritten = false; // process name metadata written to trace file
+
+	const std::string& traceFilePath = progArgs->getTraceFilePath();
+	const std::string pidStr = std::to_string(getpid() );
+	const std::string tidStr = std::to_string(workerRank);
+	const std::string pidTidStr = "\"pid\":" + pidStr + ",\"tid\":" + tidStr;
+	std::string writeBuf;
+
+	writeBuf.reserve(OPSTRACE_WRITEBUF_SIZE + 1024);
+
+	std::unique_lock<std::mutex> lock(writeMutex);
+
+	int fd = open(traceFilePath.c_str(), O_WRONLY | O_CREAT | O_APPEND, OPSLOGFILE_MODE);
+
+	if(fd == -1)
+	{
+		ERRLOGGER(Log_NORMAL, "Unable to open trace file: " << traceFilePath << "; "
+			"SysErr: " << strerror(errno) << std::endl);
+		return;
+	}
+
+	// flush writeBuf to file; returns false on error
+	auto flushWriteBuf = [&]() -> bool
+	{
+		ssize_t writeRes = write(fd, writeBuf.data(), writeBuf.size() );
+
+		if(writeRes != (ssize_t)writeBuf.size() )
+		{
+			ERRLOGGER(Log_NORMAL, "Unable to write trace file: " << traceFilePath << "; "
+				"SysErr: " << strerror(errno) << std::endl);
+			return false;
+		}
+
+		writeBuf.clear();
+
+		return true;
+	};
+
+	struct stat statBuf;
+
+	if(!fstat(fd, &statBuf) && !statBuf.st_size)
+		writeBuf += "[\n"; // new file => start JSON array
+
+	if(!isProcessNameWritten)
+	{ // name process by hostname to tell service instances apart
+		char hostname[256] = {};
+		gethostname(hostname, sizeof(hostname) - 1);
+
+		writeBuf += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pidStr + ","
+			"\"args\":{\"name\":\"elbencho " + escapeJSONStr(hostname) + "\"}},\n";
+
+		isProcessNameWritten = true;
+	}
+
+	if(!isThreadNameWritten)
+	{
+		writeBuf += "{\"name\":\"thread_name\",\"ph\":\"M\"," + pidTidStr + ","
+			"\"args\":{\"name\":\"worker " + tidStr + "\"}},\n";
+		writeBuf += "{\"name\":\"thread_sort_index\",\"ph\":\"M\"," + pidTidStr + ","
+			"\"args\":{\"sort_index\":" + tidStr + "}},\n";
+
+		isThreadNameWritten = true;
+	}
+
+	writeBuf += "{\"name\":\"" + escapeJSONStr(phaseName) + "\",\"cat\":\"phase\",\"ph\":\"X\","
+		"\"ts\":" + nsToUSecStr(phaseStartNS) + ","
+		"\"dur\":" + nsToUSecStr(phaseEndNS - phaseStartNS) + "," + pidTidStr + ","
+		"\"args\":{\"events\":" + std::to_string(events.size() ) + ","
+		"\"dropped_events\":" + std::to_string(numDroppedEvents) + "}},\n";
+
+	for(const OpsTraceEvent& event : events)
+	{
+		writeBuf += "{\"name\":\"";
+		writeBuf += event.opName;
+		writeBuf += "\",\"cat\":\"op\",";
+
+		if(event.durationNS == OPSTRACE_INSTANT_DURATION)
+			writeBuf += "\"ph\":\"i\",\"s\":\"t\",\"ts\":" + nsToUSecStr(event.startNS) + ",";
+		else
+			writeBuf += "\"ph\":\"X\",\"ts\":" + nsToUSecStr(event.startNS) + ","
+				"\"dur\":" + nsToUSecStr(event.durationNS) + ",";
+
+		writeBuf += pidTidStr + ",\"args\":{"
+			"\"entry\":\"" + escapeJSONStr(entryNames[event.entryNameIdx] ) + "\","
+			"\"offset\":" + std::to_string(event.offset) + ","
+			"\"length\":" + std::to_string(event.length);
+
+		if(event.isError)
+			writeBuf += ",\"error\":true,\"errno\":" + std::to_string(event.errorNum);
+
+		writeBuf += "}},\n";
+
+		if( (writeBuf.size() >= OPSTRACE_WRITEBUF_SIZE) && !flushWriteBuf() )
+		{
+			close(fd);
+			return;
+		}
+	}
+
+	flushWriteBuf();
+
+	close(fd);
+}
+
+/**
+ * Escape a string for use as JSON string value.
+ */
+std::string OpsTracer::escapeJSONStr(const std::string& str)
+{
+	std::string outStr;
+
+	outStr.reserve(str.length() );
+
+	for(const char currentChar : str)
+	{
+		if( (currentChar == '"') || (currentChar == '\\') )
+		{
+			outStr += '\\';
+			outStr += currentChar;
+		}
+		else
+		if( (unsigned char)currentChar < 0x20)
+		{
+			char hexBuf[8];
+			snprintf(hexBuf, sizeof(hexBuf), "\\u%04x", (unsigned)currentChar);
+			outStr += hexBuf;
+		}
+		else
+			outStr += currentChar;
+	}
+
+	return outStr;
+}
+
+/**
+ * Convert nanoseconds to the microseconds string of the trace event format with 3 decimal places,
+ * without going through floating point to keep full precision for timestamps since the epoch.
+ */
+std::string OpsTracer::nsToUSecStr(uint64_t ns)
+{
+	char usecBuf[32];
+
+	snprintf(usecBuf, sizeof(usecBuf), "%" PRIu64 ".%03" PRIu64, ns / 1000, ns % 1000);
+
+	return usecBuf;
+}
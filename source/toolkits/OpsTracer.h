@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_OPSTRACER_H_
+#define TOOLKITS_OPSTRACER_H_
+
+#include <string>
+#include <vector>
+#include "Common.h"
+
+
+#define OPSTRACE_MAX_EVENTS			(256*1024) // per worker and phase; further events get dropped
+#define OPSTRACE_INSTANT_DURATION	UINT64_MAX // durationNS of events without matching pre-op
+#define OPSTRACE_WRITEBUF_SIZE		(256*1024) // flush size when writing events to trace file
+
+
+class ProgArgs; // forward declaration to avoid cyclic #include
+
+
+/**
+ * A single traced op. Op names are string literals of the OPLOG() callers, so only the pointer
+ * gets stored. Entry names are stored as index into the per-phase entry names vector.
+ */
+struct OpsTraceEvent
+{
+	const char* opName;
+	uint32_t entryNameIdx;
+	int32_t errorNum; // errno if op failed, 0 otherwise
+	uint64_t startNS; // nanoseconds since the epoch
+	uint64_t durationNS; // OPSTRACE_INSTANT_DURATION if no matching pre-op/post-op
+	uint64_t offset;
+	uint64_t length;
+	bool isError;
+};
+
+
+/**
+ * Timeline of the ops of a single worker thread in Chrome trace event format (JSON array format),
+ * which can be loaded into Perfetto UI or chrome://tracing.
+ *
+ * Events get buffered in memory and appended to the trace file at the end of each phase, so that
+ * tracing doesn't add file writes to the measured phase. A pre-op and the matching post-op are
+ * combined into a single complete event ("X"). Ops without matching counterpart (e.g. submissions
+ * of async ops, which have no post-op record) become instant events ("i").
+ *
+ * The trace file has no closing bracket, which is explicitly allowed by the trace event format and
+ * enables multiple workers and multiple phases to append to the same file.
+ */
+class OpsTracer
+{
+	public:
+		OpsTracer(const ProgArgs* progArgs, ssize_t workerRank) :
+			progArgs(progArgs), workerRank(workerRank) {}
+
+		void enable();
+		void beginPhase();
+		void endPhase(const std::string& phaseName);
+		void traceOp(const char* opName, const std::string& entryName, uint64_t offset,
+			uint64_t length, bool isOpFinished, bool isError, int errorNum);
+
+	private:
+		const ProgArgs* progArgs;
+		ssize_t workerRank;
+		bool isTracingEnabled{false};
+		size_t sampleN{1}; // trace only 1 in N ops
+		uint64_t numSampleOps{0}; // counter of pre-ops for sampling
+
+		uint64_t phaseStartNS{0}; // 0 if no phase started
+		std::vector<OpsTraceEvent> events; // events of current phase
+		StringVec entryNames; // entry names of current phase for OpsTraceEvent::entryNameIdx
+		uint64_t numDroppedEvents{0}; // events exceeding OPSTRACE_MAX_EVENTS in current phase
+		bool isThreadNameWritten{false}; // thread name metadata written to trace file
+
+		bool hasPendingPreOp{false}; // pendingPreOp is waiting for its post-op
+		bool isPendingPreOpSampled{false}; // false if pending pre-op is skipped due to sampling
+		OpsTraceEvent pendingPreOp;
+
+		void addEvent(const OpsTraceEvent& event);
+		uint32_t getEntryNameIdx(const std::string& entryName);
+		void writeEvents(const std::string& phaseName, uint64_t phaseEndNS);
+
+		static std::string escapeJSONStr(const std::string& str);
+		static std::string nsToUSecStr(uint64_t ns);
+
+		// inliners
+	public:
+		bool isEnabled() const { return isTracingEnabled; }
+};
+
+#endif /* TOOLKITS_OPSTRACER_H_ */
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <limits>
+#include "toolkits/RateLimitBalancer.h"
+
+/**
+ * Reset to even shares for all hosts. To be called before a new phase starts.
+ *
+ * @numHosts number of service hosts.
+ * @globalLimitBytesPerSec global bytes limit of the phase; 0 if none.
+ * @globalLimitOpsPerSec global ops limit of the phase; 0 if none. If neither of both limits is
+ * 	set then there is nothing to balance, so all hosts keep their even share.
+ */
+void RateLimitBalancer::initStart(size_t numHosts, uint64_t globalLimitBytesPerSec,
+	uint64_t globalLimitOpsPerSec)
+{
+	std::unique_lock<std::mutex> lock(mutex); // L O C K (scoped)
+
+	this->useBytes = (globalLimitBytesPerSec != 0);
+	this->globalLimitPerSec = useBytes ? globalLimitBytesPerSec : globalLimitOpsPerSec;
+
+	hostStateVec.assign(numHosts, HostState() );
+
+	for(HostState& hostState : hostStateVec)
+		hostState.share = 1.0 / numHosts;
+}
+
+/**
+ * Update live throughput of a host and get its new share.
+ *
+ * @hostIndex index of the host in the hosts list.
+ * @numBytesDone counter of done bytes of the host since the phase start.
+ * @numOpsDone counter of done ops of the host since the phase start.
+ * @nowT time of the counter values.
+ * @return new share of the host as fraction of the global limit.
+ */
+double RateLimitBalancer::updateHost(size_t hostIndex, uint64_t numBytesDone,
+	uint64_t numOpsDone, std::chrono::steady_clock::time_point nowT)
+{
+	std::unique_lock<std::mutex> lock(mutex); // L O C K (scoped)
+
+	HostState& hostState = hostStateVec.at(hostIndex);
+
+	if(!globalLimitPerSec)
+		return hostState.share;
+
+	const uint64_t numDone = useBytes ? numBytesDone : numOpsDone;
+
+	if(hostState.haveLastUpdate && (nowT > hostState.lastUpdateT) &&
+		(numDone >= hostState.lastNumDone) )
+	{
+		const double elapsedSecs = std::chrono::duration<double>(
+			nowT - hostState.lastUpdateT).count();
+
+		hostState.ratePerSec = (numDone - hostState.lastNumDone) / elapsedSecs;
+		hostState.haveRate = true;
+	}
+
+	hostState.lastNumDone = numDone;
+	hostState.lastUpdateT = nowT;
+	hostState.haveLastUpdate = true;
+
+	recalcShares();
+
+	return hostState.share;
+}
+
+/**
+ * Recalculate the shares of all hosts by max-min fairness. Does nothing until all hosts have a
+ * throughput measurement.
+ *
+ * Note: Caller must hold the mutex.
+ */
+void RateLimitBalancer::recalcShares()
+{
+	const size_t numHosts = hostStateVec.size();
+
+	for(HostState& hostState : hostStateVec)
+		if(!hostState.haveRate)
+			return;
+
+	// demand of each host as fraction of the global limit; saturated hosts want everything
+
+	const double minShare = (RATELIMITBALANCER_MIN_SHARE_PCT / 100.0) / numHosts;
+	std::vector<double> demandVec(numHosts);
+
+	for(size_t i = 0; i < numHosts; i++)
+	{
+		const HostState& hostState = hostStateVec[i];
+		const double usedShare = hostState.ratePerSec / globalLimitPerSec;
+
+		if(usedShare >= (hostState.share * RATELIMITBALANCER_SATURATED_PCT / 100) )
+			demandVec[i] = std::numeric_limits<double>::max();
+		else
+			demandVec[i] = std::max(minShare,
+				usedShare * (100 + RATELIMITBALANCER_HEADROOM_PCT) / 100);
+	}
+
+	// water-filling: serve the smallest demands first, split the rest evenly among the others
+
+	std::vector<size_t> sortedIndexVec(numHosts);
+
+	for(size_t i = 0; i < numHosts; i++)
+		sortedIndexVec[i] = i;
+
+	std::sort(sortedIndexVec.begin(), sortedIndexVec.end(),
+		[&demandVec](size_t a, size_t b) { return demandVec[a] < demandVec[b]; } );
+
+	double remainingShare = 1;
+
+	for(size_t sortedIndex = 0; sortedIndex < numHosts; sortedIndex++)
+	{
+		const size_t i = sortedIndexVec[sortedIndex];
+		const double fairShare = remainingShare / (numHosts - sortedIndex);
+
+		hostStateVec[i].share = std::min(demandVec[i], fairShare);
+		remainingShare -= hostStateVec[i].share;
+	}
+
+	// leftover if no host is saturated => split evenly to keep the sum at the global limit
+
+	for(HostState& hostState : hostStateVec)
+		hostState.share += remainingShare / numHosts;
+}
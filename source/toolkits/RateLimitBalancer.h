@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_RATELIMITBALANCER_H_
+#define TOOLKITS_RATELIMITBALANCER_H_
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "Common.h"
+
+#define RATELIMITBALANCER_SATURATED_PCT		90 // host using this much of its share wants more
+#define RATELIMITBALANCER_HEADROOM_PCT		20 // unsaturated hosts keep this on top of their rate
+#define RATELIMITBALANCER_MIN_SHARE_PCT		10 // min share of a host in % of an even share
+#define RATELIMITBALANCER_MIN_CHANGE_PCT	5 // smaller share changes are not sent to hosts
+
+
+/**
+ * Used by the master of a distributed benchmark to split a global rate limit among the service
+ * hosts based on their live throughput (max-min fairness): Hosts which can't use their share (e.g.
+ * because their paths are slower) keep what they use plus some headroom to grow again and the rest
+ * goes to the hosts which are saturated by their share. Thus the cluster can deliver the global
+ * limit even if hosts are uneven.
+ *
+ * Shares are fractions of the global limit, so that the same share can be applied to all limits
+ * (read/write, bytes/ops). Throughput is measured in bytes if there is a bytes limit, otherwise in
+ * ops.
+ */
+class RateLimitBalancer
+{
+	public:
+		void initStart(size_t numHosts, uint64_t globalLimitBytesPerSec,
+			uint64_t globalLimitOpsPerSec);
+		double updateHost(size_t hostIndex, uint64_t numBytesDone, uint64_t numOpsDone,
+			std::chrono::steady_clock::time_point nowT);
+
+	private:
+		/**
+		 * Live throughput measurement of a single host.
+		 */
+		struct HostState
+		{
+			uint64_t lastNumDone{0}; // counter value of last update
+			std::chrono::steady_clock::time_point lastUpdateT; // time of last update
+			bool haveLastUpdate{false}; // false if lastNumDone and lastUpdateT are not set yet
+			double ratePerSec{0}; // throughput between the last two updates
+			bool haveRate{false}; // false before the 2nd update
+			double share{0}; // current fraction of the global limit
+		};
+
+		std::mutex mutex; // protects hostStateVec against concurrent updates of RemoteWorkers
+		std::vector<HostState> hostStateVec; // index is host index
+		uint64_t globalLimitPerSec{0}; // 0 means nothing to balance
+		bool useBytes{false}; // true to measure in bytes, false for ops
+
+		void recalcShares();
+};
+
+#endif /* TOOLKITS_RATELIMITBALANCER_H_ */
@@ -1,68 +1,213 @@
-// SPDX-FileCopyrightText: 2020-2025 Sven Breuner and elbencho contributors
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
 // SPDX-License-Identifier: GPL-3.0-only
 
 #ifndef TOOLKITS_RATELIMITER_H_
 #define TOOLKITS_RATELIMITER_H_
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include "Common.h"
 
+#define RATELIMITER_DEFAULT_REFILL_USEC		1000 // default refill interval of token buckets
+#define RATELIMITER_MAX_SLEEP_MS			100 // max sleep per round to check for interruption
+#define RATELIMITER_SPIN_USEC				100 // busy-wait for the last part of a wait if enabled
+
+
+/**
+ * Token bucket for a single rate limited unit (e.g. bytes or ops). Tokens get added in discrete
+ * steps per refill interval. The bucket holds at most the tokens of one refill interval, so that
+ * a worker which fell behind cannot catch up with a burst.
+ *
+ * Ops may take more tokens than are in the bucket (e.g. a block that is larger than the tokens of
+ * one refill interval). The bucket then goes into debt and the next op has to wait until the debt
+ * is paid off. A limit of 0 means unlimited.
+ */
+class RateLimiterTokenBucket
+{
+	private:
+		double tokensPerInterval{0}; // 0 means unlimited
+		double numTokens{0}; // negative if in debt
+
+	public:
+		void init(uint64_t limitPerSec, uint64_t refillIntervalNanoSec)
+		{
+			tokensPerInterval = (limitPerSec * (double)refillIntervalNanoSec) / 1000000000;
+			numTokens = tokensPerInterval; // start with a full bucket
+		}
+
+		void refill(uint64_t numIntervals)
+		{
+			numTokens = std::min(tokensPerInterval, numTokens + (numIntervals * tokensPerInterval) );
+		}
+
+		void take(uint64_t num)
+		{
+			if(tokensPerInterval)
+				numTokens -= num;
+		}
+
+		/**
+		 * Get the number of refill intervals until the bucket is out of debt.
+		 */
+		uint64_t getNumIntervalsUntilReady() const
+		{
+			if(numTokens >= 0)
+				return 0;
+
+			return std::ceil(-numTokens / tokensPerInterval);
+		}
+};
+
 /**
- * Provides a way to let a thread sleep for the remainder of a second if a given limit is exceeded.
+ * Per-thread rate limiter for bytes and ops per second based on token buckets with a configurable
+ * refill interval, so that traffic is smooth instead of a burst at the beginning of each second
+ * followed by an idle gap.
+ *
+ * Waits are a sleep until the next refill that makes the buckets ready. For precise pacing with
+ * short refill intervals, the last part of the wait can be a busy-wait to avoid sleep overshoot.
  */
 class RateLimiter
 {
 	private:
-		uint64_t limitPerSec; // limit in whatever unit should be rate limited (e.g. bytes)
-		uint64_t numDoneThisSec; // how much we used up of our rate limit this sec (e.g. bytes)
-		std::chrono::steady_clock::time_point startT; // when the current second started
+		RateLimiterTokenBucket bytesBucket;
+		RateLimiterTokenBucket opsBucket;
+		std::chrono::nanoseconds refillInterval{RATELIMITER_DEFAULT_REFILL_USEC * 1000};
+		std::chrono::steady_clock::time_point lastRefillT; // time of last refill step
+		bool useSpinWait{false}; // true to busy-wait for the last part of a wait
+
+		/**
+		 * Add the tokens of all refill intervals that passed since the last refill.
+		 */
+		void refill(std::chrono::steady_clock::time_point nowT)
+		{
+			IF_UNLIKELY(nowT < lastRefillT)
+				return;
+
+			const uint64_t numIntervals = (nowT - lastRefillT) / refillInterval;
+
+			if(!numIntervals)
+				return;
+
+			lastRefillT += numIntervals * refillInterval;
+
+			bytesBucket.refill(numIntervals);
+			opsBucket.refill(numIntervals);
+		}
+
+		std::chrono::steady_clock::time_point getReadyT() const
+		{
+			const uint64_t numIntervals = std::max(bytesBucket.getNumIntervalsUntilReady(),
+				opsBucket.getNumIntervalsUntilReady() );
+
+			return lastRefillT + (numIntervals * refillInterval);
+		}
 
 	// inliners
 	public:
 
-	void initStart(uint64_t limitPerSec)
+	/**
+	 * @bytesPerSec byte limit; 0 for unlimited.
+	 * @opsPerSec ops limit; 0 for unlimited.
+	 * @refillIntervalUSec interval to add tokens to the buckets.
+	 * @useSpinWait true to busy-wait for the last part of a wait for microsecond precision.
+	 */
+	void initStart(uint64_t bytesPerSec, uint64_t opsPerSec, uint64_t refillIntervalUSec,
+		bool useSpinWait)
 	{
-		this->limitPerSec = limitPerSec;
-		this->numDoneThisSec = 0;
-		this->startT = std::chrono::steady_clock::now();
+		this->refillInterval = std::chrono::microseconds(std::max(refillIntervalUSec,
+			(uint64_t)1) );
+		this->useSpinWait = useSpinWait;
+		this->lastRefillT = std::chrono::steady_clock::now();
+
+		bytesBucket.init(bytesPerSec, refillInterval.count() );
+		opsBucket.init(opsPerSec, refillInterval.count() );
 	}
 
     /**
-     * Wait (sleep) if rate limit exceeded, otherwise return immediately.
-     *
-     * @nextSize whatever the rate limited unit is (e.g. bytes)
+     * Wait if the buckets are in debt, then take the tokens for the next op.
      *
+     * @nextSize size of next op in bytes.
+     * @isInterruptionRequested wait gets cancelled if this becomes true, so caller should check
+     * 	for interruption after return.
      * @return true if we had to wait, false if we are good to go immediately.
      */
-	bool wait(size_t nextSize)
+	bool wait(size_t nextSize, const std::atomic_bool& isInterruptionRequested)
 	{
 		std::chrono::steady_clock::time_point nowT = std::chrono::steady_clock::now();
-		std::chrono::microseconds elapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
-			(nowT - startT);
-
-		IF_UNLIKELY(elapsedMicroSec.count() >= 1000000)
-		{ // 1s elapsed without exceeding the rate limit => reset for next second
-			numDoneThisSec = nextSize;
-			startT = std::chrono::steady_clock::now();
-			return false;
-		}
-		else
-		IF_UNLIKELY( (numDoneThisSec + nextSize) > limitPerSec)
-		{ // next r/w op would exceed rate limit => wait until end of second
-			std::this_thread::sleep_until(startT + std::chrono::microseconds(1000000) );
-
-			numDoneThisSec = nextSize;
-			startT = std::chrono::steady_clock::now();
-			return true;
+
+		refill(nowT);
+
+		const std::chrono::steady_clock::time_point readyT = getReadyT();
+		const bool hadToWait = (readyT > nowT);
+
+		if(hadToWait)
+		{
+			const std::chrono::steady_clock::time_point sleepEndT = useSpinWait ?
+				(readyT - std::chrono::microseconds(RATELIMITER_SPIN_USEC) ) : readyT;
+
+			while( (nowT < sleepEndT) && !isInterruptionRequested)
+			{
+				std::this_thread::sleep_until(std::min(sleepEndT,
+					nowT + std::chrono::milliseconds(RATELIMITER_MAX_SLEEP_MS) ) );
+
+				nowT = std::chrono::steady_clock::now();
+			}
+
+			while( (nowT < readyT) && !isInterruptionRequested)
+				nowT = std::chrono::steady_clock::now(); // busy-wait
+
+			refill(nowT);
 		}
-		else
-		{ // rate limit not exceeded yet => proceed
-			numDoneThisSec += nextSize;
-            return false;
+
+		bytesBucket.take(nextSize);
+		opsBucket.take(1);
+
+		return hadToWait;
+	}
+
+	/**
+	 * Get the number of ops of the given size that can be done now without waiting, e.g. to
+	 * decide how many async IOs to submit. This does not take any tokens.
+	 *
+	 * @maxNumOps stop counting when this number is reached.
+	 */
+	size_t getNumReady(size_t opSize, size_t maxNumOps)
+	{
+		refill(std::chrono::steady_clock::now() );
+
+		RateLimiterTokenBucket peekBytesBucket(bytesBucket);
+		RateLimiterTokenBucket peekOpsBucket(opsBucket);
+		size_t numReady = 0;
+
+		while( (numReady < maxNumOps) && !peekBytesBucket.getNumIntervalsUntilReady() &&
+			!peekOpsBucket.getNumIntervalsUntilReady() )
+		{
+			numReady++;
+			peekBytesBucket.take(opSize);
+			peekOpsBucket.take(1);
 		}
 
+		return numReady;
+	}
+
+	/**
+	 * Get the time until the next op can be done without waiting; 0 if it can be done now.
+	 */
+	uint64_t getNanoSecUntilReady()
+	{
+		const std::chrono::steady_clock::time_point nowT = std::chrono::steady_clock::now();
+
+		refill(nowT);
+
+		const std::chrono::steady_clock::time_point readyT = getReadyT();
+
+		if(nowT >= readyT)
+			return 0;
+
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(readyT - nowT).count();
 	}
 
 };
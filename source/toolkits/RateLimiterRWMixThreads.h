@@ -14,7 +14,7 @@
 
 /**
  * In contrast to the general class RateLimiter where each thread is only staying within its own
- * limit (and thus can just sleep for the remainder of a second if the limit is exceeded)
+ * limit (and thus can just sleep until its own token bucket gets refilled)
  * this class balances a number of reader threads versus a number of writer threads. Thus, we need
  * allow some headroom for all threads to be active in parallel and to quickly wake up the other
  * thread group to not stall the global progress of all threads.
@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_RATELIMITERSHARED_H_
+#define TOOLKITS_RATELIMITERSHARED_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Common.h"
+#include "toolkits/RateLimiter.h"
+
+
+/**
+ * Lock-free shared budget for a single rate limited unit (e.g. bytes or ops), based on the generic
+ * cell rate algorithm: Instead of a token counter, we keep the time at which all budget given out
+ * so far is used up ("theoretical arrival time"). Each op atomically moves this time forward by
+ * its cost and has to wait until its own slot begins.
+ *
+ * Times are in picoseconds relative to the start time of the limiter, so that small ops at high
+ * rates don't suffer from rounding errors.
+ *
+ * The limit can be changed while threads are using the budget. A limit of 0 means unlimited.
+ */
+class RateLimiterSharedBudget
+{
+	private:
+		std::atomic_uint64_t limitPerSec{0}; // 0 means unlimited
+		std::atomic_uint64_t nextFreePicoSec{0}; // time when all given out budget is used up
+		uint64_t burstPicoSec{0}; // budget of an idle period that can be used without waiting
+
+		uint64_t calcCostPicoSec(uint64_t num, uint64_t limitPerSec) const
+		{
+			return (num * 1e12) / limitPerSec;
+		}
+
+	// inliners
+	public:
+		void init(uint64_t limitPerSec, uint64_t burstPicoSec)
+		{
+			this->limitPerSec = limitPerSec;
+			this->nextFreePicoSec = 0;
+			this->burstPicoSec = burstPicoSec;
+		}
+
+		void setLimit(uint64_t limitPerSec) { this->limitPerSec = limitPerSec; }
+		uint64_t getLimit() const { return limitPerSec; }
+
+		/**
+		 * Take budget for the next op.
+		 *
+		 * @return start time of the slot for this op; the op may start if this is not in the
+		 * 	future.
+		 */
+		uint64_t take(uint64_t num, uint64_t nowPicoSec)
+		{
+			const uint64_t currentLimitPerSec = limitPerSec.load(std::memory_order_relaxed);
+
+			if(!currentLimitPerSec)
+				return nowPicoSec;
+
+			const uint64_t costPicoSec = calcCostPicoSec(num, currentLimitPerSec);
+			const uint64_t minStartPicoSec =
+				(nowPicoSec > burstPicoSec) ? (nowPicoSec - burstPicoSec) : 0;
+
+			uint64_t oldNextFreePicoSec = nextFreePicoSec.load(std::memory_order_relaxed);
+			uint64_t startPicoSec;
+
+			do
+			{
+				startPicoSec = std::max(oldNextFreePicoSec, minStartPicoSec);
+			} while(!nextFreePicoSec.compare_exchange_weak(oldNextFreePicoSec,
+				startPicoSec + costPicoSec, std::memory_order_relaxed) );
+
+			return startPicoSec;
+		}
+
+		/**
+		 * Get the number of ops of the given size that could start now. This does not take any
+		 * budget.
+		 *
+		 * @maxNumOps stop counting when this number is reached.
+		 */
+		size_t getNumReady(uint64_t num, uint64_t nowPicoSec, size_t maxNumOps) const
+		{
+			const uint64_t currentLimitPerSec = limitPerSec.load(std::memory_order_relaxed);
+
+			if(!currentLimitPerSec)
+				return maxNumOps;
+
+			const uint64_t costPicoSec = std::max(calcCostPicoSec(num, currentLimitPerSec),
+				(uint64_t)1);
+			const uint64_t minStartPicoSec =
+				(nowPicoSec > burstPicoSec) ? (nowPicoSec - burstPicoSec) : 0;
+			const uint64_t startPicoSec = std::max(nextFreePicoSec.load(), minStartPicoSec);
+
+			if(startPicoSec > nowPicoSec)
+				return 0;
+
+			return std::min( ( (nowPicoSec - startPicoSec) / costPicoSec) + 1,
+				(uint64_t)maxNumOps);
+		}
+
+		/**
+		 * Get the time until the next op could start; 0 if it can start now.
+		 */
+		uint64_t getPicoSecUntilReady(uint64_t nowPicoSec) const
+		{
+			if(!limitPerSec.load(std::memory_order_relaxed) )
+				return 0;
+
+			const uint64_t currentNextFreePicoSec = nextFreePicoSec.load();
+
+			return (currentNextFreePicoSec > nowPicoSec) ?
+				(currentNextFreePicoSec - nowPicoSec) : 0;
+		}
+};
+
+/**
+ * Rate limiter for bytes and ops per second that is shared by all worker threads of this process,
+ * so that the limit applies to the sum of all threads. Threads which don't use their part of the
+ * budget (e.g. because their path is slower) leave it to the other threads.
+ *
+ * In contrast to the per-thread RateLimiter, the limits can be changed during a running phase,
+ * e.g. when the master of a distributed benchmark rebalances the per-host shares of a global
+ * limit.
+ */
+class RateLimiterShared
+{
+	private:
+		RateLimiterSharedBudget bytesBudget;
+		RateLimiterSharedBudget opsBudget;
+		std::chrono::steady_clock::time_point startT; // reference for budget times
+		bool useSpinWait{false}; // true to busy-wait for the last part of a wait
+
+		uint64_t getNowPicoSec(std::chrono::steady_clock::time_point nowT) const
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(nowT - startT).count() *
+				1000;
+		}
+
+	// inliners
+	public:
+
+	/**
+	 * Not thread-safe, so to be called before the workers start a new phase.
+	 *
+	 * @bytesPerSec byte limit of all threads together; 0 for unlimited.
+	 * @opsPerSec ops limit of all threads together; 0 for unlimited.
+	 * @refillIntervalUSec budget of an idle period of this length can be used without waiting.
+	 * @useSpinWait true to busy-wait for the last part of a wait for microsecond precision.
+	 */
+	void initStart(uint64_t bytesPerSec, uint64_t opsPerSec, uint64_t refillIntervalUSec,
+		bool useSpinWait)
+	{
+		const uint64_t burstPicoSec = std::max(refillIntervalUSec, (uint64_t)1) * 1000000;
+
+		this->startT = std::chrono::steady_clock::now();
+		this->useSpinWait = useSpinWait;
+
+		bytesBudget.init(bytesPerSec, burstPicoSec);
+		opsBudget.init(opsPerSec, burstPicoSec);
+	}
+
+	/**
+	 * Change the limits while threads might be waiting. Takes effect for the next op.
+	 */
+	void setLimits(uint64_t bytesPerSec, uint64_t opsPerSec)
+	{
+		bytesBudget.setLimit(bytesPerSec);
+		opsBudget.setLimit(opsPerSec);
+	}
+
+	uint64_t getLimitBytesPerSec() const { return bytesBudget.getLimit(); }
+	uint64_t getLimitOpsPerSec() const { return opsBudget.getLimit(); }
+
+	/**
+	 * Take the budget for the next op and wait until its slot begins.
+	 *
+	 * @nextSize size of next op in bytes.
+	 * @isInterruptionRequested wait gets cancelled if this becomes true, so caller should check
+	 * 	for interruption after return.
+	 * @return true if we had to wait, false if we are good to go immediately.
+	 */
+	bool wait(size_t nextSize, const std::atomic_bool& isInterruptionRequested)
+	{
+		std::chrono::steady_clock::time_point nowT = std::chrono::steady_clock::now();
+		const uint64_t nowPicoSec = getNowPicoSec(nowT);
+
+		const uint64_t readyPicoSec = std::max(bytesBudget.take(nextSize, nowPicoSec),
+			opsBudget.take(1, nowPicoSec) );
+
+		if(readyPicoSec <= nowPicoSec)
+			return false;
+
+		const std::chrono::steady_clock::time_point readyT =
+			startT + std::chrono::nanoseconds(readyPicoSec / 1000);
+		const std::chrono::steady_clock::time_point sleepEndT = useSpinWait ?
+			(readyT - std::chrono::microseconds(RATELIMITER_SPIN_USEC) ) : readyT;
+
+		while( (nowT < sleepEndT) && !isInterruptionRequested)
+		{
+			std::this_thread::sleep_until(std::min(sleepEndT,
+				nowT + std::chrono::milliseconds(RATELIMITER_MAX_SLEEP_MS) ) );
+
+			nowT = std::chrono::steady_clock::now();
+		}
+
+		while( (nowT < readyT) && !isInterruptionRequested)
+			nowT = std::chrono::steady_clock::now(); // busy-wait
+
+		return true;
+	}
+
+	/**
+	 * Get the number of ops of the given size that can be done now without waiting, e.g. to
+	 * decide how many async IOs to submit. This does not take any budget, so other threads
+	 * might take it first, in which case the following wait() will just be a bit longer.
+	 *
+	 * @maxNumOps stop counting when this number is reached.
+	 */
+	size_t getNumReady(size_t opSize, size_t maxNumOps) const
+	{
+		const uint64_t nowPicoSec = getNowPicoSec(std::chrono::steady_clock::now() );
+
+		return std::min(bytesBudget.getNumReady(opSize, nowPicoSec, maxNumOps),
+			opsBudget.getNumReady(1, nowPicoSec, maxNumOps) );
+	}
+
+	/**
+	 * Get the time until the next op can be done without waiting; 0 if it can be done now.
+	 */
+	uint64_t getNanoSecUntilReady() const
+	{
+		const uint64_t nowPicoSec = getNowPicoSec(std::chrono::steady_clock::now() );
+
+		return std::max(bytesBudget.getPicoSecUntilReady(nowPicoSec),
+			opsBudget.getPicoSecUntilReady(nowPicoSec) ) / 1000;
+	}
+
+};
+
+
+
+#endif /* TOOLKITS_RATELIMITERSHARED_H_ */
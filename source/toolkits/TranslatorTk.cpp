@@ -110,6 +110,7 @@ std::string TranslatorTk::benchPhaseToPhaseName(BenchPhase benchPhase, const Pro
         case BenchPhase_PUT_S3_BUCKET_MD: return PHASENAME_PUTBUCKETMETADATA;
         case BenchPhase_DEL_S3_BUCKET_MD: return PHASENAME_DELBUCKETMETADATA;
         case BenchPhase_S3MPUCOMPLETE: return PHASENAME_S3MPUCOMPLETE;
+		case BenchPhase_REPLAY: return PHASENAME_REPLAY;
 		default:
 		{ // should never happen
 			throw ProgException("Phase name requested for unknown/invalid phase type: " +
@@ -160,6 +161,7 @@ std::string TranslatorTk::benchPhaseToPhaseEntryType(BenchPhase benchPhase,
         case BenchPhase_PUT_S3_OBJECT_MD:
         case BenchPhase_DEL_S3_OBJECT_MD:
         case BenchPhase_S3MPUCOMPLETE:
+        case BenchPhase_REPLAY:
         {
             retVal = (progArgs->getBenchMode() == BenchMode_S3) ?
                 PHASEENTRYTYPE_OBJECTS : PHASEENTRYTYPE_FILES;
@@ -334,6 +336,85 @@ unsigned short TranslatorTk::flockArgsStrToType(std::string flockArgsStr)
         throw ProgException("Invalid file locking value: " + flockArgsStr);
 }
 
+/**
+ * Translate dedupe scope from user string to internal type.
+ *
+ * @dedupeScopeArgsStr scope from user (ARG_DEDUPESCOPE_x_NAME); empty means default thread scope.
+ * @return internal type (ARG_DEDUPESCOPE_x).
+ * @throw ProgException on invalid scope string.
+ */
+unsigned short TranslatorTk::dedupeScopeArgsStrToType(std::string dedupeScopeArgsStr)
+{
+    if(dedupeScopeArgsStr.empty() || (dedupeScopeArgsStr == ARG_DEDUPESCOPE_THREAD_NAME) )
+        return ARG_DEDUPESCOPE_THREAD;
+    else
+    if(dedupeScopeArgsStr == ARG_DEDUPESCOPE_HOST_NAME)
+        return ARG_DEDUPESCOPE_HOST;
+    else
+    if(dedupeScopeArgsStr == ARG_DEDUPESCOPE_GLOBAL_NAME)
+        return ARG_DEDUPESCOPE_GLOBAL;
+    else
+        throw ProgException("Invalid dedupe scope value: " + dedupeScopeArgsStr);
+}
+
+/**
+ * Translate open-loop arrival distribution from user string to internal type.
+ *
+ * @openLoopDistArgsStr dist from user (ARG_OPENLOOPDIST_x_NAME); empty means default fixed dist.
+ * @return internal type (ARG_OPENLOOPDIST_x).
+ * @throw ProgException on invalid dist string.
+ */
+unsigned short TranslatorTk::openLoopDistArgsStrToType(std::string openLoopDistArgsStr)
+{
+    if(openLoopDistArgsStr.empty() || (openLoopDistArgsStr == ARG_OPENLOOPDIST_FIXED_NAME) )
+        return ARG_OPENLOOPDIST_FIXED;
+    else
+    if(openLoopDistArgsStr == ARG_OPENLOOPDIST_POISSON_NAME)
+        return ARG_OPENLOOPDIST_POISSON;
+    else
+        throw ProgException("Invalid open-loop arrival distribution value: " +
+            openLoopDistArgsStr);
+}
+
+/**
+ * Translate rate limit scope from user string to internal type.
+ *
+ * @limitScopeArgsStr scope from user (ARG_LIMITSCOPE_x_NAME); empty means default thread scope.
+ * @return internal type (ARG_LIMITSCOPE_x).
+ * @throw ProgException on invalid scope string.
+ */
+unsigned short TranslatorTk::limitScopeArgsStrToType(std::string limitScopeArgsStr)
+{
+    if(limitScopeArgsStr.empty() || (limitScopeArgsStr == ARG_LIMITSCOPE_THREAD_NAME) )
+        return ARG_LIMITSCOPE_THREAD;
+    else
+    if(limitScopeArgsStr == ARG_LIMITSCOPE_HOST_NAME)
+        return ARG_LIMITSCOPE_HOST;
+    else
+    if(limitScopeArgsStr == ARG_LIMITSCOPE_GLOBAL_NAME)
+        return ARG_LIMITSCOPE_GLOBAL;
+    else
+        throw ProgException("Invalid rate limit scope value: " + limitScopeArgsStr);
+}
+
+/**
+ * Translate latency SLO search type from user string to internal type.
+ *
+ * @sloSearchArgsStr search type from user (ARG_SLOSEARCH_x_NAME); empty means default rate search.
+ * @return internal type (ARG_SLOSEARCH_x).
+ * @throw ProgException on invalid search type string.
+ */
+unsigned short TranslatorTk::sloSearchArgsStrToType(std::string sloSearchArgsStr)
+{
+    if(sloSearchArgsStr.empty() || (sloSearchArgsStr == ARG_SLOSEARCH_RATE_NAME) )
+        return ARG_SLOSEARCH_RATE;
+    else
+    if(sloSearchArgsStr == ARG_SLOSEARCH_IODEPTH_NAME)
+        return ARG_SLOSEARCH_IODEPTH;
+    else
+        throw ProgException("Invalid latency SLO search type value: " + sloSearchArgsStr);
+}
+
 /**
  * Get a human-readable string from an IntVec. The result groups ranges and comma-separates
  * non-consecutive numbers, e.g. "2,6-31,983". Grouping relies on intVec being sorted.
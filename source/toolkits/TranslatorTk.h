@@ -37,6 +37,10 @@ class TranslatorTk
 		static unsigned fadviseArgsStrToFlags(std::string fadviseArgsStr);
 		static unsigned madviseArgsStrToFlags(std::string madviseArgsStr);
         static unsigned short flockArgsStrToType(std::string flockArgsStr);
+        static unsigned short dedupeScopeArgsStrToType(std::string dedupeScopeArgsStr);
+        static unsigned short openLoopDistArgsStrToType(std::string openLoopDistArgsStr);
+        static unsigned short limitScopeArgsStrToType(std::string limitScopeArgsStr);
+        static unsigned short sloSearchArgsStrToType(std::string sloSearchArgsStr);
 		static std::string intVecToHumanStr(const IntVec& intVec);
 		static bool expandSquareBrackets(StringVec& inoutStrVec);
 		static bool replaceCommasOutsideOfSquareBrackets(std::string& inoutStr,
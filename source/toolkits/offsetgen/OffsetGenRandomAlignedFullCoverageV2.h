@@ -292,6 +292,21 @@ class OffsetGenRandomAlignedFullCoverageV2 : public OffsetGenerator
         virtual void addBytesSubmitted(size_t numBytes) override
             { numBytesLeft -= numBytes; }
 
+        virtual size_t getNextBatch(uint64_t* outOffsets, size_t* outBlockSizes,
+            size_t maxNum) override
+        {
+            const size_t numBlocks = calcBatchSize(numBytesLeft, blockSize, maxNum);
+
+            fillBatchBlockSizes(outBlockSizes, numBlocks, numBytesLeft, blockSize);
+
+            for(size_t i = 0; i < numBlocks; i++)
+                outOffsets[i] = randomGen.next() * blockSize;
+
+            numBytesLeft -= std::min(numBytesLeft, (uint64_t)numBlocks * blockSize);
+
+            return numBlocks;
+        }
+
     private:
         /**
          * Calculate min offset in number of blocks from beginning of file.
@@ -38,8 +38,63 @@ class OffsetGenerator
 		virtual uint64_t getNumBytesLeftToSubmit() const = 0;
 		virtual void addBytesSubmitted(size_t numBytes) = 0;
 
+		/**
+		 * Get the next offsets and block sizes to submit and count them as submitted. This is
+		 * equivalent to calling getNextOffset(), getNextBlockSizeToSubmit() and
+		 * addBytesSubmitted() for each block, but avoids the virtual call overhead per block.
+		 *
+		 * Subclasses override this with a specialized loop; this generic version is only the
+		 * fallback.
+		 *
+		 * @outOffsets array of at least maxNum elements to receive the offsets.
+		 * @outBlockSizes array of at least maxNum elements to receive the block sizes.
+		 * @maxNum max number of blocks to get.
+		 * @return number of filled elements in outOffsets/outBlockSizes; 0 if no bytes left.
+		 */
+		virtual size_t getNextBatch(uint64_t* outOffsets, size_t* outBlockSizes, size_t maxNum)
+		{
+			size_t numFilled = 0;
+
+			for( ; (numFilled < maxNum) && getNumBytesLeftToSubmit(); numFilled++)
+			{
+				outOffsets[numFilled] = getNextOffset();
+				outBlockSizes[numFilled] = getNextBlockSizeToSubmit();
+				addBytesSubmitted(outBlockSizes[numFilled]);
+			}
+
+			return numFilled;
+		}
+
 	protected:
 		OffsetGenerator() {};
+
+		/**
+		 * Number of blocks that getNextBatch() can return for the given number of bytes left,
+		 * taking into account that the last block might be a partial block.
+		 */
+		static size_t calcBatchSize(uint64_t numBytesLeft, size_t blockSize, size_t maxNum)
+		{
+			IF_UNLIKELY(!blockSize)
+				return 0; // avoid div by zero
+
+			const uint64_t numBlocksLeft = (numBytesLeft + blockSize - 1) / blockSize;
+
+			return (numBlocksLeft < maxNum) ? numBlocksLeft : maxNum;
+		}
+
+		/**
+		 * Fill block sizes for a batch of numBlocks. All blocks are full blocks, except for the
+		 * last block of the remaining numBytesLeft, which might be a partial block.
+		 */
+		static void fillBatchBlockSizes(size_t* outBlockSizes, size_t numBlocks,
+			uint64_t numBytesLeft, size_t blockSize)
+		{
+			for(size_t i = 0; i < numBlocks; i++)
+				outBlockSizes[i] = blockSize;
+
+			IF_UNLIKELY(numBytesLeft < ( (uint64_t)numBlocks * blockSize) )
+				outBlockSizes[numBlocks - 1] = numBytesLeft - ( (numBlocks - 1) * blockSize);
+		}
 };
 
 /**
@@ -98,6 +153,23 @@ class OffsetGenSequential : public OffsetGenerator
 			numBytesLeft -= numBytes;
 			currentOffset += numBytes;
 		}
+
+		virtual size_t getNextBatch(uint64_t* outOffsets, size_t* outBlockSizes,
+			size_t maxNum) override
+		{
+			const size_t numBlocks = calcBatchSize(numBytesLeft, blockSize, maxNum);
+
+			fillBatchBlockSizes(outBlockSizes, numBlocks, numBytesLeft, blockSize);
+
+			for(size_t i = 0; i < numBlocks; i++)
+			{
+				outOffsets[i] = currentOffset;
+				currentOffset += outBlockSizes[i];
+				numBytesLeft -= outBlockSizes[i];
+			}
+
+			return numBlocks;
+		}
 };
 
 /**
@@ -224,6 +296,19 @@ class OffsetGenRandom : public OffsetGenerator
 		virtual uint64_t getNextOffset() override
 			{ return randRange.next(); }
 
+		virtual size_t getNextBatch(uint64_t* outOffsets, size_t* outBlockSizes,
+			size_t maxNum) override
+		{
+			const size_t numBlocks = calcBatchSize(numBytesLeft, blockSize, maxNum);
+
+			fillBatchBlockSizes(outBlockSizes, numBlocks, numBytesLeft, blockSize);
+			randRange.nextBatch(outOffsets, numBlocks);
+
+			numBytesLeft -= std::min(numBytesLeft, (uint64_t)numBlocks * blockSize);
+
+			return numBlocks;
+		}
+
 		virtual size_t getBlockSize() const override
 			{ return blockSize; }
 
@@ -300,6 +385,22 @@ class OffsetGenRandomAligned : public OffsetGenerator
 		virtual uint64_t getNextOffset() override
 			{ return offset + (randRange.next() * blockSize); }
 
+		virtual size_t getNextBatch(uint64_t* outOffsets, size_t* outBlockSizes,
+			size_t maxNum) override
+		{
+			const size_t numBlocks = calcBatchSize(numBytesLeft, blockSize, maxNum);
+
+			fillBatchBlockSizes(outBlockSizes, numBlocks, numBytesLeft, blockSize);
+			randRange.nextBatch(outOffsets, numBlocks);
+
+			for(size_t i = 0; i < numBlocks; i++)
+				outOffsets[i] = offset + (outOffsets[i] * blockSize);
+
+			numBytesLeft -= std::min(numBytesLeft, (uint64_t)numBlocks * blockSize);
+
+			return numBlocks;
+		}
+
 		virtual size_t getBlockSize() const override
 			{ return blockSize; }
 
@@ -375,6 +476,24 @@ class OffsetGenStrided : public OffsetGenerator
             numBytesLeft -= numBytes;
             currentOffset += (blockSize * numDataSetThreads);
         }
+
+        virtual size_t getNextBatch(uint64_t* outOffsets, size_t* outBlockSizes,
+            size_t maxNum) override
+        {
+            const size_t numBlocks = calcBatchSize(numBytesLeft, blockSize, maxNum);
+            const uint64_t strideLen = blockSize * numDataSetThreads;
+
+            fillBatchBlockSizes(outBlockSizes, numBlocks, numBytesLeft, blockSize);
+
+            for(size_t i = 0; i < numBlocks; i++)
+            {
+                outOffsets[i] = currentOffset;
+                currentOffset += strideLen;
+                numBytesLeft -= outBlockSizes[i];
+            }
+
+            return numBlocks;
+        }
 };
 
 #endif /* OFFSETGENERATOR_H_ */
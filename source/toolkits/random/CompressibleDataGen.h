@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_RANDOM_COMPRESSIBLEDATAGEN_H_
+#define TOOLKITS_RANDOM_COMPRESSIBLEDATAGEN_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "ProgException.h"
+#include "RandAlgoInterface.h"
+
+#define COMPRESSIBLEDATAGEN_CHUNK_LEN		4096 // back references don't cross chunk boundaries
+#define COMPRESSIBLEDATAGEN_MIN_MATCH_LEN	32 // min avg length of back reference copies
+#define COMPRESSIBLEDATAGEN_MATCH_OVERHEAD	3 // approx. compressed bytes per LZ back reference
+
+
+/**
+ * Wrapper for random algo that fills buffers with data that compresses to a given target ratio.
+ *
+ * The data is a sequence of random literal runs, each followed by a copy of a random earlier part
+ * of the same chunk, which is what LZ-style compressors (lz4, zstd, deflate) turn into back
+ * references. The literal bytes come from the random algo and thus have full entropy, so the ratio
+ * is mostly determined by the literal share. Back references never cross the boundaries of
+ * COMPRESSIBLEDATAGEN_CHUNK_LEN, so the ratio also holds for storage systems that compress each
+ * 4KiB independently.
+ */
+class CompressibleDataGen
+{
+	public:
+		/**
+		 * @targetRatio compression ratio to aim for, e.g. 2.0 for "2:1". 1.0 means fully random.
+		 * @throw ProgException if targetRatio < 1.
+		 */
+		CompressibleDataGen(RandAlgoInterface& randAlgo, double targetRatio) :
+			randAlgo(randAlgo)
+		{
+			if(targetRatio < 1)
+				throw ProgException("CompressibleDataGen: Compression ratio must not be smaller "
+					"than 1. Given ratio: " + std::to_string(targetRatio) );
+
+			const double literalFraction = 1 / targetRatio;
+
+			/* per literal+match sequence, compressed size is approx. "literalLen + overhead", so:
+				"literalLen + overhead = literalFraction * (literalLen + matchLen)". match len is
+				increased for high ratios, so that literal len doesn't get too close to 0. */
+
+			avgMatchLen = std::max( (double)COMPRESSIBLEDATAGEN_MIN_MATCH_LEN,
+				4 * COMPRESSIBLEDATAGEN_MATCH_OVERHEAD * targetRatio);
+
+			avgLiteralLen = (literalFraction >= 1) ? 0 :
+				std::max(0.0, (literalFraction * avgMatchLen - COMPRESSIBLEDATAGEN_MATCH_OVERHEAD) /
+					(1 - literalFraction) );
+
+			isFullyRandom = (literalFraction >= 1);
+		}
+
+	private:
+		RandAlgoInterface& randAlgo;
+		double avgMatchLen; // average length of copies from earlier data
+		double avgLiteralLen; // average length of random literal runs between copies
+		bool isFullyRandom; // true for target ratio 1.0
+
+	public:
+		/**
+		 * Fill the entire given buffer with compressible data.
+		 */
+		void fillBuf(char* buf, uint64_t bufLen)
+		{
+			if(isFullyRandom)
+			{
+				randAlgo.fillBuf(buf, bufLen);
+				return;
+			}
+
+			for(uint64_t chunkStart = 0; chunkStart < bufLen;
+				chunkStart += COMPRESSIBLEDATAGEN_CHUNK_LEN)
+			{
+				const uint64_t chunkLen =
+					std::min(bufLen - chunkStart, (uint64_t)COMPRESSIBLEDATAGEN_CHUNK_LEN);
+
+				fillChunk(&buf[chunkStart], chunkLen);
+			}
+		}
+
+	private:
+		/**
+		 * Fill a single chunk. Back references only point to earlier data within this chunk.
+		 */
+		void fillChunk(char* chunkBuf, uint64_t chunkLen)
+		{
+			/* copy sources start within literal runs, because fast LZ compressors (e.g. lz4) don't
+				index positions inside of their own back references */
+			uint16_t literalRunStarts[COMPRESSIBLEDATAGEN_CHUNK_LEN];
+			uint16_t literalRunLens[COMPRESSIBLEDATAGEN_CHUNK_LEN];
+			size_t numLiteralRuns = 0;
+			uint64_t pos = 0;
+
+			while(pos < chunkLen)
+			{
+				const uint64_t randVal = randAlgo.next();
+
+				// random lengths in range [avg/2, avg*3/2] to avoid regular patterns
+				uint64_t literalLen = varyLen(avgLiteralLen, randVal & 0xFFFF);
+				uint64_t matchLen = varyLen(avgMatchLen, (randVal >> 16) & 0xFFFF);
+
+				if(!pos && !literalLen)
+					literalLen = 1; // need at least 1 byte as source for the first copy
+
+				literalLen = std::min(literalLen, chunkLen - pos);
+
+				if(literalLen)
+				{
+					randAlgo.fillBuf(&chunkBuf[pos], literalLen);
+
+					literalRunStarts[numLiteralRuns] = pos;
+					literalRunLens[numLiteralRuns] = literalLen;
+					numLiteralRuns++;
+
+					pos += literalLen;
+				}
+
+				matchLen = std::min(matchLen, chunkLen - pos);
+				if(!matchLen)
+					continue;
+
+				// copy from random earlier literal run (copy can overlap with its destination)
+				const size_t runIdx = ( (randVal >> 32) & 0xFFFF) % numLiteralRuns;
+				const uint64_t srcPos = literalRunStarts[runIdx] +
+					( (randVal >> 48) % literalRunLens[runIdx] );
+
+				for(uint64_t i=0; i < matchLen; i++)
+					chunkBuf[pos + i] = chunkBuf[srcPos + i];
+
+				pos += matchLen;
+			}
+		}
+
+		/**
+		 * @randVal16 16bit random value to select len in range [avgLen/2, avgLen*3/2].
+		 */
+		static uint64_t varyLen(double avgLen, uint64_t randVal16)
+		{
+			return (uint64_t) (avgLen * (0.5 + (randVal16 / 65536.0) ) + 0.5);
+		}
+};
+
+#endif /* TOOLKITS_RANDOM_COMPRESSIBLEDATAGEN_H_ */
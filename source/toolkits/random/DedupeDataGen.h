@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: 2020-2026 Sven Breuner and elbencho contributors
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef TOOLKITS_RANDOM_DEDUPEDATAGEN_H_
+#define TOOLKITS_RANDOM_DEDUPEDATAGEN_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include "CompressibleDataGen.h"
+#include "ProgException.h"
+#include "RandAlgoXoshiro256ss.h"
+
+
+/**
+ * Generator for write data with a given dedupe ratio.
+ *
+ * Data is generated in chunks of the dedupe granularity. Each chunk is either unique or a duplicate
+ * of an earlier unique chunk. The content of a unique chunk is fully defined by the seed, the data
+ * rank that generated it and the chunk's index in the sequence of unique chunks of this rank. The
+ * decision whether the next chunk is a duplicate and which chunk it duplicates is also derived from
+ * the seed. Thus, the same seed results in the same data across runs and every data rank (e.g.
+ * on another host) can regenerate any unique chunk of any other data rank without communication.
+ *
+ * Duplicates only refer to unique chunks with an index smaller than the own number of unique
+ * chunks so far. For scopes with multiple data ranks, this means the duplicated chunk was written
+ * before or at about the same time by the other rank, assuming all ranks write the same amount.
+ */
+class DedupeDataGen
+{
+	public:
+		/**
+		 * @seed base seed for all decisions and chunk contents; all data ranks that should share
+		 * 	duplicates need to use the same seed.
+		 * @dedupePercent percentage of chunks that are duplicates of earlier unique chunks.
+		 * @chunkSize dedupe granularity.
+		 * @dataRank rank to generate unique chunks for.
+		 * @scopeRankStart first rank of the range to select duplicate sources from.
+		 * @scopeNumRanks number of ranks in the range to select duplicate sources from.
+		 * @compressRatio compress ratio for chunk contents (0 or 1 for random data).
+		 * @throw ProgException on invalid args.
+		 */
+		DedupeDataGen(uint64_t seed, unsigned dedupePercent, size_t chunkSize, size_t dataRank,
+			size_t scopeRankStart, size_t scopeNumRanks, double compressRatio) :
+			seed(seed), dedupePercent(dedupePercent), chunkSize(chunkSize), dataRank(dataRank),
+			scopeRankStart(scopeRankStart), scopeNumRanks(scopeNumRanks), chunkAlgo(seed)
+		{
+			if(!chunkSize)
+				throw ProgException("DedupeDataGen: Chunk size must not be 0.");
+
+			if(!scopeNumRanks)
+				throw ProgException("DedupeDataGen: Number of ranks in scope must not be 0.");
+
+			if(dedupePercent >= 100)
+				throw ProgException("DedupeDataGen: Dedupe percentage must be smaller than 100. "
+					"Given percentage: " + std::to_string(dedupePercent) );
+
+			if(compressRatio > 1)
+				compressibleDataGen = std::make_unique<CompressibleDataGen>(chunkAlgo,
+					compressRatio);
+		}
+
+	private:
+		uint64_t seed;
+		unsigned dedupePercent;
+		size_t chunkSize;
+		size_t dataRank; // rank for own unique chunks
+		size_t scopeRankStart; // first rank for duplicate sources
+		size_t scopeNumRanks; // number of ranks for duplicate sources
+		uint64_t numChunksDone{0}; // number of generated chunks (unique and dups)
+		uint64_t numUniqueChunksDone{0}; // number of generated unique chunks
+
+		RandAlgoXoshiro256ss chunkAlgo; // reseeded for each chunk to generate its content
+		std::unique_ptr<CompressibleDataGen> compressibleDataGen; // for chunks with compress ratio
+
+	public:
+		/**
+		 * Fill the given buffer with the next chunks. A buffer len that is not a multiple of chunk
+		 * size gets a truncated last chunk, which still counts as a full chunk.
+		 */
+		void fillBuf(char* buf, uint64_t bufLen)
+		{
+			for(uint64_t chunkStart = 0; chunkStart < bufLen; chunkStart += chunkSize)
+			{
+				const uint64_t chunkLen = std::min(bufLen - chunkStart, (uint64_t)chunkSize);
+
+				fillNextChunk(&buf[chunkStart], chunkLen);
+			}
+		}
+
+		/**
+		 * Expected dedupe ratio of the generated data for the given percentage, e.g. 2.0 for 50%.
+		 */
+		static double getExpectedDedupeRatio(unsigned dedupePercent)
+		{
+			return (dedupePercent >= 100) ? 0 : (100.0 / (100 - dedupePercent) );
+		}
+
+	private:
+		void fillNextChunk(char* chunkBuf, uint64_t chunkLen)
+		{
+			const uint64_t decisionVal = hash(seed, dataRank, numChunksDone);
+
+			numChunksDone++;
+
+			size_t srcRank = dataRank;
+			uint64_t srcUniqueIdx;
+
+			if(numUniqueChunksDone && ( (decisionVal % 100) < dedupePercent) )
+			{ // duplicate of earlier unique chunk
+				uint64_t srcVal = hash(~seed, dataRank, numChunksDone);
+
+				srcUniqueIdx = srcVal % numUniqueChunksDone;
+				srcRank = scopeRankStart +
+					(RandAlgoXoshiro256ss::splitmix64(srcVal) % scopeNumRanks);
+			}
+			else
+				srcUniqueIdx = numUniqueChunksDone++; // new unique chunk
+
+			chunkAlgo.reseed(hash(seed, srcRank, srcUniqueIdx) );
+
+			if(compressibleDataGen)
+				compressibleDataGen->fillBuf(chunkBuf, chunkLen);
+			else
+				chunkAlgo.fillBuf(chunkBuf, chunkLen);
+		}
+
+		/**
+		 * Combine the given values to a well-distributed 64bit value.
+		 */
+		static uint64_t hash(uint64_t seed, uint64_t val1, uint64_t val2)
+		{
+			uint64_t state = seed;
+
+			state = RandAlgoXoshiro256ss::splitmix64(state) ^ val1;
+			state = RandAlgoXoshiro256ss::splitmix64(state) ^ val2;
+
+			return RandAlgoXoshiro256ss::splitmix64(state);
+		}
+};
+
+#endif /* TOOLKITS_RANDOM_DEDUPEDATAGEN_H_ */
@@ -53,6 +53,18 @@ class RandAlgoRange
 			uint64_t nextVal = randAlgo.next() % lengthPlusOne;
 			return nextVal + start;
 		}
+
+		/**
+		 * Fill the given array with random values within range. This uses the fillBuf() of the
+		 * random algo (which might be SIMD based) to avoid a virtual call per value.
+		 */
+		void nextBatch(uint64_t* outVals, size_t numVals)
+		{
+			randAlgo.fillBuf( (char*)outVals, numVals * sizeof(uint64_t) );
+
+			for(size_t i = 0; i < numVals; i++)
+				outVals[i] = (outVals[i] % lengthPlusOne) + start;
+		}
 };
 
 #endif /* TOOLKITS_RANDOM_RANDALGORANGE_H_ */
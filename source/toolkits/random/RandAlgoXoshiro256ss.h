@@ -28,6 +28,14 @@ class RandAlgoXoshiro256ss : public RandAlgoInterface
 					( (uint64_t)std::random_device()() << 32) | (uint32_t)std::random_device()();
 		}
 
+		/**
+		 * Init with a fixed seed to get a reproducible sequence of numbers.
+		 */
+		RandAlgoXoshiro256ss(uint64_t seed)
+		{
+			reseed(seed);
+		}
+
 		virtual ~RandAlgoXoshiro256ss() {}
 
 	private:
@@ -38,6 +46,31 @@ class RandAlgoXoshiro256ss : public RandAlgoInterface
 
 		// inliners
 	public:
+		/**
+		 * Reset the state based on the given seed, so that the same seed always results in the
+		 * same sequence of numbers. The 4 state values are derived via splitmix64, as recommended
+		 * by the xoshiro authors.
+		 */
+		void reseed(uint64_t seed)
+		{
+			for(int i=0; i < 4; i++)
+				state.s[i] = splitmix64(seed);
+		}
+
+		/**
+		 * splitmix64 generator step. Also useful as a fast hash function to derive
+		 * well-distributed seeds from consecutive numbers.
+		 *
+		 * @seed will be advanced to the next state.
+		 */
+		static uint64_t splitmix64(uint64_t& seed)
+		{
+			uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+			z = (z ^ (z >> 30) ) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27) ) * 0x94d049bb133111ebULL;
+			return z ^ (z >> 31);
+		}
+
 		virtual uint64_t next() override
 		{
 			return nextInternal();
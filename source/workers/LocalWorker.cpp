@@ -7,6 +7,7 @@
 #include <string>
 #include <sys/mman.h>
 #include <sys/socket.h>
+#include <thread>
 
 #include "Common.h"
 #include "LocalWorker.h"
@@ -70,9 +71,13 @@
 #define INTERRUPTION_CHECK_INTERVAL		128
 #define AIO_MAX_WAIT_SEC				5
 #define AIO_MAX_EVENTS					4  // max number of events to retrieve in io_getevents()
+#define IOURING_SQPOLL_IDLE_MS			2000 // idle time before io_uring sq poll thread sleeps
+#define INTEGRITYCHECK_NWAY				8 // 64bit values per chunk for SIMD fill/verify
+#define BLOCKVARPOOL_STAMP_INTERVAL		4096 // distance of unique values in reused pool blocks
 #define NETBENCH_CONNECT_TIMEOUT_SEC	20 // max time for servers to wait and clients to retry
 #define NETBENCH_RECEIVE_TIMEOUT_SEC	20 // max time to wait for incoming data on client & server
 #define NETBENCH_SHORT_POLL_TIMEOUT_SEC	2  // time to check for interrupts in longer poll wait loops
+#define REPLAY_MAX_SLEEP_MS				100 // max sleep per round to check for interruption requests
 
 #define TAG_CHECKSUM_LEN        2
 
@@ -209,6 +214,8 @@ void LocalWorker::run()
 			waitForNextPhase(currentBenchID);
 
 			currentBenchID = workersSharedData->currentBenchID;
+			opsLog.beginTracePhase();
+			resourceStats.startPhase();
 			bool doInfiniteIOLoop = progArgs->getDoInfiniteIOLoop();
 
 			do // for infinite I/O loop
@@ -286,6 +293,11 @@ void LocalWorker::run()
                         s3ModeIterateAndCompleteMpuIDs();
                     } break;
 
+                    case BenchPhase_REPLAY:
+                    {
+                        replayModeIterateOps();
+                    } break;
+
                     case BenchPhase_GET_S3_OBJECT_MD:
                     case BenchPhase_PUT_S3_OBJECT_MD:
                     case BenchPhase_DEL_S3_OBJECT_MD:
@@ -433,10 +445,13 @@ void LocalWorker::preparePhase()
 
     allocIOBuffer();
     allocGPUIOBuffer();
+    allocBlockVarPool();
 
     prepareCustomTreePathStores();
+    prepareReplayOps();
 
     initLibAio();
+    initIOUring();
     initS3Client();
     initHDFS();
     initNetBench();
@@ -454,21 +469,42 @@ void LocalWorker::preparePhase()
  */
 void LocalWorker::finishPhase()
 {
+	/* apply pending warmup end before stats get frozen, because checkInterruptionRequest() might
+		not get called anymore. (mutex sync with WorkerManager::checkPhaseWarmupEnd(), which skips
+		the warmup end for all workers if one is finishing already.) */
+	{
+		std::unique_lock<std::mutex> lock(workersSharedData->mutex); // L O C K (scoped)
+
+		isFinishingPhase = true;
+
+		IF_UNLIKELY(isWarmupEndRequested)
+			resetStatsAfterWarmup();
+	}
+
 	if(!workerGotPhaseWork)
 		elapsedUSecVec.resize(0);
 	else
 	{
 		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
 
+		// results after warmup only cover the time since the stats reset
+		const std::chrono::steady_clock::time_point startT =
+			isWarmupEnded ? warmupEndT : workersSharedData->phaseStartT;
+
 		std::chrono::microseconds elapsedDurationUSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
-			(now - workersSharedData->phaseStartT);
+			std::chrono::duration_cast<std::chrono::microseconds>(now - startT);
 		uint64_t finishElapsedUSec = elapsedDurationUSec.count();
 
 		elapsedUSecVec.resize(1);
 		elapsedUSecVec[0] = finishElapsedUSec;
 	}
 
+	resourceStats.endPhase();
+
+	// write trace events before inc, so that trace file is complete when the phase is done
+	opsLog.endTracePhase(
+		TranslatorTk::benchPhaseToPhaseName(workersSharedData->currentBenchPhase, progArgs) );
+
 	phaseFinished = true; // before incNumWorkersDone() because Coordinator can reset after inc
 
 	incNumWorkersDone();
@@ -480,13 +516,18 @@ void LocalWorker::initLibAio()
 
     const size_t maxIODepth = progArgs->getIODepth();
 
-    if(maxIODepth < 2)
+    if( (maxIODepth < 2) || progArgs->getUseIOUring() )
         return; // no libaio needed
 
     libaioContext.ioContext = (io_context_t)0; // zeroing required by io_queue_init
     libaioContext.iocbVec.resize(maxIODepth);
     libaioContext.iocbPointerVec.resize(maxIODepth);
+    libaioContext.ioEventVec.resize(maxIODepth);
+    libaioContext.freeSlotVec.reserve(maxIODepth);
     libaioContext.ioStartTimeVec.resize(maxIODepth);
+    libaioContext.intendedStartTimeVec.resize(maxIODepth);
+    offsetBatchVec.resize(maxIODepth);
+    blockSizeBatchVec.resize(maxIODepth);
 
     int initRes = io_queue_init(maxIODepth, &libaioContext.ioContext);
     IF_UNLIKELY(initRes)
@@ -502,7 +543,7 @@ void LocalWorker::uninitLibAio()
 
     const size_t maxIODepth = progArgs->getIODepth();
 
-    if(maxIODepth < 2)
+    if( (maxIODepth < 2) || progArgs->getUseIOUring() )
         return; // no libaio needed
 
     if(libaioContext.ioContext != NULL)
@@ -511,6 +552,117 @@ void LocalWorker::uninitLibAio()
 #endif // LIBAIO_SUPPORT
 }
 
+/**
+ * Create the io_uring for this worker and register ioBufVec with it. Does nothing if io_uring was
+ * not selected by user.
+ *
+ * Buffer registration failure (e.g. due to RLIMIT_MEMLOCK) is not fatal; we fall back to
+ * unregistered buffers in that case.
+ *
+ * @throw WorkerException if ring creation fails.
+ */
+void LocalWorker::initIOUring()
+{
+#ifdef LIBURING_SUPPORT
+
+    if(!progArgs->getUseIOUring() )
+        return; // no io_uring needed
+
+    const size_t maxIODepth = progArgs->getIODepth();
+
+    struct io_uring_params ringParams = {};
+
+    if(progArgs->getUseIOUringSQPoll() )
+    {
+        ringParams.flags |= IORING_SETUP_SQPOLL;
+        ringParams.sq_thread_idle = IOURING_SQPOLL_IDLE_MS;
+    }
+
+    if(progArgs->getUseIOUringIOPoll() )
+        ringParams.flags |= IORING_SETUP_IOPOLL;
+
+    /* note: +1 for the timeout sqe that liburing needs for io_uring_wait_cqes() on kernels
+        without IORING_FEAT_EXT_ARG */
+    int initRes = io_uring_queue_init_params(maxIODepth + 1, &iouringContext.ring, &ringParams);
+    IF_UNLIKELY(initRes)
+        throw WorkerException(std::string("Initializing io_uring (io_uring_queue_init_params) "
+            "failed. ") +
+            "Queue depth: " + std::to_string(maxIODepth) + "; "
+            "SQPoll: " + (progArgs->getUseIOUringSQPoll() ? "yes" : "no") + "; "
+            "IOPoll: " + (progArgs->getUseIOUringIOPoll() ? "yes" : "no") + "; "
+            "SysErr: " + strerror(-initRes) ); // (liburing returns negative errno)
+
+    iouringContext.isRingInitialized = true;
+    iouringContext.isFileTableRegistered = false;
+    iouringContext.useFixedFiles = false;
+    iouringContext.useFixedBufs = false;
+    iouringContext.numPending = 0;
+    iouringContext.requestVec.resize(maxIODepth);
+    iouringContext.ioStartTimeVec.resize(maxIODepth);
+    iouringContext.intendedStartTimeVec.resize(maxIODepth);
+    iouringContext.preppedSlotVec.reserve(maxIODepth);
+    offsetBatchVec.resize(maxIODepth);
+    blockSizeBatchVec.resize(maxIODepth);
+
+    // slot stack in reverse order, so that slot 0 gets used first
+    iouringContext.freeSlotVec.clear();
+    for(size_t slotIdx = maxIODepth; slotIdx > 0; slotIdx--)
+        iouringContext.freeSlotVec.push_back(slotIdx - 1);
+
+    if(ioBufVec.empty() )
+        return; // nothing to register
+
+    // (note: blockVarPoolVec bufs get registered behind ioBufVec, see uringBlockSized() )
+    std::vector<struct iovec> ioVecs(ioBufVec.size() + blockVarPoolVec.size() );
+
+    for(size_t i=0; i < ioBufVec.size(); i++)
+    {
+        ioVecs[i].iov_base = ioBufVec[i];
+        ioVecs[i].iov_len = progArgs->getBlockSize();
+    }
+
+    for(size_t i=0; i < blockVarPoolVec.size(); i++)
+    {
+        ioVecs[ioBufVec.size() + i].iov_base = blockVarPoolVec[i];
+        ioVecs[ioBufVec.size() + i].iov_len = progArgs->getBlockSize();
+    }
+
+    int regRes = io_uring_register_buffers(&iouringContext.ring, ioVecs.data(), ioVecs.size() );
+    IF_UNLIKELY(regRes)
+    {
+        ERRLOGGER(Log_VERBOSE, "io_uring buffer registration failed. "
+            "Falling back to unregistered buffers. "
+            "Rank: " << workerRank << "; "
+            "Number of buffers: " << ioVecs.size() << "; "
+            "SysErr: " << strerror(-regRes) << std::endl);
+        return;
+    }
+
+    iouringContext.useFixedBufs = true;
+
+#endif // LIBURING_SUPPORT
+}
+
+void LocalWorker::uninitIOUring()
+{
+#ifdef LIBURING_SUPPORT
+
+    if(!iouringContext.isRingInitialized)
+        return;
+
+    uringDrainPending(); // kernel must not access ioBufVec anymore after this returns
+
+    // (note: this also unregisters buffers and files)
+    io_uring_queue_exit(&iouringContext.ring);
+
+    iouringContext.isRingInitialized = false;
+    iouringContext.isFileTableRegistered = false;
+    iouringContext.useFixedFiles = false;
+    iouringContext.useFixedBufs = false;
+
+#endif // LIBURING_SUPPORT
+}
+
 /**
  * Initialize AWS S3 SDK & S3 client object. Intended to be called at the start of each benchmark
  * phase. Will do nothing if not built with S3 support or no S3 endpoints defined.
@@ -1153,6 +1305,17 @@ void LocalWorker::initPhaseRWOffsetGen()
 	randBlockVarAlgo = RandAlgoSelectorTk::stringToAlgo(progArgs->getBlockVarianceAlgo() );
 	randBlockVarReseed = std::make_unique<RandAlgoXoshiro256ss>();
 
+	if(progArgs->getCompressRatio() && !progArgs->getDedupePercent() )
+		compressibleDataGen = std::make_unique<CompressibleDataGen>(*randBlockVarAlgo,
+			progArgs->getCompressRatio() );
+	else
+		compressibleDataGen.reset();
+
+	if(progArgs->getDedupePercent() )
+		initPhaseDedupeDataGen();
+	else
+		dedupeDataGen.reset();
+
 	// init algo for random offsets within files
     randOffsetAlgo = RandAlgoSelectorTk::stringToAlgo(progArgs->getRandOffsetAlgo().empty() ?
         RANDALGO_BALANCED_SEQUENTIAL_STR : progArgs->getRandOffsetAlgo() );
@@ -1185,6 +1348,38 @@ void LocalWorker::initPhaseRWOffsetGen()
 	} // end of random aligned
 }
 
+/**
+ * Init the generator for data with user-defined dedupe ratio. The data rank of this worker and
+ * the range of ranks to pick duplicate sources from are based on the dedupe rank offset of this
+ * host, which is unique per host also if hosts don't work on a shared dataset.
+ */
+void LocalWorker::initPhaseDedupeDataGen()
+{
+	const size_t numThreads = progArgs->getNumThreads();
+	const size_t localWorkerRank = workerRank - progArgs->getRankOffset();
+	const size_t dedupeRankOffset = progArgs->getDedupeRankOffset();
+	const size_t dataRank = dedupeRankOffset + localWorkerRank;
+
+	size_t scopeRankStart = dataRank;
+	size_t scopeNumRanks = 1;
+
+	if(progArgs->getDedupeScope() == ARG_DEDUPESCOPE_HOST)
+	{
+		scopeRankStart = dedupeRankOffset;
+		scopeNumRanks = numThreads;
+	}
+	else
+	if(progArgs->getDedupeScope() == ARG_DEDUPESCOPE_GLOBAL)
+	{
+		scopeRankStart = 0;
+		scopeNumRanks = progArgs->getDedupeNumRanks();
+	}
+
+	dedupeDataGen = std::make_unique<DedupeDataGen>(progArgs->getDedupeSeed(),
+		progArgs->getDedupePercent(), progArgs->getDedupeChunkSize(), dataRank, scopeRankStart,
+		scopeNumRanks, progArgs->getCompressRatio() );
+}
+
 /**
  * Just set all phase-dependent function pointers to NULL.
  */
@@ -1222,6 +1417,11 @@ void LocalWorker::initPhaseFunctionPointers()
     const unsigned rwMixReadPercent = progArgs->getRWMixReadPercent();
     const uint64_t perThreadWriteRateLimitBps = progArgs->getLimitWriteBps();
     const uint64_t perThreadReadRateLimitBps = progArgs->getLimitReadBps();
+    const uint64_t perThreadWriteRateLimitIOPS = progArgs->getLimitWriteIOPS();
+    const uint64_t perThreadReadRateLimitIOPS = progArgs->getLimitReadIOPS();
+    const uint64_t rateLimitRefillUSec = progArgs->getLimitRefillUSec();
+    const bool useRateLimitSpin = progArgs->getUseLimitSpin();
+    const bool useSharedRateLimit = (progArgs->getLimitScope() != ARG_LIMITSCOPE_THREAD);
     const size_t numRWMixReadThreads = progArgs->getNumRWMixReadThreads();
     const size_t numRWMixWriteThreads = progArgs->getNumThreads() - numRWMixReadThreads;
     const unsigned rwMixThreadsReadPercent = progArgs->getRWMixThreadsReadPercent();
@@ -1261,9 +1461,6 @@ void LocalWorker::initPhaseFunctionPointers()
 
 	if(benchPhase == BenchPhase_CREATEFILES)
 	{
-		funcRWBlockSized = (ioDepth == 1) ?
-			&LocalWorker::rwBlockSized : &LocalWorker::aioBlockSized;
-
 		funcAioRwPrepper = (ioDepth == 1) ? NULL : &LocalWorker::aioWritePrepper;
 
 		if(rwMixReadPercent && funcAioRwPrepper)
@@ -1279,6 +1476,15 @@ void LocalWorker::initPhaseFunctionPointers()
 		if(integrityCheckEnabled)
 			funcPreWriteBlockModifier = &LocalWorker::preWriteIntegrityCheckFillBuf;
 		else
+		if(blockVariancePercent && !blockVarPoolVec.empty() )
+			funcPreWriteBlockModifier = &LocalWorker::noOpIntegrityCheck; // writes use pool bufs
+		else
+		if(blockVariancePercent && dedupeDataGen)
+			funcPreWriteBlockModifier = &LocalWorker::preWriteBufDedupeRefill;
+		else
+		if(blockVariancePercent && compressibleDataGen)
+			funcPreWriteBlockModifier = &LocalWorker::preWriteBufCompressibleRefill;
+		else
 		if(blockVariancePercent && areGPUsGiven)
 			funcPreWriteBlockModifier = &LocalWorker::preWriteBufRandRefillCuda;
 		else
@@ -1313,10 +1519,17 @@ void LocalWorker::initPhaseFunctionPointers()
             funcRWRateLimiter = &LocalWorker::preRWRateBalanceLimiterForWriters;
         }
         else
-        if(perThreadWriteRateLimitBps)
+        if( (perThreadWriteRateLimitBps || perThreadWriteRateLimitIOPS) && useSharedRateLimit)
+        { // host-wide rate limiter (initialized by WorkerManager)
+            funcRWRateLimiter = &LocalWorker::preRWSharedRateLimiter;
+            sharedRateLimiter = &workersSharedData->writeRateLimiter;
+        }
+        else
+        if(perThreadWriteRateLimitBps || perThreadWriteRateLimitIOPS)
         { // plain per-thread rate limiter
             funcRWRateLimiter = &LocalWorker::preRWRateLimiter;
-            rateLimiter.initStart(perThreadWriteRateLimitBps);
+            rateLimiter.initStart(perThreadWriteRateLimitBps, perThreadWriteRateLimitIOPS,
+                rateLimitRefillUSec, useRateLimitSpin);
         }
         else // no rate limit
             funcRWRateLimiter = &LocalWorker::noOpRateLimiter;
@@ -1325,9 +1538,6 @@ void LocalWorker::initPhaseFunctionPointers()
 	{
         // (note: this also applies to rwmixthreads readers in a write phase)
 
-		funcRWBlockSized = (ioDepth == 1) ?
-			&LocalWorker::rwBlockSized : &LocalWorker::aioBlockSized;
-
 		funcAioRwPrepper = (ioDepth == 1) ? NULL : &LocalWorker::aioReadPrepper;
 
 		funcPreWriteCudaMemcpy = &LocalWorker::noOpCudaMemcpy;
@@ -1352,10 +1562,17 @@ void LocalWorker::initPhaseFunctionPointers()
             funcRWRateLimiter = &LocalWorker::preRWRateBalanceLimiterForReaders;
         }
         else
-        if(perThreadReadRateLimitBps)
+        if( (perThreadReadRateLimitBps || perThreadReadRateLimitIOPS) && useSharedRateLimit)
+        { // host-wide rate limiter (initialized by WorkerManager)
+            funcRWRateLimiter = &LocalWorker::preRWSharedRateLimiter;
+            sharedRateLimiter = &workersSharedData->readRateLimiter;
+        }
+        else
+        if(perThreadReadRateLimitBps || perThreadReadRateLimitIOPS)
         { // plain per-thread rate limiter
             funcRWRateLimiter = &LocalWorker::preRWRateLimiter;
-            rateLimiter.initStart(perThreadReadRateLimitBps);
+            rateLimiter.initStart(perThreadReadRateLimitBps, perThreadReadRateLimitIOPS,
+                rateLimitRefillUSec, useRateLimitSpin);
         }
         else // no rate limit
             funcRWRateLimiter = &LocalWorker::noOpRateLimiter;
@@ -1363,6 +1580,31 @@ void LocalWorker::initPhaseFunctionPointers()
 
 	// independent of whether current phase is read or write...
 
+	/* open-loop schedule: paces each IO in file/bdev mode (via funcRWBlockSized) and each entry in
+		dir mode (via dirModeIterateFiles) */
+	const bool isOpenLoopPhase =
+		(globalBenchPhase == BenchPhase_CREATEFILES) || (globalBenchPhase == BenchPhase_READFILES) ||
+		( (benchPathType == BenchPathType_DIR) &&
+			( (globalBenchPhase == BenchPhase_STATFILES) ||
+				(globalBenchPhase == BenchPhase_DELETEFILES) ) );
+
+	openLoopScheduler.initStart(isOpenLoopPhase ? progArgs->getOpenLoopOpsPerSec() : 0,
+		progArgs->getOpenLoopDist() == ARG_OPENLOOPDIST_POISSON, workerRank);
+
+	// (note: sync selection checks the other function pointers, so this needs to come after them)
+	if(progArgs->getUseIOUring() )
+	{ // io_uring replaces sync and libaio block-sized read/write, independent of iodepth
+		funcRWBlockSized = &LocalWorker::uringBlockSized;
+		funcAioRwPrepper = NULL;
+
+#ifdef LIBURING_SUPPORT
+		iouringContext.useFixedFiles = false; // fds might have changed, so re-register for phase
+#endif // LIBURING_SUPPORT
+	}
+	else
+		funcRWBlockSized = (ioDepth == 1) ?
+			selectRWBlockSizedSync() : &LocalWorker::aioBlockSized;
+
 	if(useCuFileAPI)
 	{
 		funcCuFileHandleReg = (benchPathType == BenchPathType_DIR) ?
@@ -1419,6 +1661,102 @@ void LocalWorker::allocIOBuffer()
         "Number of buffers: " << ioBufVec.size() << std::endl);
 }
 
+/**
+ * Allocate and pre-generate the pool of random write blocks for block variance if selected by
+ * user. Contents are generated like in preWriteBufRandRefill(), so each pool block gets its own
+ * random part and its own constant fill value for the remainder.
+ *
+ * @throw WorkerException if allocation fails.
+ */
+void LocalWorker::allocBlockVarPool()
+{
+	const size_t blockSize = progArgs->getBlockSize();
+	const size_t poolSize = progArgs->getBlockVarPoolSize();
+
+	if(!poolSize || !blockSize || !progArgs->getBlockVariancePercent() ||
+		!progArgs->getRunCreateFilesPhase() )
+		return; // nothing to do here
+
+	const uint64_t varFillLen = (blockSize * progArgs->getBlockVariancePercent() ) / 100;
+	const size_t constFillRemainderLen = blockSize - varFillLen;
+
+	std::unique_ptr<RandAlgoInterface> randAlgo =
+		RandAlgoSelectorTk::stringToAlgo(progArgs->getBlockVarianceAlgo() );
+	std::unique_ptr<CompressibleDataGen> dataGen; // only set for user-defined compression ratio
+
+	if(progArgs->getCompressRatio() )
+		dataGen = std::make_unique<CompressibleDataGen>(*randAlgo, progArgs->getCompressRatio() );
+
+	for(size_t i=0; i < poolSize; i++)
+	{
+		char* poolBuf;
+
+		// alloc buffer appropriately aligned for O_DIRECT
+		int allocAlignedRes = posix_memalign( (void**)&poolBuf, sysconf(_SC_PAGESIZE), blockSize);
+
+		if(allocAlignedRes)
+			throw WorkerException("Aligned memory allocation for block variance pool failed. "
+				"Buffer size: " + std::to_string(blockSize) + "; "
+				"Number of buffers: " + std::to_string(poolSize) + "; "
+				"SysErr: " + strerror(allocAlignedRes) ); // yes, not errno here
+
+		blockVarPoolVec.push_back(poolBuf);
+
+		if(dataGen)
+		{ // (note: compress ratio requires 100% block variance, so no const fill remainder)
+			dataGen->fillBuf(poolBuf, blockSize);
+			continue;
+		}
+
+		randAlgo->fillBuf(poolBuf, varFillLen);
+
+		if(constFillRemainderLen)
+			bufFill(&poolBuf[varFillLen], randAlgo->next(), constFillRemainderLen);
+	}
+
+	blockVarPoolSlotRoundVec.assign(std::max(progArgs->getIODepth(), (size_t)1), 0);
+
+    LOGGER(Log_DEBUG, "Allocated block variance pool. "
+        "Rank: " << workerRank << "; "
+        "Number of buffers: " << blockVarPoolVec.size() << std::endl);
+}
+
+/**
+ * Get the index of the next block variance pool buffer for a write of the given IO slot.
+ *
+ * Each IO slot owns the pool buffers slotIdx, slotIdx+numSlots, slotIdx+2*numSlots, ... and
+ * rotates through them, so a buffer is never handed out while it belongs to a pending IO of
+ * another slot, even though async completions come back out of order and slots get reused in any
+ * order. This requires a pool that is not smaller than numSlots (i.e. iodepth), so that each slot
+ * owns at least one buffer.
+ *
+ * Before a buffer gets returned, a new random value is placed in each BLOCKVARPOOL_STAMP_INTERVAL
+ * of the random part of the buffer to keep writes non-dedupable at typical dedupe granularity.
+ *
+ * @slotIdx index of the IO slot for the write (e.g. iocbVec index); 0 for sync IO.
+ * @numSlots number of IO slots, i.e. max iodepth for async IO; 1 for sync IO.
+ * @return index in blockVarPoolVec.
+ */
+size_t LocalWorker::getNextBlockVarPoolIdx(size_t slotIdx, size_t numSlots)
+{
+	size_t& slotRound = blockVarPoolSlotRoundVec[slotIdx];
+	const size_t poolIdx = slotIdx + (slotRound * numSlots);
+	const uint64_t varFillLen =
+		(progArgs->getBlockSize() * progArgs->getBlockVariancePercent() ) / 100;
+	char* poolBuf = blockVarPoolVec[poolIdx];
+
+	for(uint64_t stampOffset = 0; (stampOffset + sizeof(uint64_t) ) <= varFillLen;
+		stampOffset += BLOCKVARPOOL_STAMP_INTERVAL)
+	{
+		const uint64_t stampVal = randBlockVarAlgo->next();
+		memcpy(&poolBuf[stampOffset], &stampVal, sizeof(stampVal) );
+	}
+
+	slotRound = ( (poolIdx + numSlots) < blockVarPoolVec.size() ) ? (slotRound + 1) : 0;
+
+	return poolIdx;
+}
+
 /**
  * Allocate GPU I/O buffer and fill with random data.
  *
@@ -1592,6 +1930,20 @@ void LocalWorker::prepareCustomTreePathStores()
 		customTreeFiles.randomShuffle();
 }
 
+/**
+ * Prepare the ops of the replay phase for this worker.
+ */
+void LocalWorker::prepareReplayOps()
+{
+	if(!progArgs->getRunReplayPhase() )
+		return; // nothing to do here
+
+	const size_t numDataSetThreads = progArgs->getNumDataSetThreads();
+
+	progArgs->getReplayOps().getWorkerSublist(workerRank % numDataSetThreads, numDataSetThreads,
+		replayOps);
+}
+
 /**
  * Release all allocated objects, handles etc.
  *
@@ -1609,6 +1961,7 @@ void LocalWorker::cleanup()
 	uninitHDFS();
 	uninitS3Client();
     uninitLibAio();
+    uninitIOUring();
 
 	// reset custom tree mode path store
 	customTreeFiles.clear();
@@ -1666,6 +2019,9 @@ void LocalWorker::cleanup()
 	for(char* ioBuf : ioBufVec)
 		SAFE_FREE(ioBuf);
 
+	for(char* poolBuf : blockVarPoolVec)
+		SAFE_FREE(poolBuf);
+
 	uninitThreadMmapVec();
 	uninitThreadCuFileHandleDataVec();
 	uninitThreadFDVec();
@@ -1697,8 +2053,18 @@ void LocalWorker::cleanupAfterPhaseDone()
  * If this->fileHandles contains multiple FDs then they will be treated as described in
  * calcFileIdxAndOffsetStriped().
  *
+ * This gets instantiated for each combination of the template args, so that the compiler can drop
+ * everything that is not needed for the current phase from the per-block loop. The matching
+ * instance gets selected once per phase by selectRWBlockSizedSync().
+ *
+ * @IS_WRITE_PHASE true if this worker is in a write phase (benchPhase, not the global phase).
+ * @USE_RWMIX true to send rwMixReadPercent of the blocks in a write phase as reads.
+ * @USE_FLOCK true if file range locks are requested.
+ * @USE_HOOKS false if all pre/post IO function pointers are no-ops and plain pread/pwrite wrappers
+ * 		are used and open-loop is disabled, so that these get skipped resp. called directly.
  * @return similar to pread/pwrite.
  */
+template<bool IS_WRITE_PHASE, bool USE_RWMIX, bool USE_FLOCK, bool USE_HOOKS>
 int64_t LocalWorker::rwBlockSized()
 {
 	const BenchPhase globalBenchPhase = workersSharedData->currentBenchPhase;
@@ -1706,6 +2072,12 @@ int64_t LocalWorker::rwBlockSized()
     const uint64_t fileSize = progArgs->getFileSize();
     const bool isSingleFile = (fileHandles.fdVecPtr->size() == 1);
     const unsigned short fileLockType = progArgs->getFLockType();
+    const bool isRWMixThreadsRead = (benchPhase != globalBenchPhase); // read in a write phase
+    char* const ioBuf = ioBufVec[0];
+    char* const gpuIOBuf = gpuIOBufVec[0];
+    const bool useBlockVarPool = IS_WRITE_PHASE && !blockVarPoolVec.empty();
+    const bool useOpenLoopIOs = USE_HOOKS && openLoopScheduler.isEnabled() &&
+        (progArgs->getBenchPathType() != BenchPathType_DIR); // (dir mode paces entries instead)
 
 	while(rwOffsetGen->getNumBytesLeftToSubmit() )
 	{
@@ -1713,50 +2085,68 @@ int64_t LocalWorker::rwBlockSized()
         const size_t currentBlockSize = rwOffsetGen->getNextBlockSizeToSubmit();
         uint64_t currentOffset;
         size_t fileHandleIdx;
-        bool isRWMixRead = false;
+        bool isRead;
+        bool isRWMixRead;
         ssize_t rwRes;
+        std::chrono::steady_clock::time_point intendedStartT; // for open-loop
 
         calcFileIdxAndOffsetStriped(rwOffsetGenNext, fileSize, isSingleFile,
             fileHandleIdx, currentOffset);
 
-		((*this).*funcRWRateLimiter)(currentBlockSize, isInterruptionRequested);
-
-		std::chrono::steady_clock::time_point ioStartT = std::chrono::steady_clock::now();
+        if(!IS_WRITE_PHASE)
+        { // this is a read, but could be a rwmix read thread
+            isRead = true;
+            isRWMixRead = isRWMixThreadsRead;
+        }
+        else
+        if(USE_RWMIX)
+        { // this is a write or rwmixpct read
+            isRead = ( ( (workerRank + numIOPSSubmitted) % 100) < rwMixReadPercent);
+            isRWMixRead = isRead;
+        }
+        else
+        { // this is a plain write
+            isRead = false;
+            isRWMixRead = false;
+        }
 
-		((*this).*funcPreWriteBlockModifier)(ioBufVec[0], gpuIOBufVec[0], currentBlockSize,
-		    currentOffset);
-		((*this).*funcPreWriteCudaMemcpy)(ioBufVec[0], gpuIOBufVec[0], currentBlockSize);
+        if(USE_HOOKS)
+            ((*this).*funcRWRateLimiter)(currentBlockSize, isInterruptionRequested);
 
-		if(benchPhase == BenchPhase_READFILES)
-		{ // this is a read, but could be a rwmix read thread
-			isRWMixRead = (benchPhase != globalBenchPhase);
+        if(useOpenLoopIOs)
+        {
+            intendedStartT = openLoopScheduler.waitAndPopNextIntendedT(
+                isInterruptionRequested, openLoopStats);
+            checkInterruptionRequest();
+        }
 
-            FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx], fileLockType,
-                currentOffset, currentBlockSize, false /*isWrite*/, false /*isUnlock*/, NULL);
+		std::chrono::steady_clock::time_point ioStartT = std::chrono::steady_clock::now();
 
-			rwRes = ((*this).*funcPositionalRead)(
-				fileHandleIdx, ioBufVec[0], currentBlockSize, currentOffset);
+		if(USE_HOOKS)
+		{
+			((*this).*funcPreWriteBlockModifier)(ioBuf, gpuIOBuf, currentBlockSize,
+				currentOffset);
+			((*this).*funcPreWriteCudaMemcpy)(ioBuf, gpuIOBuf, currentBlockSize);
 		}
-		else // this is a write or rwmixpct read
-		if(rwMixReadPercent &&
-			( ( (workerRank + numIOPSSubmitted) % 100) < rwMixReadPercent) )
-		{ // this is a rwmix read
-			isRWMixRead = true;
 
-            FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx], fileLockType,
-                currentOffset, currentBlockSize, false /*isWrite*/, false /*isUnlock*/, NULL);
+		// writes with block variance pool use pre-generated bufs instead of ioBuf
+		char* const rwBuf = (useBlockVarPool && !isRead) ?
+			blockVarPoolVec[getNextBlockVarPoolIdx(0, 1)] : ioBuf;
 
-            rwRes = ((*this).*funcPositionalRead)(
-				fileHandleIdx, ioBufVec[0], currentBlockSize, currentOffset);
-		}
-		else
-		{ // this is a plain write
+		if(USE_FLOCK)
             FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx], fileLockType,
-                currentOffset, currentBlockSize, true /*isWrite*/, false /*isUnlock*/, NULL);
+                currentOffset, currentBlockSize, !isRead /*isWrite*/, false /*isUnlock*/, NULL);
 
-			rwRes = ((*this).*funcPositionalWrite)(
-				fileHandleIdx, ioBufVec[0], currentBlockSize, currentOffset);
-		}
+		if(isRead)
+			rwRes = USE_HOOKS ?
+				((*this).*funcPositionalRead)(fileHandleIdx, rwBuf, currentBlockSize,
+					currentOffset) :
+				preadWrapper(fileHandleIdx, rwBuf, currentBlockSize, currentOffset);
+		else
+			rwRes = USE_HOOKS ?
+				((*this).*funcPositionalWrite)(fileHandleIdx, rwBuf, currentBlockSize,
+					currentOffset) :
+				pwriteWrapper(fileHandleIdx, rwBuf, currentBlockSize, currentOffset);
 
 		IF_UNLIKELY(rwRes <= 0)
 		{ // unexpected result
@@ -1769,41 +2159,60 @@ int64_t LocalWorker::rwBlockSized()
 
 			fileHandles.errorFDVecIdx = fileHandleIdx;
 
-	        FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx], fileLockType,
-	            currentOffset, currentBlockSize, true /*ignored*/, true /*isUnlock*/, NULL);
+			if(USE_FLOCK)
+				FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx],
+					fileLockType, currentOffset, currentBlockSize, true /*ignored*/,
+					true /*isUnlock*/, NULL);
 
 	        return (rwRes < 0) ?
 				rwRes :
 				(rwOffsetGen->getNumBytesTotal() - rwOffsetGen->getNumBytesLeftToSubmit() );
 		}
 
-        FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx], fileLockType,
-            currentOffset, currentBlockSize, true /*ignored*/, true /*isUnlock*/, NULL);
+		if(USE_FLOCK)
+            FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandleIdx], fileLockType,
+                currentOffset, currentBlockSize, true /*ignored*/, true /*isUnlock*/, NULL);
 
-		((*this).*funcPostReadCudaMemcpy)(ioBufVec[0], gpuIOBufVec[0], currentBlockSize);
-		((*this).*funcPostReadBlockChecker)(ioBufVec[0], gpuIOBufVec[0], currentBlockSize,
-		    currentOffset);
+		if(USE_HOOKS)
+		{
+			((*this).*funcPostReadCudaMemcpy)(ioBuf, gpuIOBuf, currentBlockSize);
+			((*this).*funcPostReadBlockChecker)(ioBuf, gpuIOBuf, currentBlockSize,
+				currentOffset);
+		}
 
 		// calc io operation latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
 		// iops lat & num done
 		if(isRWMixRead)
 		{ // inc special rwmix read stats
-			iopsLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+			iopsLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 			atomicLiveOpsReadMix.numBytesDone += rwRes;
 			atomicLiveOpsReadMix.numIOPSDone++;
 		}
 		else
 		{
-			iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+			iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
 			atomicLiveOps.numBytesDone += rwRes;
 			atomicLiveOps.numIOPSDone++;
 		}
 
+		IF_UNLIKELY(isFileLatFirstBytePending)
+			addFileLatFirstByte(ioEndT);
+
+		// open-loop response time includes the delay of the op behind its intended issue time
+		if(useOpenLoopIOs)
+			iopsRespLatHisto.addLatency(std::chrono::duration_cast<std::chrono::nanoseconds>
+				(ioEndT - intendedStartT).count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp(isRead ? "read" : "write",
+				getSlowOpsIOPath( (*fileHandles.fdVecPtr)[fileHandleIdx] ), currentOffset, rwRes,
+				ioStartT, ioElapsedNanoSec.count() );
+
 		numIOPSSubmitted++;
 		rwOffsetGen->addBytesSubmitted(rwRes);
 
@@ -1813,11 +2222,71 @@ int64_t LocalWorker::rwBlockSized()
 	return rwOffsetGen->getNumBytesTotal();
 }
 
+/**
+ * Select the rwBlockSized() template instance that matches the current phase config. Must be
+ * called after all other phase function pointers have been set, because it checks whether they
+ * are no-ops.
+ */
+RW_BLOCKSIZED LocalWorker::selectRWBlockSizedSync()
+{
+	// [IS_WRITE_PHASE][USE_RWMIX][USE_FLOCK][USE_HOOKS]
+	static const RW_BLOCKSIZED rwBlockSizedFuncs[2][2][2][2] =
+	{
+		{ // read phase (USE_RWMIX is irrelevant here)
+			{
+				{ &LocalWorker::rwBlockSized<false, false, false, false>,
+					&LocalWorker::rwBlockSized<false, false, false, true> },
+				{ &LocalWorker::rwBlockSized<false, false, true, false>,
+					&LocalWorker::rwBlockSized<false, false, true, true> },
+			},
+			{
+				{ &LocalWorker::rwBlockSized<false, false, false, false>,
+					&LocalWorker::rwBlockSized<false, false, false, true> },
+				{ &LocalWorker::rwBlockSized<false, false, true, false>,
+					&LocalWorker::rwBlockSized<false, false, true, true> },
+			},
+		},
+		{ // write phase
+			{
+				{ &LocalWorker::rwBlockSized<true, false, false, false>,
+					&LocalWorker::rwBlockSized<true, false, false, true> },
+				{ &LocalWorker::rwBlockSized<true, false, true, false>,
+					&LocalWorker::rwBlockSized<true, false, true, true> },
+			},
+			{
+				{ &LocalWorker::rwBlockSized<true, true, false, false>,
+					&LocalWorker::rwBlockSized<true, true, false, true> },
+				{ &LocalWorker::rwBlockSized<true, true, true, false>,
+					&LocalWorker::rwBlockSized<true, true, true, true> },
+			},
+		},
+	};
+
+	const bool isWritePhase = (benchPhase != BenchPhase_READFILES);
+	const bool useRWMix = (progArgs->getRWMixReadPercent() != 0);
+	const bool useFLock = (progArgs->getFLockType() != ARG_FLOCK_NONE);
+	const bool useHooks =
+		(funcRWRateLimiter != &LocalWorker::noOpRateLimiter) ||
+		(funcPreWriteBlockModifier != &LocalWorker::noOpIntegrityCheck) ||
+		(funcPostReadBlockChecker != &LocalWorker::noOpIntegrityCheck) ||
+		(funcPreWriteCudaMemcpy != &LocalWorker::noOpCudaMemcpy) ||
+		(funcPostReadCudaMemcpy != &LocalWorker::noOpCudaMemcpy) ||
+		(funcPositionalRead != &LocalWorker::preadWrapper) ||
+		(funcPositionalWrite != &LocalWorker::pwriteWrapper) ||
+		openLoopScheduler.isEnabled();
+
+	return rwBlockSizedFuncs[isWritePhase][useRWMix][useFLock][useHooks];
+}
+
 /**
  * Loop around libaio read/write to use user-defined block size instead of full file size in one
  * call.
  * Reads/writes the pre-allocated ioBuf. Uses iodepth from progArgs.
  *
+ * Submissions and completions are batched: All free iocbs get prepared and then submitted with a
+ * single io_submit() call, and io_getevents() reaps up to iodepth completions at once. The minimum
+ * number of completions to wait for before resubmitting is defined by progArgs->getIOBatchMin().
+ *
  * If this->fileHandles contains multiple FDs then they will be treated as a striped single range,
  * so sequential IOs would be done round-robin. Thus, this is not suitable if serial processing
  * of files is needed.
@@ -1836,83 +2305,150 @@ int64_t LocalWorker::aioBlockSized()
 
 	const BenchPhase globalBenchPhase = workersSharedData->currentBenchPhase;
 	const size_t maxIODepth = progArgs->getIODepth();
+	const size_t minBatch = progArgs->getIOBatchMin();
 	const size_t fileHandlesVecSize = fileHandles.fdVecPtr->size();
     const uint64_t fileSize = progArgs->getFileSize();
     const bool isSingleFile = (fileHandlesVecSize == 1);
     const unsigned short fileLockType = progArgs->getFLockType();
+    const unsigned rwMixReadPercent = progArgs->getRWMixReadPercent();
+    const bool useBlockVarPool =
+        (benchPhase == BenchPhase_CREATEFILES) && !blockVarPoolVec.empty();
+    const bool useOpenLoopIOs = openLoopScheduler.isEnabled() &&
+        (progArgs->getBenchPathType() != BenchPathType_DIR); // (dir mode paces entries instead)
 
 	size_t numPending = 0; // num requests submitted and pending for completion
 	size_t numBytesDone = 0; // after successfully completed requests
 
-	struct io_event ioEvents[AIO_MAX_EVENTS];
+	struct io_event* ioEvents = libaioContext.ioEventVec.data();
 	struct timespec ioTimeout;
 
-	// P H A S E 1: initial seed of io submissions up to full ioDepth
+	// all iocbs are free at this point (slot stack in reverse order, so that slot 0 is used first)
+	libaioContext.freeSlotVec.clear();
+	for(size_t ioVecIdx = maxIODepth; ioVecIdx > 0; ioVecIdx--)
+		libaioContext.freeSlotVec.push_back(ioVecIdx - 1);
 
-	while(rwOffsetGen->getNumBytesLeftToSubmit() && (numPending < maxIODepth) )
+	for( ; ; )
 	{
-		const uint64_t rwOffsetGenNext = rwOffsetGen->getNextOffset();
-        const size_t blockSize = rwOffsetGen->getNextBlockSizeToSubmit();
-		const size_t ioVecIdx = numPending; // iocbVec index
+		// P H A S E 1: prepare all free iocbs if any blocks left to submit
 
-		uint64_t currentOffset;
-        size_t fileHandlesIdx;
+		size_t numPrepped = 0;
 
-        calcFileIdxAndOffsetStriped(rwOffsetGenNext, fileSize, isSingleFile,
-            fileHandlesIdx, currentOffset);
+		const size_t numSlotsToPrep = getNumPacedAsyncIOs(libaioContext.freeSlotVec.size(),
+			numPending, useOpenLoopIOs);
 
-        const int fd = (*fileHandles.fdVecPtr)[fileHandlesIdx];
+		const size_t numBatchBlocks = rwOffsetGen->getNextBatch(offsetBatchVec.data(),
+			blockSizeBatchVec.data(), numSlotsToPrep);
 
-		libaioContext.iocbPointerVec[ioVecIdx] = &libaioContext.iocbVec[ioVecIdx];
+		for(size_t batchIdx = 0; batchIdx < numBatchBlocks; batchIdx++)
+		{
+			const uint64_t rwOffsetGenNext = offsetBatchVec[batchIdx];
+			const size_t blockSize = blockSizeBatchVec[batchIdx];
+			const size_t ioVecIdx = libaioContext.freeSlotVec.back(); // iocbVec index
 
-        ((*this).*funcAioRwPrepper)(&libaioContext.iocbVec[ioVecIdx], fd, ioBufVec[ioVecIdx],
-            blockSize, currentOffset);
-        libaioContext.iocbVec[ioVecIdx].data = (void*)ioVecIdx; /* the vec index of this request;
-            ioctl.data is caller's private data returned after io_getevents as ioEvents[].data */
+			uint64_t currentOffset;
+			size_t fileHandlesIdx;
 
-        libaioContext.ioStartTimeVec[ioVecIdx] = std::chrono::steady_clock::now();
+			calcFileIdxAndOffsetStriped(rwOffsetGenNext, fileSize, isSingleFile,
+				fileHandlesIdx, currentOffset);
 
-        bool hadToWait = ((*this).*funcRWRateLimiter)(blockSize, isInterruptionRequested);
-        IF_UNLIKELY(hadToWait) // invalidate start time of all pending due to rate limiter wait
-            for(std::chrono::steady_clock::time_point& startT : libaioContext.ioStartTimeVec)
-                startT = std::chrono::steady_clock::time_point::min();
+			const int fd = (*fileHandles.fdVecPtr)[fileHandlesIdx];
 
-        ((*this).*funcPreWriteBlockModifier)(ioBufVec[ioVecIdx], gpuIOBufVec[ioVecIdx], blockSize,
-            currentOffset);
-        ((*this).*funcPreWriteCudaMemcpy)(ioBufVec[ioVecIdx], gpuIOBufVec[ioVecIdx], blockSize);
+			// writes with block variance pool use pre-generated bufs instead of ioBufVec
+			// note: same rwmix logic as in aioRWMixPrepper (numIOPSSubmitted is inc'ed below)
+			char* ioBuf = ioBufVec[ioVecIdx];
+			if(useBlockVarPool && ( ( (workerRank + numIOPSSubmitted) % 100) >= rwMixReadPercent) )
+				ioBuf = blockVarPoolVec[getNextBlockVarPoolIdx(ioVecIdx, maxIODepth)];
 
-        FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandlesIdx], fileLockType,
-            currentOffset, blockSize, libaioContext.iocbVec[ioVecIdx].aio_lio_opcode==IO_CMD_PWRITE,
-            false /*isUnlock*/, NULL);
+			((*this).*funcAioRwPrepper)(&libaioContext.iocbVec[ioVecIdx], fd, ioBuf,
+				blockSize, currentOffset);
+			libaioContext.iocbVec[ioVecIdx].data = (void*)ioVecIdx; /* the vec index of this request;
+				ioctl.data is caller's private data returned after io_getevents as ioEvents[].data */
 
-        int submitRes = io_submit(libaioContext.ioContext, 1,
-            &libaioContext.iocbPointerVec[ioVecIdx] );
-        IF_UNLIKELY(submitRes != 1)
-        {
-            FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandlesIdx], fileLockType,
-                currentOffset, blockSize, true /*ignored*/, true /*isUnlock*/, NULL);
+			bool hadToWait = ((*this).*funcRWRateLimiter)(blockSize, isInterruptionRequested);
+			IF_UNLIKELY(hadToWait) // invalidate start time of all pending due to rate limiter wait
+				for(std::chrono::steady_clock::time_point& startT : libaioContext.ioStartTimeVec)
+					startT = std::chrono::steady_clock::time_point::min();
 
-            throw WorkerException(std::string("Async IO submission (io_submit) failed. ") +
-                "NumRequests: " + std::to_string(numPending) + "; "
-                "ReturnCode: " + std::to_string(submitRes) + "; "
-                "SysErr: " + strerror(-submitRes) ); // (io_submit returns negative errno)
-        }
+			((*this).*funcPreWriteBlockModifier)(ioBufVec[ioVecIdx], gpuIOBufVec[ioVecIdx],
+				blockSize, currentOffset);
+			((*this).*funcPreWriteCudaMemcpy)(ioBufVec[ioVecIdx], gpuIOBufVec[ioVecIdx], blockSize);
 
-		numPending++;
-		numIOPSSubmitted++;
-		rwOffsetGen->addBytesSubmitted(blockSize);
-	}
+			FileTk::flock<WorkerException>(fd, fileLockType, currentOffset, blockSize,
+				libaioContext.iocbVec[ioVecIdx].aio_lio_opcode==IO_CMD_PWRITE,
+				false /*isUnlock*/, NULL);
 
+			libaioContext.freeSlotVec.pop_back();
+			libaioContext.iocbPointerVec[numPrepped] = &libaioContext.iocbVec[ioVecIdx];
 
-	// P H A S E 2: wait for submissions to complete and submit new requests if bytes left
+			numPrepped++;
+			numIOPSSubmitted++;
+		}
 
-	while(numPending)
-	{
-		ioTimeout.tv_sec = AIO_MAX_WAIT_SEC;
-		ioTimeout.tv_nsec = 0;
+		/* all iocbs of the batch start at submission, so that the latency of an IO doesn't include
+			the prep time of the iocbs after it in the batch */
+
+		const std::chrono::steady_clock::time_point submitT = std::chrono::steady_clock::now();
 
-        int eventsRes = io_getevents(libaioContext.ioContext, 1, AIO_MAX_EVENTS, ioEvents,
-            &ioTimeout);
+		for(size_t i = 0; i < numPrepped; i++)
+		{
+			const size_t ioVecIdx = (size_t)libaioContext.iocbPointerVec[i]->data;
+
+			libaioContext.ioStartTimeVec[ioVecIdx] = submitT;
+
+			if(useOpenLoopIOs)
+				libaioContext.intendedStartTimeVec[ioVecIdx] = openLoopScheduler.popNextIntendedT(
+					submitT, openLoopStats);
+		}
+
+		// submit all prepared iocbs (io_submit might accept only a part of them per call)
+
+		size_t numSubmitted = 0;
+
+		while(numSubmitted < numPrepped)
+		{
+			int submitRes = io_submit(libaioContext.ioContext, numPrepped - numSubmitted,
+				&libaioContext.iocbPointerVec[numSubmitted] );
+			IF_UNLIKELY(submitRes <= 0)
+			{
+				// release locks of all iocbs that did not get submitted
+				for(size_t i = numSubmitted; i < numPrepped; i++)
+					FileTk::flock<WorkerException>(libaioContext.iocbPointerVec[i]->aio_fildes,
+						fileLockType, libaioContext.iocbPointerVec[i]->u.c.offset,
+						libaioContext.iocbPointerVec[i]->u.c.nbytes, true /*ignored*/,
+						true /*isUnlock*/, NULL);
+
+				throw WorkerException(std::string("Async IO submission (io_submit) failed. ") +
+					"NumPending: " + std::to_string(numPending) + "; "
+					"NumRequests: " + std::to_string(numPrepped - numSubmitted) + "; "
+					"ReturnCode: " + std::to_string(submitRes) + "; "
+					"SysErr: " + strerror(-submitRes) ); // (io_submit returns negative errno)
+			}
+
+			numSubmitted += submitRes;
+			numPending += submitRes;
+
+			ioBatchStats.numSubmitCalls++;
+			ioBatchStats.numSubmittedIOs += submitRes;
+		}
+
+		if(!numPending)
+			break; // all done
+
+
+		// P H A S E 2: wait for completions and reap as many as available
+
+		// (wake up in time to submit the next paced IO if it is due before any completions)
+		const uint64_t waitNanoSec = getPacedAsyncCompletionWaitNanoSec(
+			libaioContext.freeSlotVec.size(), useOpenLoopIOs);
+
+		ioTimeout.tv_sec = waitNanoSec / 1000000000;
+		ioTimeout.tv_nsec = waitNanoSec % 1000000000;
+
+		// (don't wait for more than pending, e.g. when last blocks of the file are in flight)
+		const long minEvents = useOpenLoopIOs ? 1 : std::min(minBatch, numPending);
+
+		int eventsRes = io_getevents(libaioContext.ioContext, minEvents, maxIODepth, ioEvents,
+			&ioTimeout);
 		IF_UNLIKELY(!eventsRes)
 		{ // timeout expired; that's ok, as we set a short timeout to check interruptions
 			checkInterruptionRequest();
@@ -1929,7 +2465,10 @@ int64_t LocalWorker::aioBlockSized()
 				"SysErr: " + strerror(-eventsRes) ); // (io_getevents returns negative errno)
 		}
 
-		// check result of completed iocbs and reuse them if any blocks left to submit
+		ioBatchStats.numReapCalls++;
+		ioBatchStats.numReapedIOs += eventsRes;
+
+		// check result of completed iocbs and mark them free for reuse
 
 		for(int eventIdx = 0; eventIdx < eventsRes; eventIdx++)
 		{
@@ -1949,9 +2488,9 @@ int64_t LocalWorker::aioBlockSized()
 						"IO size: " + std::to_string(ioEvents[eventIdx].obj->u.c.nbytes) + "; "
 						"SysErr: " + strerror(-(int)ioEvents[eventIdx].res2) );
 
-	            FileTk::flock<WorkerException>(ioEvents[eventIdx].obj->aio_fildes, fileLockType,
-	                ioEvents[eventIdx].obj->u.c.offset, ioEvents[eventIdx].obj->u.c.nbytes,
-	                true /*ignored*/, true /*isUnlock*/, NULL);
+				FileTk::flock<WorkerException>(ioEvents[eventIdx].obj->aio_fildes, fileLockType,
+					ioEvents[eventIdx].obj->u.c.offset, ioEvents[eventIdx].obj->u.c.nbytes,
+					true /*ignored*/, true /*isUnlock*/, NULL);
 
 				if( (int)ioEvents[eventIdx].res < 0)
 				{
@@ -1963,9 +2502,9 @@ int64_t LocalWorker::aioBlockSized()
 				return (numBytesDone + ioEvents[eventIdx].res);
 			}
 
-            FileTk::flock<WorkerException>(ioEvents[eventIdx].obj->aio_fildes, fileLockType,
-                ioEvents[eventIdx].obj->u.c.offset, ioEvents[eventIdx].obj->u.c.nbytes,
-                true /*ignored*/, true /*isUnlock*/, NULL);
+			FileTk::flock<WorkerException>(ioEvents[eventIdx].obj->aio_fildes, fileLockType,
+				ioEvents[eventIdx].obj->u.c.offset, ioEvents[eventIdx].obj->u.c.nbytes,
+				true /*ignored*/, true /*isUnlock*/, NULL);
 
 			const size_t ioVecIdx = (size_t)ioEvents[eventIdx].data; // caller priv data is vec idx
 
@@ -1977,8 +2516,8 @@ int64_t LocalWorker::aioBlockSized()
 
 			// calc io operation latency
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - libaioContext.ioStartTimeVec[ioVecIdx] );
 
 			numBytesDone += ioEvents[eventIdx].res;
@@ -1987,86 +2526,542 @@ int64_t LocalWorker::aioBlockSized()
 			if(	(ioEvents[eventIdx].obj->aio_lio_opcode == IO_CMD_PREAD) &&
 				(globalBenchPhase == BenchPhase_CREATEFILES) )
 			{ // this is a read in a write phase => inc rwmix read stats
-                // don't count latency if this I/O had to wait for rate limiter
-                IF_LIKELY(libaioContext.ioStartTimeVec[ioVecIdx] !=
-                    std::chrono::steady_clock::time_point::min() )
-                    iopsLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+				// don't count latency if this I/O had to wait for rate limiter
+				IF_LIKELY(libaioContext.ioStartTimeVec[ioVecIdx] !=
+					std::chrono::steady_clock::time_point::min() )
+					iopsLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 
 				atomicLiveOpsReadMix.numBytesDone += ioEvents[eventIdx].res;
 				atomicLiveOpsReadMix.numIOPSDone++;
 			}
 			else
 			{
-                // don't count latency if this I/O had to wait for rate limiter
-                IF_LIKELY(libaioContext.ioStartTimeVec[ioVecIdx] !=
-                    std::chrono::steady_clock::time_point::min() )
-                    iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+				// don't count latency if this I/O had to wait for rate limiter
+				IF_LIKELY(libaioContext.ioStartTimeVec[ioVecIdx] !=
+					std::chrono::steady_clock::time_point::min() )
+					iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
 
 				atomicLiveOps.numBytesDone += ioEvents[eventIdx].res;
 				atomicLiveOps.numIOPSDone++;
 			}
 
-			checkInterruptionRequest();
+			IF_UNLIKELY(isFileLatFirstBytePending)
+				addFileLatFirstByte(ioEndT);
 
-			if(!rwOffsetGen->getNumBytesLeftToSubmit() )
-			{
-				numPending--;
-				continue;
-			}
+			// open-loop response time includes the delay of the op behind its intended issue time
+			if(useOpenLoopIOs)
+				iopsRespLatHisto.addLatency(std::chrono::duration_cast<std::chrono::nanoseconds>
+					(ioEndT - libaioContext.intendedStartTimeVec[ioVecIdx] ).count() );
+
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) &&
+				(libaioContext.ioStartTimeVec[ioVecIdx] !=
+					std::chrono::steady_clock::time_point::min() ) )
+				addSlowOp(
+					(ioEvents[eventIdx].obj->aio_lio_opcode == IO_CMD_PREAD) ? "read" : "write",
+					getSlowOpsIOPath(ioEvents[eventIdx].obj->aio_fildes),
+					ioEvents[eventIdx].obj->u.c.offset, ioEvents[eventIdx].res,
+					libaioContext.ioStartTimeVec[ioVecIdx], ioElapsedNanoSec.count() );
+
+			numPending--;
+			libaioContext.freeSlotVec.push_back(ioVecIdx);
+
+		} // end of for loop to check completed iocbs
+
+		checkInterruptionRequest();
+
+	} // end of loop until all blocks completed
+
+	return rwOffsetGen->getNumBytesTotal();
+
+#endif // LIBAIO_SUPPORT
+}
+
+/**
+ * Async read/write of blocks via io_uring up to the given iodepth. Similar to aioBlockSized, all
+ * free slots get prepared first and then submitted together with a single io_uring_submit() call,
+ * and all available completions get reaped before the next submission round. Buffers are
+ * registered with the ring in initIOUring(); files are registered in file/bdev mode, where fds
+ * stay open for the whole phase.
+ *
+ * @return similar to pread/pwrite.
+ * @throw WorkerException on io_uring framework errors.
+ */
+int64_t LocalWorker::uringBlockSized()
+{
+#ifndef LIBURING_SUPPORT
+
+	throw WorkerException("Async IO via io_uring requested, but this executable was built without "
+		"liburing support.");
+
+#else // LIBURING_SUPPORT
+
+	const BenchPhase globalBenchPhase = workersSharedData->currentBenchPhase;
+	const size_t fileHandlesVecSize = fileHandles.fdVecPtr->size();
+    const uint64_t fileSize = progArgs->getFileSize();
+    const bool isSingleFile = (fileHandlesVecSize == 1);
+    const unsigned short fileLockType = progArgs->getFLockType();
+    const bool isWritePhase = (benchPhase == BenchPhase_CREATEFILES);
+    const unsigned rwMixReadPercent = progArgs->getRWMixReadPercent();
+    const bool useIOPoll = progArgs->getUseIOUringIOPoll();
+    const bool useBlockVarPool = isWritePhase && !blockVarPoolVec.empty();
+    const size_t maxIODepth = progArgs->getIODepth();
+    const size_t minBatch = progArgs->getIOBatchMin();
+    const bool useOpenLoopIOs = openLoopScheduler.isEnabled() &&
+        (progArgs->getBenchPathType() != BenchPathType_DIR); // (dir mode paces entries instead)
+    struct io_uring* ring = &iouringContext.ring;
+
+	size_t numBytesDone = 0; // after successfully completed requests
+	bool ioErrorOccurred = false;
+	int64_t ioErrorRetVal = 0; // return value in case of error or partial read/write
+
+	uringDrainPending(); // in case a previous call got interrupted by an exception
+	uringUpdateRegisteredFiles();
+
+	for( ; ; )
+	{
+		// prepare new requests for all free slots if any blocks left to submit
+
+		size_t numPrepped = 0;
 
-			// request complete, so reuse iocb for the next request...
+		iouringContext.preppedSlotVec.clear();
 
-			const size_t blockSize = rwOffsetGen->getNextBlockSizeToSubmit();
-			const uint64_t rwOffsetGenNext = rwOffsetGen->getNextOffset();
+		const size_t numSlotsToPrep = getNumPacedAsyncIOs(iouringContext.freeSlotVec.size(),
+			iouringContext.numPending, useOpenLoopIOs);
+
+		const size_t numBatchBlocks = rwOffsetGen->getNextBatch(offsetBatchVec.data(),
+			blockSizeBatchVec.data(), numSlotsToPrep);
+
+		for(size_t batchIdx = 0; batchIdx < numBatchBlocks; batchIdx++)
+		{
+			const uint64_t rwOffsetGenNext = offsetBatchVec[batchIdx];
+			const size_t blockSize = blockSizeBatchVec[batchIdx];
+			const size_t slotIdx = iouringContext.freeSlotVec.back();
 
 			uint64_t currentOffset;
-            size_t fileHandlesIdx;
+			size_t fileHandlesIdx;
 
-            calcFileIdxAndOffsetStriped(rwOffsetGenNext, fileSize, isSingleFile,
-                fileHandlesIdx, currentOffset);
+			calcFileIdxAndOffsetStriped(rwOffsetGenNext, fileSize, isSingleFile,
+				fileHandlesIdx, currentOffset);
 
 			const int fd = (*fileHandles.fdVecPtr)[fileHandlesIdx];
 
-			((*this).*funcAioRwPrepper)(ioEvents[eventIdx].obj, fd, ioBufVec[ioVecIdx], blockSize,
-				currentOffset);
-			ioEvents[eventIdx].obj->data = (void*)ioVecIdx; // caller's private data
+			// note: same rwmix logic as in aioRWMixPrepper (numIOPSSubmitted is inc'ed below)
+			const bool isRead = !isWritePhase ||
+				( ( (workerRank + numIOPSSubmitted) % 100) < rwMixReadPercent);
+
+			bool hadToWait = ((*this).*funcRWRateLimiter)(blockSize, isInterruptionRequested);
+			IF_UNLIKELY(hadToWait) // invalidate start time of all pending due to rate limiter wait
+				for(std::chrono::steady_clock::time_point& startT : iouringContext.ioStartTimeVec)
+					startT = std::chrono::steady_clock::time_point::min();
+
+			((*this).*funcPreWriteBlockModifier)(ioBufVec[slotIdx], gpuIOBufVec[slotIdx],
+				blockSize, currentOffset);
+			((*this).*funcPreWriteCudaMemcpy)(ioBufVec[slotIdx], gpuIOBufVec[slotIdx], blockSize);
+
+			/* writes with block variance pool use pre-generated bufs instead of ioBufVec. (pool bufs
+				are registered behind ioBufVec, see initIOUring() ) */
+			char* ioBuf = ioBufVec[slotIdx];
+			size_t fixedBufIdx = slotIdx;
+
+			if(useBlockVarPool && !isRead)
+			{
+				const size_t poolIdx = getNextBlockVarPoolIdx(slotIdx, maxIODepth);
+
+				ioBuf = blockVarPoolVec[poolIdx];
+				fixedBufIdx = ioBufVec.size() + poolIdx;
+			}
+
+			FileTk::flock<WorkerException>(fd, fileLockType, currentOffset, blockSize, !isRead,
+				false /*isUnlock*/, NULL);
+
+			OPLOG_PRE_OP(isRead ? "uringread" : "uringwrite", std::to_string(fd), currentOffset,
+				blockSize);
+
+			/* note: nothing that can throw below this point until the sqe is prepared, because an
+				unprepared sqe would get submitted with the next io_uring_submit() */
+
+			struct io_uring_sqe* sqe = io_uring_get_sqe(ring);
+			IF_UNLIKELY(!sqe)
+			{ // can't happen, as ring size is larger than iodepth
+				FileTk::flock<WorkerException>(fd, fileLockType, currentOffset, blockSize,
+					true /*ignored*/, true /*isUnlock*/, NULL);
+
+				throw WorkerException("io_uring submission queue unexpectedly full. "
+					"NumPending: " + std::to_string(iouringContext.numPending) + "; "
+					"NumPrepared: " + std::to_string(numPrepped) );
+			}
+
+			const int sqeFD = iouringContext.useFixedFiles ? (int)fileHandlesIdx : fd;
+
+			if(isRead && iouringContext.useFixedBufs)
+				io_uring_prep_read_fixed(sqe, sqeFD, ioBuf, blockSize, currentOffset,
+					fixedBufIdx);
+			else
+			if(isRead)
+				io_uring_prep_read(sqe, sqeFD, ioBuf, blockSize, currentOffset);
+			else
+			if(iouringContext.useFixedBufs)
+				io_uring_prep_write_fixed(sqe, sqeFD, ioBuf, blockSize, currentOffset,
+					fixedBufIdx);
+			else
+				io_uring_prep_write(sqe, sqeFD, ioBuf, blockSize, currentOffset);
+
+			if(iouringContext.useFixedFiles)
+				io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+
+			io_uring_sqe_set_data(sqe, (void*)slotIdx); // returned in cqe to find request info
 
-            libaioContext.ioStartTimeVec[ioVecIdx] = std::chrono::steady_clock::now();
+			IOUringRequest& request = iouringContext.requestVec[slotIdx];
+			request.fd = fd;
+			request.offset = currentOffset;
+			request.len = blockSize;
+			request.isRead = isRead;
 
-            bool hadToWait = ((*this).*funcRWRateLimiter)(blockSize, isInterruptionRequested);
-            IF_UNLIKELY(hadToWait) // invalidate start time of all pending due to rate limiter wait
-                for(std::chrono::steady_clock::time_point& startT : libaioContext.ioStartTimeVec)
-                    startT = std::chrono::steady_clock::time_point::min();
+			iouringContext.freeSlotVec.pop_back();
+			iouringContext.preppedSlotVec.push_back(slotIdx);
+			iouringContext.numPending++;
+			numPrepped++;
+			numIOPSSubmitted++;
+		}
+
+		IF_LIKELY(numPrepped)
+		{
+			/* all requests of the batch start at submission, so that the latency of an IO doesn't
+				include the prep time of the requests after it in the batch */
 
-            ((*this).*funcPreWriteBlockModifier)(ioBufVec[ioVecIdx], gpuIOBufVec[ioVecIdx],
-                blockSize, currentOffset);
-            ((*this).*funcPreWriteCudaMemcpy)(ioBufVec[ioVecIdx], gpuIOBufVec[ioVecIdx], blockSize);
+			const std::chrono::steady_clock::time_point submitT = std::chrono::steady_clock::now();
 
-            FileTk::flock<WorkerException>( (*fileHandles.fdVecPtr)[fileHandlesIdx], fileLockType,
-                currentOffset, blockSize,
-                libaioContext.iocbVec[ioVecIdx].aio_lio_opcode==IO_CMD_PWRITE,
-                false /*isUnlock*/, NULL);
+			for(size_t slotIdx : iouringContext.preppedSlotVec)
+			{
+				iouringContext.ioStartTimeVec[slotIdx] = submitT;
+
+				if(useOpenLoopIOs)
+					iouringContext.intendedStartTimeVec[slotIdx] =
+						openLoopScheduler.popNextIntendedT(submitT, openLoopStats);
+			}
 
-			int submitRes = io_submit(
-				libaioContext.ioContext, 1, &libaioContext.iocbPointerVec[ioVecIdx] );
-			IF_UNLIKELY(submitRes != 1)
+			int submitRes = io_uring_submit(ring);
+			IF_UNLIKELY(submitRes < 0)
 			{
-				throw WorkerException(std::string("Async IO resubmission (io_submit) failed. ") +
-					"NumRequests: " + std::to_string(numPending) + "; "
+				iouringContext.numPending -= numPrepped; // (kernel did not consume any of them)
+
+				throw WorkerException(std::string("io_uring submission (io_uring_submit) failed. ") +
+					"NumRequests: " + std::to_string(numPrepped) + "; "
 					"ReturnCode: " + std::to_string(submitRes) + "; "
-					"SysErr: " + strerror(-submitRes) ); // (io_submit returns negative errno)
+					"SysErr: " + strerror(-submitRes) ); // (liburing returns negative errno)
 			}
 
-			numIOPSSubmitted++;
-			rwOffsetGen->addBytesSubmitted(blockSize);
+			ioBatchStats.numSubmitCalls++;
+			ioBatchStats.numSubmittedIOs += numPrepped;
+		}
+
+		if(!iouringContext.numPending)
+			break; // all done
+
+		// wait for min batch of completions
+
+		// (wake up in time to submit the next paced IO if it is due before any completions)
+		const uint64_t waitNanoSec = getPacedAsyncCompletionWaitNanoSec(
+			iouringContext.freeSlotVec.size(), useOpenLoopIOs);
+
+		// (don't wait for more than pending, e.g. when last blocks of the file are in flight)
+		const unsigned minCompletions = useOpenLoopIOs ?
+			1 : std::min(minBatch, iouringContext.numPending);
+
+		struct io_uring_cqe* cqe;
+		int waitRes;
 
-		} // end of for loop to resubmit completed iocbs
+		/* note: no timeout support for iopoll rings, so paced submissions can get delayed until
+			the next completion in this case (which still counts in the open-loop response time) */
+		if(useIOPoll)
+			waitRes = io_uring_wait_cqe_nr(ring, &cqe, minCompletions);
+		else
+		{
+			struct __kernel_timespec ioTimeout;
+			ioTimeout.tv_sec = waitNanoSec / 1000000000;
+			ioTimeout.tv_nsec = waitNanoSec % 1000000000;
 
-	} // end of while loop until all blocks completed
+			waitRes = io_uring_wait_cqes(ring, &cqe, minCompletions, &ioTimeout, NULL);
+		}
+
+		IF_UNLIKELY( (waitRes == -ETIME) || (waitRes == -EINTR) )
+		{ // timeout expired; that's ok, as we set a short timeout to check interruptions
+			checkInterruptionRequest();
+			continue;
+		}
+		else
+		IF_UNLIKELY(waitRes < 0)
+			throw WorkerException(std::string("Waiting for io_uring completions failed. ") +
+				"NumPending: " + std::to_string(iouringContext.numPending) + "; "
+				"ReturnCode: " + std::to_string(waitRes) + "; "
+				"Wait time: " + std::to_string(AIO_MAX_WAIT_SEC) + "; "
+				"SysErr: " + strerror(-waitRes) ); // (liburing returns negative errno)
+
+		// reap all available completions
+
+		/* note: each cqe is marked as seen before anything that can throw, so that numPending
+			always matches the number of requests that the kernel still owns */
+
+		ioBatchStats.numReapCalls++;
+
+		while(!io_uring_peek_cqe(ring, &cqe) )
+		{
+			ioBatchStats.numReapedIOs++;
+
+			const size_t slotIdx = (size_t)io_uring_cqe_get_data(cqe);
+			const int ioRes = cqe->res; // num bytes read/written or negative errno
+
+			io_uring_cqe_seen(ring, cqe);
+
+			iouringContext.numPending--;
+			iouringContext.freeSlotVec.push_back(slotIdx);
+
+			const IOUringRequest& request = iouringContext.requestVec[slotIdx];
+
+			FileTk::flock<WorkerException>(request.fd, fileLockType, request.offset, request.len,
+				true /*ignored*/, true /*isUnlock*/, NULL);
+
+			IF_UNLIKELY( (int64_t)ioRes != (int64_t)request.len)
+			{ // unexpected result => remember first error and let pending requests complete
+				if(!ioErrorOccurred)
+				{
+					ioErrorOccurred = true;
+
+					if(ioRes < 0)
+						ioErrorRetVal = ioRes; // negative errno
+					else // partial read/write, so return what we got so far
+						ioErrorRetVal = numBytesDone + ioRes;
+				}
+
+				continue;
+			}
+
+			((*this).*funcPostReadCudaMemcpy)(ioBufVec[slotIdx], gpuIOBufVec[slotIdx], ioRes);
+			((*this).*funcPostReadBlockChecker)(ioBufVec[slotIdx], gpuIOBufVec[slotIdx], ioRes,
+				request.offset);
+
+			// calc io operation latency
+			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
+				(ioEndT - iouringContext.ioStartTimeVec[slotIdx] );
+
+			numBytesDone += ioRes;
+
+			// inc special rwmix read stats
+			if(request.isRead && (globalBenchPhase == BenchPhase_CREATEFILES) )
+			{ // this is a read in a write phase => inc rwmix read stats
+				// don't count latency if this I/O had to wait for rate limiter
+				IF_LIKELY(iouringContext.ioStartTimeVec[slotIdx] !=
+					std::chrono::steady_clock::time_point::min() )
+					iopsLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
+
+				atomicLiveOpsReadMix.numBytesDone += ioRes;
+				atomicLiveOpsReadMix.numIOPSDone++;
+			}
+			else
+			{
+				// don't count latency if this I/O had to wait for rate limiter
+				IF_LIKELY(iouringContext.ioStartTimeVec[slotIdx] !=
+					std::chrono::steady_clock::time_point::min() )
+					iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+				atomicLiveOps.numBytesDone += ioRes;
+				atomicLiveOps.numIOPSDone++;
+			}
+
+			IF_UNLIKELY(isFileLatFirstBytePending)
+				addFileLatFirstByte(ioEndT);
+
+			// open-loop response time includes the delay of the op behind its intended issue time
+			if(useOpenLoopIOs)
+				iopsRespLatHisto.addLatency(std::chrono::duration_cast<std::chrono::nanoseconds>
+					(ioEndT - iouringContext.intendedStartTimeVec[slotIdx] ).count() );
+
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) &&
+				(iouringContext.ioStartTimeVec[slotIdx] !=
+					std::chrono::steady_clock::time_point::min() ) )
+				addSlowOp(request.isRead ? "read" : "write", getSlowOpsIOPath(request.fd),
+					request.offset, ioRes, iouringContext.ioStartTimeVec[slotIdx],
+					ioElapsedNanoSec.count() );
+		}
+
+		IF_UNLIKELY(ioErrorOccurred)
+		{
+			uringDrainPending();
+
+			if(ioErrorRetVal < 0)
+			{
+				errno = -ioErrorRetVal;
+				return -1;
+			}
+
+			return ioErrorRetVal;
+		}
+
+		checkInterruptionRequest();
+
+	} // end of loop until all blocks completed
 
 	return rwOffsetGen->getNumBytesTotal();
 
-#endif // LIBAIO_SUPPORT
+#endif // LIBURING_SUPPORT
+}
+
+/**
+ * Get the number of free async IO slots to fill if submissions are paced by the open-loop schedule
+ * or the per-thread rate limiter, i.e. the number of IOs that may be submitted now.
+ *
+ * In open-loop mode, this waits for the next op to become due if no IOs are pending, as there is
+ * no completion to wait for in the meantime. With the rate limiter, this only returns the IOs that
+ * the rate limiter lets through without waiting, so that pending IOs don't get dropped from the
+ * latency stats due to a rate limiter wait. (The rate limiter gets checked with the user-given
+ * block size, as the size of the next blocks is not known yet.)
+ *
+ * @useOpenLoopIOs true if IOs are paced by the open-loop schedule.
+ * @return number of free slots to fill; numFreeSlots if submissions are not paced.
+ * @throw WorkerException if interruption was requested while waiting.
+ */
+size_t LocalWorker::getNumPacedAsyncIOs(size_t numFreeSlots, size_t numPending,
+	bool useOpenLoopIOs)
+{
+	if(!numFreeSlots || !rwOffsetGen->getNumBytesLeftToSubmit() )
+		return numFreeSlots; // nothing to pace
+
+	if(useOpenLoopIOs)
+	{
+		if(!numPending)
+		{
+			openLoopScheduler.waitForNextIntendedT(isInterruptionRequested);
+			checkInterruptionRequest();
+		}
+
+		return openLoopScheduler.getNumDue(std::chrono::steady_clock::now(), numFreeSlots);
+	}
+
+	if(funcRWRateLimiter == &LocalWorker::preRWRateLimiter)
+	{ // (if nothing is pending, 1 IO can wait in the rate limiter without harm to latency stats)
+		const size_t numReady = rateLimiter.getNumReady(progArgs->getBlockSize(), numFreeSlots);
+
+		return (numReady || numPending) ? numReady : 1;
+	}
+
+	if(funcRWRateLimiter == &LocalWorker::preRWSharedRateLimiter)
+	{ // (same as above, but other threads might take the budget before us)
+		const size_t numReady = sharedRateLimiter->getNumReady(progArgs->getBlockSize(),
+			numFreeSlots);
+
+		return (numReady || numPending) ? numReady : 1;
+	}
+
+	return numFreeSlots;
+}
+
+/**
+ * Get the max time to wait for async IO completions, so that the next paced IO (see
+ * getNumPacedAsyncIOs() ) can be submitted in time if there is a free slot for it.
+ *
+ * @useOpenLoopIOs true if IOs are paced by the open-loop schedule.
+ */
+uint64_t LocalWorker::getPacedAsyncCompletionWaitNanoSec(size_t numFreeSlots,
+	bool useOpenLoopIOs)
+{
+	const uint64_t maxWaitNanoSec = AIO_MAX_WAIT_SEC * 1000000000ULL;
+
+	if(!numFreeSlots || !rwOffsetGen->getNumBytesLeftToSubmit() )
+		return maxWaitNanoSec; // next IO can't be submitted before a completion anyways
+
+	if(useOpenLoopIOs)
+		return std::min(maxWaitNanoSec,
+			openLoopScheduler.getNanoSecUntilNextIntendedT(std::chrono::steady_clock::now() ) );
+
+	if(funcRWRateLimiter == &LocalWorker::preRWRateLimiter)
+		return std::min(maxWaitNanoSec, rateLimiter.getNanoSecUntilReady() );
+
+	if(funcRWRateLimiter == &LocalWorker::preRWSharedRateLimiter)
+		return std::min(maxWaitNanoSec, sharedRateLimiter->getNanoSecUntilReady() );
+
+	return maxWaitNanoSec;
+}
+
+/**
+ * Register the current fileHandles fds with the ring, so that the kernel does not need to look up
+ * the file for each IO. This is only done once per phase in file/bdev mode; in dir mode, each file
+ * is only open for a short time, so the extra registration syscalls per file would eat up the
+ * savings.
+ *
+ * Registration failure is not fatal; we fall back to plain fds in that case.
+ */
+void LocalWorker::uringUpdateRegisteredFiles()
+{
+#ifdef LIBURING_SUPPORT
+
+	if(iouringContext.useFixedFiles || (progArgs->getBenchPathType() == BenchPathType_DIR) )
+		return; // already registered for this phase or not worth it
+
+	const IntVec& fdVec = *fileHandles.fdVecPtr;
+
+	if(iouringContext.isFileTableRegistered)
+	{ // table from previous phase might reference files that have been closed in the meantime
+		io_uring_unregister_files(&iouringContext.ring);
+		iouringContext.isFileTableRegistered = false;
+	}
+
+	int regRes = io_uring_register_files(&iouringContext.ring, fdVec.data(), fdVec.size() );
+	IF_UNLIKELY(regRes)
+	{
+		ERRLOGGER(Log_VERBOSE, "io_uring file registration failed. "
+			"Falling back to unregistered files. "
+			"Rank: " << workerRank << "; "
+			"Number of files: " << fdVec.size() << "; "
+			"SysErr: " << strerror(-regRes) << std::endl);
+		return;
+	}
+
+	iouringContext.isFileTableRegistered = true;
+	iouringContext.useFixedFiles = true;
+
+#endif // LIBURING_SUPPORT
+}
+
+/**
+ * Wait for completion of all pending io_uring requests and discard their results. Used after an
+ * IO error and before ring teardown, so that the kernel no longer accesses ioBufVec afterwards.
+ *
+ * Range locks of discarded requests are not released here; they go away with the file close.
+ *
+ * This does not throw, so that it can be used during cleanup.
+ */
+void LocalWorker::uringDrainPending()
+{
+#ifdef LIBURING_SUPPORT
+
+	while(iouringContext.numPending)
+	{
+		struct io_uring_cqe* cqe;
+
+		int waitRes = io_uring_wait_cqe(&iouringContext.ring, &cqe);
+
+		IF_UNLIKELY(waitRes == -EINTR)
+			continue;
+
+		IF_UNLIKELY(waitRes < 0)
+		{
+			ERRLOGGER(Log_NORMAL, "Waiting for pending io_uring completions failed. "
+				"Rank: " << workerRank << "; "
+				"NumPending: " << iouringContext.numPending << "; "
+				"SysErr: " << strerror(-waitRes) << std::endl);
+
+			break;
+		}
+
+		iouringContext.freeSlotVec.push_back( (size_t)io_uring_cqe_get_data(cqe) );
+		iouringContext.numPending--;
+
+		io_uring_cqe_seen(&iouringContext.ring, cqe);
+	}
+
+#endif // LIBURING_SUPPORT
 }
 
 /**
@@ -2118,6 +3113,9 @@ void LocalWorker::noOpIntegrityCheck(char* hostIOBuf, char* gpuIOBuf, size_t buf
 /**
  * Fill buf with unsigned 64bit values made of offset plus integrity check salt.
  *
+ * The 8 byte aligned part of the buffer is filled in chunks of INTEGRITYCHECK_NWAY values to
+ * enable compiler SIMD vectorization.
+ *
  * @bufLen buf len to fill with checksums
  * @fileOffset file offset for buf
  */
@@ -2127,42 +3125,56 @@ void LocalWorker::preWriteIntegrityCheckFillBuf(char* hostIOBuf, char* gpuIOBuf,
 	const size_t checkSumLen = sizeof(uint64_t);
 	const uint64_t checkSumSalt = progArgs->getIntegrityCheckSalt();
 
-	size_t numBytesDone = 0;
-	size_t numBytesLeft = bufLen;
-	off_t currentOffset = fileOffset;
-
 	/* note: fileOffset and bufLen are not guaranteed to be a multiple of uint64_t (e.g. if
 	   blocksize is 1 byte). We also want to support writes and verficiation reads to use different
-	   block size (bufLen). So we only copy the relevant part of the uint64_t to buf. */
+	   block size (bufLen). So we fill the unaligned head and tail byte-wise. Checksum value is
+	   always calculated aligned to 8 byte block size, even if we only copy a partial block. */
 
-	while(numBytesLeft)
-	{
-		/* checksum value is always calculated aligned to 8 byte block size, even if we only copy a
-		   partial block. */
+	const size_t headLen = std::min( (uint64_t)bufLen,
+		(uint64_t) ( (checkSumLen - (fileOffset % checkSumLen) ) % checkSumLen) );
 
-		// (note: after the 1st loop pass, the remaining offsets will be 8 byte aligned.)
+	for(size_t i=0; i < headLen; i++)
+		hostIOBuf[i] = getIntegrityCheckByte(fileOffset + i, checkSumSalt);
 
-		// 8 byte aligned offset as basis for checksum value calculation
-		off_t checkSumStartOffset = currentOffset - (currentOffset % checkSumLen);
+	// 8 byte aligned part (note: hostIOBuf itself is not necessarily 8 byte aligned here)
 
-		uint64_t checkSum = checkSumStartOffset + checkSumSalt;
+	const size_t numWords = (bufLen - headLen) / checkSumLen;
+	const size_t numNwayWords = numWords - (numWords % INTEGRITYCHECK_NWAY);
+	char* wordBuf = &hostIOBuf[headLen];
+	uint64_t checkSum = (fileOffset + headLen) + checkSumSalt;
 
-		char* checkSumArray = (char*)&checkSum; // byte-addressable array for checksum value
-		off_t checkSumArrayStartIdx = currentOffset - checkSumStartOffset;
-		size_t checkSumCopyLen = std::min(
-			(uint64_t)numBytesLeft, (uint64_t)checkSumLen - checkSumArrayStartIdx);
+	for(size_t wordIdx=0; wordIdx < numNwayWords; wordIdx += INTEGRITYCHECK_NWAY)
+	{
+		uint64_t checkSums[INTEGRITYCHECK_NWAY];
 
-		memcpy(&hostIOBuf[numBytesDone], &checkSumArray[checkSumArrayStartIdx], checkSumCopyLen);
+		for(unsigned i=0; i < INTEGRITYCHECK_NWAY; i++)
+			checkSums[i] = checkSum + (i * checkSumLen);
 
-		numBytesDone += checkSumCopyLen;
-		numBytesLeft -= checkSumCopyLen;
-		currentOffset += checkSumCopyLen;
+		memcpy(&wordBuf[wordIdx * checkSumLen], checkSums, sizeof(checkSums) );
+
+		checkSum += INTEGRITYCHECK_NWAY * checkSumLen;
+	}
+
+	for(size_t wordIdx=numNwayWords; wordIdx < numWords; wordIdx++)
+	{
+		memcpy(&wordBuf[wordIdx * checkSumLen], &checkSum, checkSumLen);
+
+		checkSum += checkSumLen;
 	}
+
+	// tail (partial last checksum)
+
+	for(size_t i=headLen + (numWords * checkSumLen); i < bufLen; i++)
+		hostIOBuf[i] = getIntegrityCheckByte(fileOffset + i, checkSumSalt);
 }
 
 /**
  * Verify buffer contents as counterpart to preWriteIntegrityCheckFillBuf.
  *
+ * The expected values are calculated on the fly and compared in chunks of INTEGRITYCHECK_NWAY
+ * values to enable compiler SIMD vectorization without a separate verification buffer. The exact
+ * mismatch offset only gets searched for if a chunk does not match.
+ *
  * @bufLen buf len to fill with checksums
  * @fileOffset file offset for buf
  * @throw WorkerException if verification fails.
@@ -2170,45 +3182,108 @@ void LocalWorker::preWriteIntegrityCheckFillBuf(char* hostIOBuf, char* gpuIOBuf,
 void LocalWorker::postReadIntegrityCheckVerifyBuf(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
 	off_t fileOffset)
 {
-	IF_UNLIKELY(!bufLen)
-		return;
+	const size_t checkSumLen = sizeof(uint64_t);
+	const uint64_t checkSumSalt = progArgs->getIntegrityCheckSalt();
 
-	char* verifyBuf = (char*)malloc(bufLen);
+	const size_t headLen = std::min( (uint64_t)bufLen,
+		(uint64_t) ( (checkSumLen - (fileOffset % checkSumLen) ) % checkSumLen) );
 
-	IF_UNLIKELY(!verifyBuf)
-		throw WorkerException("Buffer alloc for verification buffer failed. "
-			"Size: " + std::to_string(bufLen) );
+	for(size_t i=0; i < headLen; i++)
+		IF_UNLIKELY(hostIOBuf[i] != getIntegrityCheckByte(fileOffset + i, checkSumSalt) )
+			throwIntegrityCheckMismatch(hostIOBuf, bufLen, fileOffset, i);
 
-	// fill verifyBuf with the correct data
-	preWriteIntegrityCheckFillBuf(verifyBuf, gpuIOBuf, bufLen, fileOffset);
+	// 8 byte aligned part (note: hostIOBuf itself is not necessarily 8 byte aligned here)
 
-	// compare correct data to actual data
-	int compareRes = memcmp(hostIOBuf, verifyBuf, bufLen);
+	const size_t numWords = (bufLen - headLen) / checkSumLen;
+	const size_t numNwayWords = numWords - (numWords % INTEGRITYCHECK_NWAY);
+	const char* wordBuf = &hostIOBuf[headLen];
+	uint64_t checkSum = (fileOffset + headLen) + checkSumSalt;
 
-	if(!compareRes)
-	{ // buffers are equal, so all good
-		free(verifyBuf);
-		return;
+	for(size_t wordIdx=0; wordIdx < numNwayWords; wordIdx += INTEGRITYCHECK_NWAY)
+	{
+		uint64_t actualVals[INTEGRITYCHECK_NWAY];
+		uint64_t diff = 0;
+
+		memcpy(actualVals, &wordBuf[wordIdx * checkSumLen], sizeof(actualVals) );
+
+		for(unsigned i=0; i < INTEGRITYCHECK_NWAY; i++)
+			diff |= actualVals[i] ^ (checkSum + (i * checkSumLen) );
+
+		IF_UNLIKELY(diff)
+			throwIntegrityCheckMismatch(hostIOBuf, bufLen, fileOffset,
+				headLen + (wordIdx * checkSumLen) );
+
+		checkSum += INTEGRITYCHECK_NWAY * checkSumLen;
 	}
 
-	// verification failed, find exact mismatch offset
-	for(size_t i=0; i < bufLen; i++)
+	for(size_t wordIdx=numNwayWords; wordIdx < numWords; wordIdx++)
 	{
-		if(verifyBuf[i] == hostIOBuf[i])
+		uint64_t actualVal;
+
+		memcpy(&actualVal, &wordBuf[wordIdx * checkSumLen], checkSumLen);
+
+		IF_UNLIKELY(actualVal != checkSum)
+			throwIntegrityCheckMismatch(hostIOBuf, bufLen, fileOffset,
+				headLen + (wordIdx * checkSumLen) );
+
+		checkSum += checkSumLen;
+	}
+
+	// tail (partial last checksum)
+
+	for(size_t i=headLen + (numWords * checkSumLen); i < bufLen; i++)
+		IF_UNLIKELY(hostIOBuf[i] != getIntegrityCheckByte(fileOffset + i, checkSumSalt) )
+			throwIntegrityCheckMismatch(hostIOBuf, bufLen, fileOffset, i);
+}
+
+/**
+ * Get the expected byte at the given file offset for the integrity check pattern of
+ * preWriteIntegrityCheckFillBuf.
+ */
+char LocalWorker::getIntegrityCheckByte(off_t fileOffset, uint64_t checkSumSalt)
+{
+	const size_t checkSumLen = sizeof(uint64_t);
+
+	// 8 byte aligned offset as basis for checksum value calculation
+	const uint64_t checkSum = (fileOffset - (fileOffset % checkSumLen) ) + checkSumSalt;
+
+	return ( (const char*)&checkSum)[fileOffset % checkSumLen];
+}
+
+/**
+ * Find the exact mismatch offset after postReadIntegrityCheckVerifyBuf detected a mismatch and
+ * throw an exception with the details.
+ *
+ * @startIdx buf index from which to start searching, e.g. start of the mismatching chunk.
+ * @throw WorkerException always.
+ */
+void LocalWorker::throwIntegrityCheckMismatch(const char* hostIOBuf, size_t bufLen,
+	off_t fileOffset, size_t startIdx)
+{
+	const uint64_t checkSumSalt = progArgs->getIntegrityCheckSalt();
+
+	for(size_t i=startIdx; i < bufLen; i++)
+	{
+		const char expectedByte = getIntegrityCheckByte(fileOffset + i, checkSumSalt);
+
+		if(expectedByte == hostIOBuf[i])
 			continue;
 
 		// we found the exact offset for mismatch
 
-		unsigned expectedVal = (unsigned char)verifyBuf[i];
+		unsigned expectedVal = (unsigned char)expectedByte;
 		unsigned actualVal = (unsigned char)hostIOBuf[i];
 
-		free(verifyBuf);
-
 		throw WorkerException("Data verification failed. "
 			"Offset: " + std::to_string(fileOffset + i) + "; "
 			"Expected value: " + std::to_string(expectedVal) + "; "
 			"Actual value: " + std::to_string(actualVal) );
 	}
+
+	// can't happen, because caller found a mismatch
+	throw WorkerException("Data verification failed, but mismatch offset not found. "
+		"Offset: " + std::to_string(fileOffset) + "; "
+		"Length: " + std::to_string(bufLen) );
 }
 
 /**
@@ -2262,6 +3337,34 @@ void LocalWorker::preWriteBufRandRefill(char* hostIOBuf, char* gpuIOBuf, size_t
 	bufFill(&hostIOBuf[varFillLen], randBlockVarAlgo->next(), constFillRemainderLen);
 }
 
+/**
+ * Refill the buffer with data for the user-defined compression ratio. (Compression ratio requires
+ * 100% block variance, so this always refills the whole buffer.)
+ */
+void LocalWorker::preWriteBufCompressibleRefill(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
+	off_t fileOffset)
+{
+	// note: this same logic is used in aioRWMixPrepper/pwriteRWMixWrapper
+	if( ( (workerRank + numIOPSSubmitted) % 100) < progArgs->getRWMixReadPercent() )
+		return; // this is a read in rwmix mode, so no need for refill in this round
+
+	compressibleDataGen->fillBuf(hostIOBuf, bufLen);
+}
+
+/**
+ * Refill the buffer with data for the user-defined dedupe ratio. (Dedupe requires 100% block
+ * variance, so this always refills the whole buffer.)
+ */
+void LocalWorker::preWriteBufDedupeRefill(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
+	off_t fileOffset)
+{
+	// note: this same logic is used in aioRWMixPrepper/pwriteRWMixWrapper
+	if( ( (workerRank + numIOPSSubmitted) % 100) < progArgs->getRWMixReadPercent() )
+		return; // this is a read in rwmix mode, so no need for refill in this round
+
+	dedupeDataGen->fillBuf(hostIOBuf, bufLen);
+}
+
 /**
  * Refill some percentage of the GPU buffer with random data. The percentage to refill is defined
  * via progArgs::blockVariancePercent.
@@ -2406,7 +3509,18 @@ bool LocalWorker::noOpRateLimiter(size_t rwSize, std::atomic_bool& isInterruptio
  */
 bool LocalWorker::preRWRateLimiter(size_t rwSize, std::atomic_bool& isInterruptionRequested)
 {
-    return rateLimiter.wait(rwSize);
+    return rateLimiter.wait(rwSize, isInterruptionRequested);
+}
+
+/**
+ * Rate limiter before writes/reads in case rate limit with host or global scope was selected by
+ * user, so that the limit applies to all threads together.
+ *
+ * @return true if we had to wait, false if we are good to go immediately.
+ */
+bool LocalWorker::preRWSharedRateLimiter(size_t rwSize, std::atomic_bool& isInterruptionRequested)
+{
+    return sharedRateLimiter->wait(rwSize, isInterruptionRequested);
 }
 
 /**
@@ -2902,11 +4016,15 @@ void LocalWorker::dirModeIterateDirs()
 
 		// calc entry operations latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
-		entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+		entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("dir", pathVec[pathFDsIndex] + "/" + currentPath.data(), 0, 0, ioStartT,
+				ioElapsedNanoSec.count() );
 
 		atomicLiveOps.numEntriesDone++;
 	} // end of for loop
@@ -3021,11 +4139,15 @@ void LocalWorker::dirModeIterateCustomDirs()
 
 		// calc entry operations latency. (for create, this includes open/rw/close.)
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
-		entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+		entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("dir", benchPathStr + "/" + currentPathElem.path, 0, 0, ioStartT,
+				ioElapsedNanoSec.count() );
 
 		atomicLiveOps.numEntriesDone++;
 
@@ -3070,6 +4192,8 @@ void LocalWorker::dirModeIterateFiles()
 		(localWorkerRank < progArgs->getNumRWMixReadThreads() ) );
 	const bool useMmap = progArgs->getUseMmap();
 	const bool doStatInline = progArgs->getDoStatInline();
+	const bool useFileLat = progArgs->getShowFileLatBreakdown();
+	const bool useOpenLoopEntries = openLoopScheduler.isEnabled();
 
 	int& fd = fileHandles.fdVec[0];
 	CuFileHandleData& cuFileHandleData = fileHandles.cuFileHandleDataVec[0];
@@ -3107,14 +4231,28 @@ void LocalWorker::dirModeIterateFiles()
 					"dirIndex: " + std::to_string(dirIndex) + "; "
 					"fileIndex: " + std::to_string(fileIndex) );
 
-			unsigned pathFDsIndex = (workerRank + dirIndex) % pathFDs.size();
+			unsigned pathFDsIndex = (workerRank + dirIndex) % pathFDs.size();
+
+			rwOffsetGen->reset(); // reset for next file
+
+			IF_UNLIKELY(slowOps.isEnabled() )
+				slowOpsFilePath = pathVec[pathFDsIndex] + "/" + currentPath.data();
+
+			std::chrono::steady_clock::time_point intendedStartT; // for open-loop
 
-			rwOffsetGen->reset(); // reset for next file
+			if(useOpenLoopEntries)
+			{
+				intendedStartT = openLoopScheduler.waitAndPopNextIntendedT(
+					isInterruptionRequested, openLoopStats);
+				checkInterruptionRequest();
+			}
 
 			std::chrono::steady_clock::time_point ioStartT = std::chrono::steady_clock::now();
 
 			if( (benchPhase == BenchPhase_CREATEFILES) || (benchPhase == BenchPhase_READFILES) )
 			{
+				std::chrono::steady_clock::time_point fileLatStepT = ioStartT; // for "--filelat"
+
 				fd = dirModeOpenAndPrepFile(benchPhase, pathFDs, pathFDsIndex,
 					currentPath.data(), openFlags, fileSize);
 
@@ -3123,6 +4261,9 @@ void LocalWorker::dirModeIterateFiles()
 				{
 					((*this).*funcCuFileHandleReg)(fd, cuFileHandleData); // reg cuFile handle
 
+					IF_UNLIKELY(useFileLat)
+						addFileLat(FileLat_OPEN, fileLatStepT);
+
 					if(doStatInline)
 					{ // inline stat (i.e. stat immediately after file open)
 						struct stat statBuf;
@@ -3139,6 +4280,15 @@ void LocalWorker::dirModeIterateFiles()
 							throw WorkerException(std::string("Inline file stat failed. ") +
 								"Path: " + pathVec[pathFDsIndex] + "/" + currentPath.data() + "; "
 								"SysErr: " + strerror(errno) );
+
+						IF_UNLIKELY(useFileLat)
+							addFileLat(FileLat_STAT, fileLatStepT);
+					}
+
+					IF_UNLIKELY(useFileLat)
+					{ // first completed IO of funcRWBlockSized adds time to first byte
+						fileLatXferStartT = fileLatStepT;
+						isFileLatFirstBytePending = true;
 					}
 
 					if(benchPhase == BenchPhase_CREATEFILES)
@@ -3181,9 +4331,17 @@ void LocalWorker::dirModeIterateFiles()
                                 "Hint: Consider initial sequential write or adding "
                                     "\"--" ARG_TRUNCTOSIZE_LONG "\" to ensure full file size.");
 					}
+
+					IF_UNLIKELY(useFileLat)
+					{
+						isFileLatFirstBytePending = false; // (in case of no IO, e.g. empty file)
+						addFileLat(FileLat_XFER, fileLatStepT);
+					}
 				}
 				catch(...)
 				{
+					isFileLatFirstBytePending = false;
+
 					// release memory mapping
 					if(useMmap && (fileHandles.mmapVec[0] != MAP_FAILED) )
 					{
@@ -3228,6 +4386,9 @@ void LocalWorker::dirModeIterateFiles()
 						"Path: " + pathVec[pathFDsIndex] + "/" + currentPath.data() + "; "
 						"FD: " + std::to_string(fd) + "; "
 						"SysErr: " + strerror(errno) );
+
+				IF_UNLIKELY(useFileLat)
+					addFileLat(FileLat_CLOSE, fileLatStepT);
 			}
 
 			if(benchPhase == BenchPhase_STATFILES)
@@ -3259,22 +4420,33 @@ void LocalWorker::dirModeIterateFiles()
 
 			// calc entry operations latency. (for create, this includes open/rw/close.)
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
 			// inc special rwmix thread stats
 			if(isRWMixedReader)
 			{
-				entriesLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOpsReadMix.numEntriesDone++;
 			}
 			else
 			{
-				entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOps.numEntriesDone++;
 			}
 
+			// open-loop response time includes the delay of the op behind its intended issue time
+			if(useOpenLoopEntries)
+				entriesRespLatHisto.addLatency(std::chrono::duration_cast<std::chrono::nanoseconds>
+					(ioEndT - intendedStartT).count() );
+
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+				addSlowOp("file", pathVec[pathFDsIndex] + "/" + currentPath.data(), 0,
+					( (benchPhase == BenchPhase_CREATEFILES) ||
+						(benchPhase == BenchPhase_READFILES) ) ? fileSize : 0,
+					ioStartT, ioElapsedNanoSec.count() );
+
 		} // end of files for loop
 	} // end of dirs for loop
 
@@ -3306,6 +4478,7 @@ void LocalWorker::dirModeIterateCustomFiles()
 		(localWorkerRank < progArgs->getNumRWMixReadThreads() ) );
 	const bool useMmap = progArgs->getUseMmap();
 	const bool doStatInline = progArgs->getDoStatInline();
+	const bool useFileLat = progArgs->getShowFileLatBreakdown();
 
 	int& fd = fileHandles.fdVec[0];
 	CuFileHandleData& cuFileHandleData = fileHandles.cuFileHandleDataVec[0];
@@ -3341,6 +4514,11 @@ void LocalWorker::dirModeIterateCustomFiles()
 
 			rwOffsetGen->reset(rangeLen, fileOffset);
 
+			IF_UNLIKELY(slowOps.isEnabled() )
+				slowOpsFilePath = benchPathStr + "/" + currentPath;
+
+			std::chrono::steady_clock::time_point fileLatStepT = ioStartT; // for "--filelat"
+
 			fd = dirModeOpenAndPrepFile(benchPhase, benchPathFDs, benchPathFDIdx,
 				currentPathElem.path.c_str(), openFlags, currentPathElem.totalLen);
 
@@ -3349,6 +4527,9 @@ void LocalWorker::dirModeIterateCustomFiles()
 			{
 				((*this).*funcCuFileHandleReg)(fd, cuFileHandleData); // reg cuFile handle
 
+				IF_UNLIKELY(useFileLat)
+					addFileLat(FileLat_OPEN, fileLatStepT);
+
 				if(doStatInline)
 				{ // inline stat (i.e. stat immediately after file open)
 					struct stat statBuf;
@@ -3359,6 +4540,15 @@ void LocalWorker::dirModeIterateCustomFiles()
 						throw WorkerException(std::string("File stat failed. ") +
 							"Path: " + benchPathStr + "/" + currentPath + "; "
 							"SysErr: " + strerror(errno) );
+
+					IF_UNLIKELY(useFileLat)
+						addFileLat(FileLat_STAT, fileLatStepT);
+				}
+
+				IF_UNLIKELY(useFileLat)
+				{ // first completed IO of funcRWBlockSized adds time to first byte
+					fileLatXferStartT = fileLatStepT;
+					isFileLatFirstBytePending = true;
 				}
 
 				if(benchPhase == BenchPhase_CREATEFILES)
@@ -3400,9 +4590,17 @@ void LocalWorker::dirModeIterateCustomFiles()
                             "Hint: Consider initial sequential write or adding "
                                 "\"--" ARG_TRUNCTOSIZE_LONG "\" to ensure full file size.");
 				}
+
+				IF_UNLIKELY(useFileLat)
+				{
+					isFileLatFirstBytePending = false; // (in case of no IO, e.g. empty file)
+					addFileLat(FileLat_XFER, fileLatStepT);
+				}
 			}
 			catch(...)
 			{
+				isFileLatFirstBytePending = false;
+
 				// release memory mapping
 				if(useMmap && (fileHandles.mmapVec[0] != MAP_FAILED) )
 				{
@@ -3447,6 +4645,9 @@ void LocalWorker::dirModeIterateCustomFiles()
 					"Path: " + benchPathStr + "/" + currentPath + "; "
 					"FD: " + std::to_string(fd) + "; "
 					"SysErr: " + strerror(errno) );
+
+			IF_UNLIKELY(useFileLat)
+				addFileLat(FileLat_CLOSE, fileLatStepT);
 		}
 
 		if(benchPhase == BenchPhase_STATFILES)
@@ -3477,8 +4678,8 @@ void LocalWorker::dirModeIterateCustomFiles()
 
 		// calc entry operations latency. (for create, this includes open/rw/close.)
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
 		// inc entry lat & num done count
@@ -3486,16 +4687,22 @@ void LocalWorker::dirModeIterateCustomFiles()
 		{ // entry lat & done is only meaningful for fully processed entries
 			if(isRWMixedReader)
 			{
-				entriesLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOpsReadMix.numEntriesDone++;
 			}
 			else
 			{
-				entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOps.numEntriesDone++;
 			}
 		}
 
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("file", benchPathStr + "/" + currentPath, currentPathElem.rangeStart,
+				( (benchPhase == BenchPhase_CREATEFILES) || (benchPhase == BenchPhase_READFILES) ) ?
+					currentPathElem.rangeLen : 0,
+				ioStartT, ioElapsedNanoSec.count() );
+
 		numFilesDone++;
 
 	} // end of tree elements for-loop
@@ -3813,6 +5020,82 @@ std::string LocalWorker::fileModeLogPathFromFileHandlesErr()
 	return "Path: " + progArgs->getBenchPaths()[fileHandles.errorFDVecIdx] + "; ";
 }
 
+/**
+ * Add op to the slowest ops of this worker. Callers check slowOps.isSlowOp() before, so that the
+ * path only needs to be generated for actual slow ops.
+ *
+ * @opName e.g. "read", "write" or the entry type of the phase.
+ * @path file, dir or "bucket/object".
+ * @startT start time of the op.
+ */
+void LocalWorker::addSlowOp(const char* opName, const std::string& path, uint64_t offset,
+	uint64_t length, std::chrono::steady_clock::time_point startT, uint64_t latencyNS)
+{
+	SlowOp op;
+
+	op.latencyNS = latencyNS;
+	op.startUSec = (startT > workersSharedData->phaseStartT) ?
+		std::chrono::duration_cast<std::chrono::microseconds>(
+			startT - workersSharedData->phaseStartT).count() : 0;
+	op.offset = offset;
+	op.length = length;
+	op.workerRank = workerRank;
+	op.opName = opName;
+	op.path = path;
+
+	slowOps.addOp(op);
+}
+
+/**
+ * Get the path of a block-sized IO for slow ops. In file/bdev mode, the path is found based on the
+ * fd. In dir mode, the fd belongs to the current file, of which the path is in slowOpsFilePath.
+ */
+std::string LocalWorker::getSlowOpsIOPath(int fd)
+{
+	if(progArgs->getBenchPathType() != BenchPathType_DIR)
+	{
+		const IntVec& pathFDs = progArgs->getBenchPathFDs();
+		const IntVec& threadFDVec = fileHandles.threadFDVec;
+
+		for(size_t i=0; i < pathFDs.size(); i++)
+			if( (pathFDs[i] == fd) || ( (i < threadFDVec.size() ) && (threadFDVec[i] == fd) ) )
+				return progArgs->getBenchPaths()[i];
+	}
+
+	return slowOpsFilePath;
+}
+
+/**
+ * Add the latency of a step of a file-level operation for "--filelat".
+ *
+ * @inOutStepStartT start time of the step; will be set to the current time as start of the next
+ * 	step.
+ */
+void LocalWorker::addFileLat(FileLatType type,
+	std::chrono::steady_clock::time_point& inOutStepStartT)
+{
+	std::chrono::steady_clock::time_point nowT = std::chrono::steady_clock::now();
+
+	fileLatStats.addLatency(type,
+		std::chrono::duration_cast<std::chrono::nanoseconds>(nowT - inOutStepStartT).count() );
+
+	inOutStepStartT = nowT;
+}
+
+/**
+ * Add the time to first byte of the current file for "--filelat". Called by the block-sized IO
+ * functions for the first completed IO after isFileLatFirstBytePending was set.
+ *
+ * @ioEndT completion time of the IO.
+ */
+void LocalWorker::addFileLatFirstByte(std::chrono::steady_clock::time_point ioEndT)
+{
+	isFileLatFirstBytePending = false;
+
+	fileLatStats.addLatency(FileLat_FIRSTBYTE,
+		std::chrono::duration_cast<std::chrono::nanoseconds>(ioEndT - fileLatXferStartT).count() );
+}
+
 /**
  * Iterate over all buckets to create or remove them. Each worker processes its own subset of
  * buckets.
@@ -3897,11 +5180,14 @@ void LocalWorker::s3ModeIterateBuckets()
 
 		// calc entry operations latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
-		entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+		entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("bucket", bucketName, 0, 0, ioStartT, ioElapsedNanoSec.count() );
 
 		atomicLiveOps.numEntriesDone++;
 	}
@@ -4036,22 +5322,28 @@ void LocalWorker::s3ModeIterateObjects()
 
 			// calc entry operations latency. (for create, this includes open/rw/close.)
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
 			// entry lat & num done count
 			if(isRWMixedReader)
 			{
-				entriesLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOpsReadMix.numEntriesDone++;
 			}
 			else
 			{
-				entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOps.numEntriesDone++;
 			}
 
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+				addSlowOp("object", bucketVec[bucketIndex] + "/" + currentObjectPath, 0,
+					( (benchPhase == BenchPhase_CREATEFILES) ||
+						(benchPhase == BenchPhase_READFILES) ) ? fileSize : 0,
+					ioStartT, ioElapsedNanoSec.count() );
+
 		} // end of files for loop
 	} // end of dirs for loop
 
@@ -4252,8 +5544,8 @@ void LocalWorker::s3ModeIterateCustomObjects()
 
 		// calc entry operations latency. (for create, this includes open/rw/close.)
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
 		// entry lat & num done count
@@ -4261,16 +5553,23 @@ void LocalWorker::s3ModeIterateCustomObjects()
 		{ // entry lat & done is only meaningful for fully processed entries
 			if(isRWMixedReader)
 			{
-				entriesLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOpsReadMix.numEntriesDone++;
 			}
 			else
 			{
-				entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOps.numEntriesDone++;
 			}
 		}
 
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("object", bucketName + "/" + objectPrefix + currentPathElem.path,
+				currentPathElem.rangeStart,
+				( (benchPhase == BenchPhase_CREATEFILES) || (benchPhase == BenchPhase_READFILES) ) ?
+					currentPathElem.rangeLen : 0,
+				ioStartT, ioElapsedNanoSec.count() );
+
 		numFilesDone++;
 
 	} // end of tree elements for-loop
@@ -4332,11 +5631,15 @@ void LocalWorker::s3ModeIterateCustomObjects()
 
         // calc entry operations latency
         std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-        std::chrono::microseconds ioElapsedMicroSec =
-            std::chrono::duration_cast<std::chrono::microseconds>
+        std::chrono::nanoseconds ioElapsedNanoSec =
+            std::chrono::duration_cast<std::chrono::nanoseconds>
             (ioEndT - ioStartT);
 
-        entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+        entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+        IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+            addSlowOp("object", bucketName + "/" + objectName, 0, 0, ioStartT,
+                ioElapsedNanoSec.count() );
 
         atomicLiveOps.numEntriesDone++;
     }
@@ -4882,11 +6185,15 @@ void LocalWorker::s3ModeUploadObjectSinglePart(std::string bucketName, std::stri
 
 	// calc io operation latency
 	std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-	std::chrono::microseconds ioElapsedMicroSec =
-		std::chrono::duration_cast<std::chrono::microseconds>
+	std::chrono::nanoseconds ioElapsedNanoSec =
+		std::chrono::duration_cast<std::chrono::nanoseconds>
 		(ioEndT - ioStartT);
 
-	iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+	iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+	IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+		addSlowOp("write", bucketName + "/" + objectName, currentOffset, blockSize, ioStartT,
+			ioElapsedNanoSec.count() );
 
 	numIOPSSubmitted++;
 	rwOffsetGen->addBytesSubmitted(blockSize);
@@ -5070,11 +6377,15 @@ void LocalWorker::s3ModeUploadObjectMultiPart(std::string bucketName, std::strin
 
 		// calc io operation latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
-		iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+		iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("write", bucketName + "/" + objectName, currentOffset, blockSize, ioStartT,
+				ioElapsedNanoSec.count() );
 
 		numIOPSSubmitted++;
 		rwOffsetGen->addBytesSubmitted(blockSize);
@@ -5346,11 +6657,16 @@ void LocalWorker::s3ModeUploadObjectMultiPartAsync(std::string bucketName, std::
 
                 // calc io operation latency
                 std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-                std::chrono::microseconds ioElapsedMicroSec =
-                    std::chrono::duration_cast<std::chrono::microseconds>
+                std::chrono::nanoseconds ioElapsedNanoSec =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>
                     (ioEndT - asyncPartContext.ioStartT);
 
-                iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+                iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+                IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+                    addSlowOp("write", bucketName + "/" + objectName,
+                        asyncPartContext.currentOffset, asyncPartContext.blockSize,
+                        asyncPartContext.ioStartT, ioElapsedNanoSec.count() );
 
                 atomicLiveOps.numIOPSDone++;
             } // end of step 2.2: wait for part batch completion for-loop
@@ -5572,11 +6888,15 @@ void LocalWorker::s3ModeUploadObjectMultiPartShared(std::string bucketName, std:
 
 		// calc io operation latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
-		iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+		iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("write", bucketName + "/" + objectName, currentOffset, blockSize, ioStartT,
+				ioElapsedNanoSec.count() );
 
 		numIOPSSubmitted++;
 		rwOffsetGen->addBytesSubmitted(blockSize);
@@ -5824,11 +7144,16 @@ void LocalWorker::s3ModeUploadObjectMultiPartSharedAsync(std::string bucketName,
 
                 // calc io operation latency
                 std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-                std::chrono::microseconds ioElapsedMicroSec =
-                    std::chrono::duration_cast<std::chrono::microseconds>
+                std::chrono::nanoseconds ioElapsedNanoSec =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>
                     (ioEndT - asyncPartContext.ioStartT);
 
-                iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+                iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+                IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+                    addSlowOp("write", bucketName + "/" + objectName,
+                        asyncPartContext.currentOffset, asyncPartContext.blockSize,
+                        asyncPartContext.ioStartT, ioElapsedNanoSec.count() );
 
                 atomicLiveOps.numIOPSDone++;
 
@@ -6247,21 +7572,25 @@ void LocalWorker::s3ModeDownloadObject(std::string bucketName, std::string objec
 
 		// calc io operation latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
 		if(isRWMixedReader)
 		{
-			iopsLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+			iopsLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 			atomicLiveOpsReadMix.numIOPSDone++;
 		}
 		else
 		{
-			iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+			iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
 			atomicLiveOps.numIOPSDone++;
 		}
 
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("read", bucketName + "/" + objectName, currentOffset, blockSize, ioStartT,
+				ioElapsedNanoSec.count() );
+
 		numIOPSSubmitted++;
 		rwOffsetGen->addBytesSubmitted(blockSize);
 	}
@@ -6441,21 +7770,26 @@ void LocalWorker::s3ModeDownloadObjectAsync(std::string bucketName, std::string
 
                 // calc io operation latency
                 std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-                std::chrono::microseconds ioElapsedMicroSec =
-                    std::chrono::duration_cast<std::chrono::microseconds>
+                std::chrono::nanoseconds ioElapsedNanoSec =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>
                     (ioEndT - asyncPartContext.ioStartT);
 
                 if(isRWMixedReader)
                 {
-                    iopsLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+                    iopsLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
                     atomicLiveOpsReadMix.numIOPSDone++;
                 }
                 else
                 {
-                    iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+                    iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
                     atomicLiveOps.numIOPSDone++;
                 }
 
+                IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+                    addSlowOp("read", bucketName + "/" + objectName,
+                        asyncPartContext.currentOffset, asyncPartContext.blockSize,
+                        asyncPartContext.ioStartT, ioElapsedNanoSec.count() );
+
             } // end of step 2: for-loop: async completion
 
             checkInterruptionRequest();
@@ -6611,11 +7945,15 @@ void LocalWorker::s3ModeListObjects()
 
 			// calc entry operations latency
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
-			entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+			entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+				addSlowOp("list", bucketVec[bucketIndex] + "/" + objectPrefix, 0, 0, ioStartT,
+					ioElapsedNanoSec.count() );
 
 			unsigned keyCount = outcome.GetResult().GetKeyCount();
 
@@ -6756,11 +8094,15 @@ void LocalWorker::s3ModeListObjParallel()
 
 			// calc entry operations latency
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
-			entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+			entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+				addSlowOp("list", bucketVec[bucketIndex] + "/" + currentListPrefix, 0, 0, ioStartT,
+					ioElapsedNanoSec.count() );
 
 			unsigned keyCount = outcome.GetResult().GetKeyCount();
 
@@ -6958,11 +8300,15 @@ void LocalWorker::s3ModeListAndMultiDeleteObjects()
 
 			// calc entry operations latency
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
-			entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+			entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+				addSlowOp("delete", bucketVec[bucketIndex] + "/" + objectPrefix, 0, 0, ioStartT,
+					ioElapsedNanoSec.count() );
 
 			unsigned keyCount = delOutcome.GetResult().GetDeleted().size();
 
@@ -7568,11 +8914,14 @@ void LocalWorker::hdfsDirModeIterateDirs()
 
 		// calc entry operations latency
 		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-		std::chrono::microseconds ioElapsedMicroSec =
-			std::chrono::duration_cast<std::chrono::microseconds>
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
 			(ioEndT - ioStartT);
 
-		entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+		entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp("dir", fullPath, 0, 0, ioStartT, ioElapsedNanoSec.count() );
 
 		atomicLiveOps.numEntriesDone++;
 	} // end of for loop
@@ -7673,6 +9022,9 @@ void LocalWorker::hdfsDirModeIterateFiles()
 
 			rwOffsetGen->reset(); // reset for next file
 
+			IF_UNLIKELY(slowOps.isEnabled() )
+				slowOpsFilePath = fullPath;
+
 			std::chrono::steady_clock::time_point ioStartT = std::chrono::steady_clock::now();
 
 			if( (benchPhase == BenchPhase_CREATEFILES) || (benchPhase == BenchPhase_READFILES) )
@@ -7758,22 +9110,28 @@ void LocalWorker::hdfsDirModeIterateFiles()
 
 			// calc entry operations latency. (for create, this includes open/rw/close.)
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
 			// inc special rwmix thread stats
 			if(isRWMixedReader)
 			{
-				entriesLatHistoReadMix.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHistoReadMix.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOpsReadMix.numEntriesDone++;
 			}
 			else
 			{
-				entriesLatHisto.addLatency(ioElapsedMicroSec.count() );
+				entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
 				atomicLiveOps.numEntriesDone++;
 			}
 
+			IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+				addSlowOp("file", fullPath, 0,
+					( (benchPhase == BenchPhase_CREATEFILES) ||
+						(benchPhase == BenchPhase_READFILES) ) ? fileSize : 0,
+					ioStartT, ioElapsedNanoSec.count() );
+
 		} // end of files for loop
 	} // end of dirs for loop
 
@@ -8023,12 +9381,12 @@ void LocalWorker::netbenchDoTransferClient()
 
 			// calc io operation latency
 			std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
-			std::chrono::microseconds ioElapsedMicroSec =
-				std::chrono::duration_cast<std::chrono::microseconds>
+			std::chrono::nanoseconds ioElapsedNanoSec =
+				std::chrono::duration_cast<std::chrono::nanoseconds>
 				(ioEndT - ioStartT);
 
 			// iops lat & num done
-			iopsLatHisto.addLatency(ioElapsedMicroSec.count() );
+			iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
 			atomicLiveOps.numBytesDone += currentBlockSize;
 			atomicLiveOps.numIOPSDone++;
 		}
@@ -8063,6 +9421,372 @@ void LocalWorker::netbenchDoTransferClient()
 
 }
 
+/**
+ * Replay the ops of this worker from the ops log file given by "--replay". Each op gets issued at
+ * its recorded time relative to the phase start (scaled by the replay speed) or as fast as
+ * possible if replay speed is 0.
+ *
+ * @throw WorkerException on error.
+ */
+void LocalWorker::replayModeIterateOps()
+{
+	const double replaySpeed = progArgs->getReplaySpeed();
+	const bool isS3Mode = (progArgs->getBenchMode() == BenchMode_S3);
+	const std::chrono::steady_clock::time_point phaseStartT = workersSharedData->phaseStartT;
+	const ReplayOpVec& opsVec = replayOps.getOps();
+	ReplayFDMap openFDMap;
+
+	if(opsVec.empty() )
+	{
+		workerGotPhaseWork = false;
+		return;
+	}
+
+	// single current file for funcPositionalRead/Write, as in dir mode
+	fileHandles.fdVec.resize(1);
+	fileHandles.fdVec[0] = -1;
+	fileHandles.fdVecPtr = &fileHandles.fdVec;
+
+	// (offsets and lengths get reset per op for s3 downloads/uploads)
+	rwOffsetGen = std::make_unique<OffsetGenSequential>(0, 0, progArgs->getBlockSize() );
+
+	try
+	{
+		for(const ReplayOp& op : opsVec)
+		{
+			if(replaySpeed)
+			{ // wait for the recorded time of this op
+				const std::chrono::steady_clock::time_point intendedT = phaseStartT +
+					std::chrono::nanoseconds( (uint64_t)(op.timeNS / replaySpeed) );
+				std::chrono::steady_clock::time_point nowT = std::chrono::steady_clock::now();
+
+				while( (nowT < intendedT) && !isInterruptionRequested)
+				{
+					std::this_thread::sleep_until(std::min(intendedT,
+						nowT + std::chrono::milliseconds(REPLAY_MAX_SLEEP_MS) ) );
+
+					nowT = std::chrono::steady_clock::now();
+				}
+
+				checkInterruptionRequest();
+			}
+
+			std::chrono::steady_clock::time_point ioStartT = std::chrono::steady_clock::now();
+
+			if(isS3Mode)
+				replayModeS3Op(op);
+			else
+				replayModePosixOp(op, openFDMap);
+
+			if(ReplayOpStore::isEntryOpType(op.type) )
+			{
+				// calc entry operation latency
+				std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
+				std::chrono::nanoseconds ioElapsedNanoSec =
+					std::chrono::duration_cast<std::chrono::nanoseconds>
+					(ioEndT - ioStartT);
+
+				entriesLatHisto.addLatency(ioElapsedNanoSec.count() );
+				atomicLiveOps.numEntriesDone++;
+
+				IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+					addSlowOp(ReplayOpStore::opTypeToStr(op.type), replayOps.getPath(op.pathIdx),
+						op.offset, op.length, ioStartT, ioElapsedNanoSec.count() );
+			}
+
+			checkInterruptionRequest();
+		}
+	}
+	catch(...)
+	{ // close files and pass exception on to caller
+		replayModeCloseFiles(openFDMap);
+		throw;
+	}
+
+	replayModeCloseFiles(openFDMap);
+}
+
+/**
+ * Replay a single op of a POSIX file system ops log.
+ *
+ * @openFDMap files that are currently open; will be updated by open/close ops.
+ * @throw WorkerException on error.
+ */
+void LocalWorker::replayModePosixOp(const ReplayOp& op, ReplayFDMap& openFDMap)
+{
+	const std::string& path = replayOps.getPath(op.pathIdx);
+	const bool ignoreDelErrors = progArgs->getIgnoreDelErrors();
+
+	switch(op.type)
+	{
+		case ReplayOp_OPEN:
+		{
+			replayModeOpenFile(op.pathIdx, op.isCreate, openFDMap);
+		} break;
+
+		case ReplayOp_CLOSE:
+		{
+			auto fdIter = openFDMap.find(op.pathIdx);
+			if(fdIter == openFDMap.end() )
+				break; // not open (e.g. because recorded open was of a shared file)
+
+			const int fd = fdIter->second;
+
+			openFDMap.erase(fdIter);
+
+			OPLOG_PRE_OP("close", std::to_string(fd), 0, 0);
+
+			int closeRes = close(fd);
+
+			OPLOG_POST_OP("close", std::to_string(fd), 0, 0, closeRes == -1);
+
+			if(closeRes == -1)
+				throw WorkerException("File close failed. "
+					"Path: " + path + "; "
+					"SysErr: " + strerror(errno) );
+		} break;
+
+		case ReplayOp_READ:
+		case ReplayOp_WRITE:
+		{ // (files without recorded open, e.g. in file/bdev mode, get opened implicitly)
+			replayModePosixRW(op, replayModeOpenFile(op.pathIdx, false, openFDMap) );
+		} break;
+
+		case ReplayOp_MKDIR:
+		{
+			OPLOG_PRE_OP("mkdirat", path, 0, 0);
+
+			int mkdirRes = mkdirat(AT_FDCWD, path.c_str(), MKDIR_MODE);
+
+			OPLOG_POST_OP("mkdirat", path, 0, 0, mkdirRes == -1);
+
+			if( (mkdirRes == -1) && (errno != EEXIST) )
+				throw WorkerException("Directory creation failed. "
+					"Path: " + path + "; "
+					"SysErr: " + strerror(errno) );
+		} break;
+
+		case ReplayOp_UNLINK:
+		{ // (recorded unlinks can be of files or dirs)
+			OPLOG_PRE_OP("unlinkat", path, 0, 0);
+
+			int unlinkRes = unlinkat(AT_FDCWD, path.c_str(), 0);
+
+			if( (unlinkRes == -1) && (errno == EISDIR) )
+				unlinkRes = unlinkat(AT_FDCWD, path.c_str(), AT_REMOVEDIR);
+
+			OPLOG_POST_OP("unlinkat", path, 0, 0, unlinkRes == -1);
+
+			if( (unlinkRes == -1) && ( (errno != ENOENT) || !ignoreDelErrors) )
+				throw WorkerException("Deletion failed. "
+					"Path: " + path + "; "
+					"SysErr: " + strerror(errno) );
+		} break;
+
+		case ReplayOp_STAT:
+		{
+			struct stat statBuf;
+
+			OPLOG_PRE_OP("fstat", path, 0, 0);
+
+			int statRes = fstatat(AT_FDCWD, path.c_str(), &statBuf, 0);
+
+			OPLOG_POST_OP("fstat", path, 0, 0, statRes == -1);
+
+			if(statRes == -1)
+				throw WorkerException("Stat failed. "
+					"Path: " + path + "; "
+					"SysErr: " + strerror(errno) );
+		} break;
+
+		default:
+		{ // s3 ops (not loaded in posix mode, see ReplayOpStore::loadOpsFromFile() )
+		} break;
+	}
+}
+
+/**
+ * Replay a recorded read or write of a POSIX file system ops log in block-sized chunks.
+ *
+ * @fd open file for the path of the op.
+ * @throw WorkerException on error.
+ */
+void LocalWorker::replayModePosixRW(const ReplayOp& op, int fd)
+{
+	const size_t blockSize = progArgs->getBlockSize();
+	const bool isRead = (op.type == ReplayOp_READ);
+	char* const ioBuf = ioBufVec[0];
+	uint64_t numBytesDone = 0;
+
+	fileHandles.fdVec[0] = fd;
+
+	while(numBytesDone < op.length)
+	{
+		const size_t currentBlockSize = std::min(op.length - numBytesDone, (uint64_t)blockSize);
+		const uint64_t currentOffset = op.offset + numBytesDone;
+
+		((*this).*funcRWRateLimiter)(currentBlockSize, isInterruptionRequested);
+
+		std::chrono::steady_clock::time_point ioStartT = std::chrono::steady_clock::now();
+
+		ssize_t rwRes = isRead ?
+			((*this).*funcPositionalRead)(0, ioBuf, currentBlockSize, currentOffset) :
+			((*this).*funcPositionalWrite)(0, ioBuf, currentBlockSize, currentOffset);
+
+		IF_UNLIKELY(rwRes <= 0)
+			throw WorkerException(std::string(isRead ? "Read" : "Write") + " failed. "
+				"Path: " + replayOps.getPath(op.pathIdx) + "; "
+				"Offset: " + std::to_string(currentOffset) + "; "
+				"Length: " + std::to_string(currentBlockSize) + "; "
+				"SysErr: " + (rwRes ? strerror(errno) : "Unexpected end of file") );
+
+		// calc io operation latency
+		std::chrono::steady_clock::time_point ioEndT = std::chrono::steady_clock::now();
+		std::chrono::nanoseconds ioElapsedNanoSec =
+			std::chrono::duration_cast<std::chrono::nanoseconds>
+			(ioEndT - ioStartT);
+
+		iopsLatHisto.addLatency(ioElapsedNanoSec.count() );
+		atomicLiveOps.numBytesDone += rwRes;
+		atomicLiveOps.numIOPSDone++;
+
+		IF_UNLIKELY(slowOps.isSlowOp(ioElapsedNanoSec.count() ) )
+			addSlowOp(isRead ? "read" : "write", replayOps.getPath(op.pathIdx), currentOffset,
+				rwRes, ioStartT, ioElapsedNanoSec.count() );
+
+		numIOPSSubmitted++;
+		numBytesDone += rwRes;
+
+		checkInterruptionRequest();
+	}
+}
+
+/**
+ * Open file for replay unless it is already open. Files only get opened for writing if the replay
+ * ops of this worker contain writes to them, so that read-only replays work on read-only files
+ * and mounts.
+ *
+ * @isCreate true to create the file if it doesn't exist (see ReplayOp::isCreate); otherwise a
+ * 	missing file is an error, as it would be in the recorded run.
+ * @openFDMap files that are currently open; will be updated if file gets opened.
+ * @return fd of open file.
+ * @throw WorkerException on error.
+ */
+int LocalWorker::replayModeOpenFile(uint32_t pathIdx, bool isCreate, ReplayFDMap& openFDMap)
+{
+	auto fdIter = openFDMap.find(pathIdx);
+	if(fdIter != openFDMap.end() )
+		return fdIter->second; // already open
+
+	const std::string& path = replayOps.getPath(pathIdx);
+	int openFlags = replayOps.isPathWritten(pathIdx) ? O_RDWR : O_RDONLY;
+
+	if(isCreate)
+		openFlags |= O_CREAT;
+
+#if !defined(__APPLE__)
+	if(progArgs->getUseDirectIO() )
+		openFlags |= O_DIRECT;
+#endif // !apple
+
+	OPLOG_PRE_OP("open", path, 0, 0);
+
+	int fd = open(path.c_str(), openFlags, MKFILE_MODE);
+
+	OPLOG_POST_OP("open", path, 0, 0, fd == -1);
+
+	if(fd == -1)
+		throw WorkerException("File open failed. "
+			"Path: " + path + "; "
+			"SysErr: " + strerror(errno) );
+
+	openFDMap[pathIdx] = fd;
+
+	return fd;
+}
+
+/**
+ * Close all files that are still open at the end of the replay, e.g. because the ops log ended
+ * before the recorded close.
+ */
+void LocalWorker::replayModeCloseFiles(ReplayFDMap& openFDMap)
+{
+	for(const auto& pathIdxAndFD : openFDMap)
+	{
+		const int fd = pathIdxAndFD.second;
+
+		OPLOG_PRE_OP("close", std::to_string(fd), 0, 0);
+
+		int closeRes = close(fd);
+
+		OPLOG_POST_OP("close", std::to_string(fd), 0, 0, closeRes == -1);
+
+		if(closeRes == -1)
+			ERRLOGGER(Log_NORMAL, "Error on file close. "
+				"Path: " << replayOps.getPath(pathIdxAndFD.first) << "; "
+				"SysErr: " << strerror(errno) << std::endl);
+	}
+
+	openFDMap.clear();
+
+	fileHandles.fdVec[0] = -1;
+}
+
+/**
+ * Replay a single op of an S3 ops log. Recorded entry names are "bucket/object".
+ *
+ * @throw WorkerException on error.
+ */
+void LocalWorker::replayModeS3Op(const ReplayOp& op)
+{
+	const std::string& entryPath = replayOps.getPath(op.pathIdx);
+	const size_t slashPos = entryPath.find('/');
+
+	if(slashPos == std::string::npos)
+		throw WorkerException("Invalid S3 object path in ops log for replay: " + entryPath);
+
+	const std::string bucketName = entryPath.substr(0, slashPos);
+	const std::string objectName = entryPath.substr(slashPos + 1);
+
+	switch(op.type)
+	{
+		case ReplayOp_S3GET:
+		{
+			rwOffsetGen->reset(op.length, op.offset);
+
+			s3ModeDownloadObject(bucketName, objectName, false);
+		} break;
+
+		case ReplayOp_S3PUT:
+		{
+			if(op.length > progArgs->getBlockSize() )
+				throw WorkerException("Replay of S3 object upload requires block size to be at "
+					"least the recorded upload size. "
+					"Object: " + entryPath + "; "
+					"Upload size: " + std::to_string(op.length) + "; "
+					"Block size: " + std::to_string(progArgs->getBlockSize() ) );
+
+			rwOffsetGen->reset(op.length, op.offset);
+
+			s3ModeUploadObjectSinglePart(bucketName, objectName);
+		} break;
+
+		case ReplayOp_S3HEAD:
+		{
+			s3ModeStatObject(bucketName, objectName);
+		} break;
+
+		case ReplayOp_S3DELETE:
+		{
+			s3ModeDeleteObject(bucketName, objectName);
+		} break;
+
+		default:
+		{ // posix ops (not loaded in s3 mode, see ReplayOpStore::loadOpsFromFile() )
+		} break;
+	}
+}
+
 /**
  * Calls the general sync() command to commit dirty pages from the linux page cache to stable
  * storage.
@@ -8083,8 +9807,12 @@ void LocalWorker::anyModeSync()
 
 #ifndef SYNCFS_SUPPORT
 
+		OPLOG_PRE_OP("sync", "", 0, 0);
+
 		sync();
 
+		OPLOG_POST_OP("sync", "", 0, 0, false);
+
 #else // SYNCFS_SUPPORT
 
 	const IntVec& pathFDs = progArgs->getBenchPathFDs();
@@ -8096,8 +9824,12 @@ void LocalWorker::anyModeSync()
 		size_t currentIdx = (i + workerRank) % pathFDs.size();
 		int currentFD = pathFDs[currentIdx];
 
+		OPLOG_PRE_OP("syncfs", pathVec[currentIdx], 0, 0);
+
 		int syncRes = syncfs(currentFD);
 
+		OPLOG_POST_OP("syncfs", pathVec[currentIdx], 0, 0, syncRes == -1);
+
 		if(syncRes == -1)
 			throw WorkerException(std::string("Cache sync failed. ") +
 				"Path: " + pathVec[currentIdx] + "; "
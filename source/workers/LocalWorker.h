@@ -16,10 +16,15 @@
 #include "toolkits/offsetgen/OffsetGenerator.h"
 #include "toolkits/offsetgen/OffsetGenRandomAlignedFullCoverageV2.h"
 #include "toolkits/OpsLogger.h"
+#include "toolkits/random/CompressibleDataGen.h"
+#include "toolkits/random/DedupeDataGen.h"
 #include "toolkits/random/RandAlgoInterface.h"
+#include "toolkits/OpenLoopScheduler.h"
 #include "toolkits/RateLimiter.h"
+#include "toolkits/RateLimiterShared.h"
 #include "toolkits/RateLimiterRWMixThreads.h"
 #include "toolkits/S3Tk.h"
+#include "ReplayOpStore.h"
 #include "S3UploadStore.h"
 #include "Worker.h"
 
@@ -32,6 +37,10 @@
 	#include <libaio.h>
 #endif
 
+#ifdef LIBURING_SUPPORT
+	#include <liburing.h>
+#endif
+
 #ifdef HDFS_SUPPORT
 	#include <hdfs.h>
 #endif
@@ -59,6 +68,20 @@ typedef void (LocalWorker::*GPU_MEMCPY_RW)(void* hostIOBuf, void* gpuIOBuf, size
 // function pointer for sync or async IO
 typedef int64_t (LocalWorker::*RW_BLOCKSIZED)();
 
+#ifdef LIBURING_SUPPORT
+/**
+ * In-flight io_uring request. Index in LocalWorker::iouringContext.requestVec matches the index of
+ * the corresponding buffer in ioBufVec and the registered buffer index.
+ */
+struct IOUringRequest
+{
+    int fd; // plain fd (not the registered file index), e.g. for flock
+    uint64_t offset;
+    size_t len;
+    bool isRead;
+};
+#endif // LIBURING_SUPPORT
+
 // function pointer for cuFile handle register
 typedef void (LocalWorker::*CUFILE_HANDLE_REGISTER)(int fd, CuFileHandleData& handleData);
 
@@ -94,6 +117,9 @@ class LocalWorker : public Worker
 
 		BufferVec gpuIOBufVec; // gpu memory buffers for read/write via cuda (count matches iodepth)
 
+		BufferVec blockVarPoolVec; // pre-generated random write blocks (progArgs::blockVarPoolSize)
+		std::vector<size_t> blockVarPoolSlotRoundVec; // per IO slot: next round in blockVarPoolVec
+
 		struct
 		{
 			IntVec threadFDVec; // separate open files in file/bdev mode (progArgs::useNoFDSharing)
@@ -116,7 +142,9 @@ class LocalWorker : public Worker
 		} fileHandles;
 
 		RateLimiter rateLimiter; // for r/w rate limit per sec if set by user
+		RateLimiterShared* sharedRateLimiter{NULL}; // host-wide r/w limiter if limit scope not thread
 		RateLimiterRWMixThreads rateLimiterRWMixThreads; // for r/w threads rate balance if set
+		OpenLoopScheduler openLoopScheduler; // arrival schedule for open-loop ops if set by user
 
 		uint64_t numIOPSSubmitted{0}; // internal sequential counter, not reset between phases
 
@@ -134,14 +162,22 @@ class LocalWorker : public Worker
 		GPU_MEMCPY_RW funcPostReadCudaMemcpy; // copy to GPU memory
 		CUFILE_HANDLE_REGISTER funcCuFileHandleReg; // cuFile handle register
 		CUFILE_HANDLE_DEREGISTER funcCuFileHandleDereg; // cuFile handle deregister
-		RW_RATE_LIMITER funcRWRateLimiter; // limit per-thread read or write throughput
+		RW_RATE_LIMITER funcRWRateLimiter; // limit read or write throughput
 		std::unique_ptr<OffsetGenerator> rwOffsetGen; // r/w offset gen for phase-dependent funcs
+		std::vector<uint64_t> offsetBatchVec; // batch from rwOffsetGen for async IO (iodepth)
+		std::vector<size_t> blockSizeBatchVec; // batch from rwOffsetGen for async IO (iodepth)
 		std::unique_ptr<RandAlgoInterface> randOffsetAlgo; // for random offsets
 		std::unique_ptr<RandAlgoInterface> randBlockVarAlgo; // for random block contents variance
 		std::unique_ptr<RandAlgoInterface> randBlockVarReseed; // reseed for golden prime block var
+		std::unique_ptr<CompressibleDataGen> compressibleDataGen; // block var with compress ratio
+		std::unique_ptr<DedupeDataGen> dedupeDataGen; // block var with dedupe ratio
 
 		PathStore customTreeDirs; // non-shared dirs for custom tree mode
 		PathStore customTreeFiles; // non-shared and shared files for custom tree mode
+		ReplayOpStore replayOps; // ops of this worker for replay phase
+		std::string slowOpsFilePath; // current file in dir mode for slow IO ops (if enabled)
+		bool isFileLatFirstBytePending{false}; // next completed IO adds file lat time to 1st byte
+		std::chrono::steady_clock::time_point fileLatXferStartT; // data transfer start of file
 
 #ifdef CUDA_SUPPORT
 		int gpuID{-1}; // GPU ID for this worker, initialized in allocGPUIOBuffer
@@ -170,11 +206,31 @@ class LocalWorker : public Worker
         { // init in initLibAio()
             io_context_t ioContext = {};
             std::vector<struct iocb> iocbVec;
-            std::vector<struct iocb*> iocbPointerVec;
+            std::vector<struct iocb*> iocbPointerVec; // batch of prepared iocbs for io_submit
+            std::vector<struct io_event> ioEventVec; // completions from io_getevents
+            std::vector<size_t> freeSlotVec; // stack of iocbVec indices available for new IOs
             std::vector<std::chrono::steady_clock::time_point> ioStartTimeVec;
+            std::vector<std::chrono::steady_clock::time_point> intendedStartTimeVec; // open-loop
         } libaioContext;
 #endif // LIBAIO_SUPPORT
 
+#ifdef LIBURING_SUPPORT
+        struct
+        { // init in initIOUring()
+            struct io_uring ring = {};
+            bool isRingInitialized = false;
+            bool useFixedBufs = false; // true if ioBufVec is registered with the ring
+            bool isFileTableRegistered = false; // true if any file table is registered with ring
+            bool useFixedFiles = false; // true if registered file table matches current phase fds
+            size_t numPending = 0; // submitted and not yet reaped requests
+            std::vector<IOUringRequest> requestVec; // request info of in-flight IOs
+            std::vector<size_t> freeSlotVec; // stack of requestVec indices available for new IOs
+            std::vector<size_t> preppedSlotVec; // requestVec indices of current submission batch
+            std::vector<std::chrono::steady_clock::time_point> ioStartTimeVec;
+            std::vector<std::chrono::steady_clock::time_point> intendedStartTimeVec; // open-loop
+        } iouringContext;
+#endif // LIBURING_SUPPORT
+
 		static SocketVec serverSocketVec; // singleton netbench server sockets for all local threads
 		BasicSocket* clientSocket{NULL}; // netbench socket for client
 
@@ -188,6 +244,8 @@ class LocalWorker : public Worker
 
         void initLibAio();
         void uninitLibAio();
+        void initIOUring();
+        void uninitIOUring();
 		void initS3Client();
 		void uninitS3Client();
 		void initHDFS();
@@ -206,15 +264,26 @@ class LocalWorker : public Worker
 		void initThreadPhaseVars();
 		void initPhaseFileHandleVecs();
 		void initPhaseRWOffsetGen();
+		void initPhaseDedupeDataGen();
 		void nullifyPhaseFunctionPointers();
 		void initPhaseFunctionPointers();
 
 		void allocIOBuffer();
 		void allocGPUIOBuffer();
+		void allocBlockVarPool();
+		size_t getNextBlockVarPoolIdx(size_t slotIdx, size_t numSlots);
 		void prepareCustomTreePathStores();
+		void prepareReplayOps();
 
+		template<bool IS_WRITE_PHASE, bool USE_RWMIX, bool USE_FLOCK, bool USE_HOOKS>
 		int64_t rwBlockSized();
+		RW_BLOCKSIZED selectRWBlockSizedSync();
 		int64_t aioBlockSized();
+		int64_t uringBlockSized();
+		size_t getNumPacedAsyncIOs(size_t numFreeSlots, size_t numPending, bool useOpenLoopIOs);
+		uint64_t getPacedAsyncCompletionWaitNanoSec(size_t numFreeSlots, bool useOpenLoopIOs);
+		void uringUpdateRegisteredFiles();
+		void uringDrainPending();
 		void calcFileIdxAndOffsetStriped(const uint64_t rwOffsetGenNext,
 		    const uint64_t fileSize, const bool isSingleFile,
 		    size_t& outFileIdx, uint64_t& outFileOffset);
@@ -229,6 +298,12 @@ class LocalWorker : public Worker
 		void fileModeDeleteFiles();
 		std::string fileModeLogPathFromFileHandlesErr();
 
+		void addSlowOp(const char* opName, const std::string& path, uint64_t offset,
+			uint64_t length, std::chrono::steady_clock::time_point startT, uint64_t latencyNS);
+		std::string getSlowOpsIOPath(int fd);
+		void addFileLat(FileLatType type, std::chrono::steady_clock::time_point& inOutStepStartT);
+		void addFileLatFirstByte(std::chrono::steady_clock::time_point ioEndT);
+
 		void s3ModeIterateBuckets();
 		void s3ModeIterateObjects();
 		void s3ModeIterateObjectsRand();
@@ -296,6 +371,13 @@ class LocalWorker : public Worker
 		void netbenchDoTransferServer();
 		void netbenchDoTransferClient();
 
+		void replayModeIterateOps();
+		void replayModePosixOp(const ReplayOp& op, ReplayFDMap& openFDMap);
+		void replayModePosixRW(const ReplayOp& op, int fd);
+		int replayModeOpenFile(uint32_t pathIdx, bool isCreate, ReplayFDMap& openFDMap);
+		void replayModeCloseFiles(ReplayFDMap& openFDMap);
+		void replayModeS3Op(const ReplayOp& op);
+
 		void anyModeSync();
 		void anyModeDropCaches();
 
@@ -333,10 +415,17 @@ class LocalWorker : public Worker
 			off_t fileOffset);
 		void postReadIntegrityCheckVerifyBuf(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
 			off_t fileOffset);
+		static char getIntegrityCheckByte(off_t fileOffset, uint64_t checkSumSalt);
+		void throwIntegrityCheckMismatch(const char* hostIOBuf, size_t bufLen, off_t fileOffset,
+			size_t startIdx);
 		void preWriteBufRandRefill(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
 			off_t fileOffset);
 		void preWriteBufRandRefillCuda(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
 			off_t fileOffset);
+		void preWriteBufCompressibleRefill(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
+			off_t fileOffset);
+		void preWriteBufDedupeRefill(char* hostIOBuf, char* gpuIOBuf, size_t bufLen,
+			off_t fileOffset);
 
 		void aioWritePrepper(struct iocb* iocb, int fd, void* buf, size_t count, long long offset);
 		void aioReadPrepper(struct iocb* iocb, int fd, void* buf, size_t count, long long offset);
@@ -346,6 +435,8 @@ class LocalWorker : public Worker
             std::atomic_bool& isInterruptionRequested);
         bool preRWRateLimiter(size_t rwSize,
             std::atomic_bool& isInterruptionRequested);
+        bool preRWSharedRateLimiter(size_t rwSize,
+            std::atomic_bool& isInterruptionRequested);
         bool preRWRateBalanceLimiterForReaders(size_t rwSize,
             std::atomic_bool& isInterruptionRequested);
         bool preRWRateBalanceLimiterForWriters(size_t rwSize,
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include <string>
 #include <sstream>
@@ -86,6 +87,7 @@ void RemoteWorker::run()
                 case BenchPhase_PUT_S3_BUCKET_MD:
                 case BenchPhase_DEL_S3_BUCKET_MD:
 				case BenchPhase_S3MPUCOMPLETE:
+				case BenchPhase_REPLAY:
 				{
 					startBenchPhase();
 
@@ -240,9 +242,29 @@ void RemoteWorker::finishPhase(bool allowExceptionThrow)
 
 		iopsLatHisto.setFromPropertyTreeForService(resultTree, XFER_STATS_LAT_PREFIX_IOPS);
 		entriesLatHisto.setFromPropertyTreeForService(resultTree, XFER_STATS_LAT_PREFIX_ENTRIES);
+		ioBatchStats.setFromPropertyTreeForService(resultTree);
+		slowOps.setFromPropertyTreeForService(resultTree);
+		slowOps.setHost(host);
+		resourceStats.setFromPropertyTreeForService(resultTree);
+
+		if(progArgs->getShowFileLatBreakdown() )
+			fileLatStats.setFromPropertyTreeForService(resultTree);
+
+		if(progArgs->getOpenLoopOpsPerSec() )
+		{
+			iopsRespLatHisto.setFromPropertyTreeForService(resultTree,
+				XFER_STATS_LAT_PREFIX_IOPS_RESP);
+			entriesRespLatHisto.setFromPropertyTreeForService(resultTree,
+				XFER_STATS_LAT_PREFIX_ENTRIES_RESP);
+			openLoopStats.setFromPropertyTreeForService(resultTree);
+		}
+
+		std::unique_lock<std::mutex> liveLatencyLock(liveLatencyMutex); // L O C K
 
 		liveLatency.setToZero(); // this service is done, so no more latency
 
+		liveLatencyLock.unlock(); // U N L O C K
+
 		if( (workersSharedData->currentBenchPhase == BenchPhase_CREATEFILES) &&
 			(progArgs->getRWMixReadPercent() || progArgs->getNumRWMixReadThreads() ||
 				(progArgs->getBenchMode() == BenchMode_NETBENCH) ) )
@@ -294,6 +316,10 @@ void RemoteWorker::finishPhase(bool allowExceptionThrow)
     if(!treeFilePath.empty() )
         prepareRemoteFile(treeFilePath, SERVICE_UPLOAD_TREEFILE);
 
+    std::string replayFilePath = progArgs->getReplayFilePath();
+    if(!replayFilePath.empty() )
+        prepareRemoteFile(replayFilePath, SERVICE_UPLOAD_REPLAYFILE);
+
     if(progArgs->getUseS3MPUSharing() )
         prepareRemoteFile(S3_IMPLICIT_MPUSHAING_PATH, SERVICE_UPLOAD_MPUSHARINGFILE);
  }
@@ -516,6 +542,11 @@ void RemoteWorker::waitForBenchPhaseCompletion(bool checkInterruption)
                 liveLatency.numAvgEntriesLatValues = numAvgEntriesLatValues;
             }
 
+            setLiveLatHistoFromStr(liveLatency.ioLatHisto,
+                statusTree.get<std::string>(XFER_STATS_LIVELATHISTO_IOPS) );
+            setLiveLatHistoFromStr(liveLatency.entriesLatHisto,
+                statusTree.get<std::string>(XFER_STATS_LIVELATHISTO_ENTRIES) );
+
 			if( (workersSharedData->currentBenchPhase == BenchPhase_CREATEFILES) &&
 				(progArgs->getRWMixReadPercent() || progArgs->getNumRWMixReadThreads() ||
 					isNetBenchMode) )
@@ -546,6 +577,11 @@ void RemoteWorker::waitForBenchPhaseCompletion(bool checkInterruption)
                         statusTree.get<uint64_t>(XFER_STATS_LAT_SUM_ENTRIES_RWMIXREAD);
                     liveLatency.numAvgEntriesLatReadMixValues = numAvgEntriesLatReadMixValues;
                 }
+
+                setLiveLatHistoFromStr(liveLatency.ioLatReadMixHisto,
+                    statusTree.get<std::string>(XFER_STATS_LIVELATHISTO_IOPS_RWMIXREAD) );
+                setLiveLatHistoFromStr(liveLatency.entriesLatReadMixHisto,
+                    statusTree.get<std::string>(XFER_STATS_LIVELATHISTO_ENTRIES_RWMIXREAD) );
             }
 
 			IF_UNLIKELY(numWorkersDoneWithError)
@@ -572,6 +608,8 @@ void RemoteWorker::waitForBenchPhaseCompletion(bool checkInterruption)
                         worker->createStoneWallStats();
             }
 
+            updateGlobalRateLimitShare();
+
 		}
 		catch(Web::system_error& e)
 		{
@@ -583,6 +621,94 @@ void RemoteWorker::waitForBenchPhaseCompletion(bool checkInterruption)
 
 }
 
+/**
+ * Update the live throughput of this service in the global rate limit balancer and send the new
+ * share of the global limit to the service if it changed significantly. Does nothing if the user
+ * did not select global rate limit scope.
+ *
+ * @throw WorkerException on error, e.g. http client problem
+ */
+void RemoteWorker::updateGlobalRateLimitShare()
+{
+	if(progArgs->getLimitScope() != ARG_LIMITSCOPE_GLOBAL)
+		return;
+
+	const size_t numHosts = progArgs->getHostsVec().size();
+	const uint64_t numBytesDone =
+		atomicLiveOps.numBytesDone + atomicLiveOpsReadMix.numBytesDone;
+	const uint64_t numIOPSDone =
+		atomicLiveOps.numIOPSDone + atomicLiveOpsReadMix.numIOPSDone;
+
+	const double newShare = workersSharedData->rateLimitBalancer.updateHost(
+		workerRank - progArgs->getRankOffset(), numBytesDone, numIOPSDone,
+		std::chrono::steady_clock::now() );
+
+	if(!rateLimitShare)
+		rateLimitShare = 1.0 / numHosts; // even share was sent with the benchmark config
+
+	if(std::fabs(newShare - rateLimitShare) <
+		(rateLimitShare * RATELIMITBALANCER_MIN_CHANGE_PCT / 100) )
+		return;
+
+	rateLimitShare = newShare;
+
+	// (a host limit of 0 would mean unlimited, so at least 1)
+	auto calcHostLimit = [this](uint64_t globalLimit) -> uint64_t
+		{ return globalLimit ? std::max( (uint64_t)(globalLimit * rateLimitShare),
+			(uint64_t)1) : 0; };
+
+	try
+	{
+		std::string requestPath = HTTPCLIENTPATH_RATELIMIT "?"
+			XFER_RATELIMIT_BENCHID "=" + buuids::to_string(workersSharedData->currentBenchID) +
+			"&" XFER_RATELIMIT_READBPS "=" +
+				std::to_string(calcHostLimit(progArgs->getLimitReadBps() ) ) +
+			"&" XFER_RATELIMIT_READIOPS "=" +
+				std::to_string(calcHostLimit(progArgs->getLimitReadIOPS() ) ) +
+			"&" XFER_RATELIMIT_WRITEBPS "=" +
+				std::to_string(calcHostLimit(progArgs->getLimitWriteBps() ) ) +
+			"&" XFER_RATELIMIT_WRITEIOPS "=" +
+				std::to_string(calcHostLimit(progArgs->getLimitWriteIOPS() ) );
+
+		auto response = httpClient.request("GET", requestPath);
+
+		IF_UNLIKELY(response->status_code != Web::status_code(Web::StatusCode::success_ok) )
+		{
+			Logger(Log_DEBUG) << "HTTP status code: " + response->status_code << std::endl;
+
+			throw WorkerException(frameHostErrorMsg(response->content.string() ) );
+		}
+	}
+	catch(Web::system_error& e)
+	{
+		throw WorkerException(
+			std::string("HTTP client error in rate limit update: ") + e.what() + ". "
+			"Service: " + host);
+	}
+}
+
+/**
+ * Update a live percentiles histogram from the counts string of a service status update. Empty
+ * strings (no new values, e.g. due to rate limit) keep the previous values, just like live avg
+ * latency.
+ *
+ * @throw ProgException on invalid counts string.
+ */
+void RemoteWorker::setLiveLatHistoFromStr(HdrHistogram& outHisto, const std::string& countsStr)
+{
+	if(countsStr.empty() )
+		return;
+
+	HdrHistogram newHisto;
+
+	newHisto.init(progArgs->getLatencyHistoDigits(), LATHISTO_MAXNANOSEC);
+	newHisto.setCountsFromStr(countsStr);
+
+	std::unique_lock<std::mutex> lock(liveLatencyMutex); // L O C K (scoped)
+
+	outHisto = std::move(newHisto);
+}
+
 /**
  * Interrupt the currently running benchmark phase on the service host and quit the service if
  * progArgs->getQuitServices() is set.
@@ -59,7 +59,10 @@ class RemoteWorker : public Worker
 			unsigned lastDone = 0;
 		} cpuUtil; // all values are percent
 
+		double rateLimitShare{0}; // last sent share of global rate limit; 0 for initial even share
+
 		LiveLatency liveLatency = {};
+		std::mutex liveLatencyMutex; // protects liveLatency histos against concurrent live stats
 
 		virtual void run() override;
 
@@ -68,7 +71,9 @@ class RemoteWorker : public Worker
 		void prepareRemoteFile(std::string localFilePath, std::string remoteFilename);
 		void preparePhase();
 		void startBenchPhase();
+		void setLiveLatHistoFromStr(HdrHistogram& outHisto, const std::string& countsStr);
 		void waitForBenchPhaseCompletion(bool checkInterruption);
+		void updateGlobalRateLimitShare();
 		void interruptBenchPhase(bool allowExceptionThrow, bool logSuccessMsg=false);
 		std::string frameHostErrorMsg(std::string string);
         std::chrono::steady_clock::time_point calcNextRefreshTime(
@@ -91,6 +96,8 @@ class RemoteWorker : public Worker
 		 */
 		virtual void getAndAddLiveLatency(LiveLatency& outLiveLatency) override
 		{
+			std::unique_lock<std::mutex> lock(liveLatencyMutex); // L O C K (scoped)
+
 			liveLatency.getAndAddOps(outLiveLatency);
 		}
 
@@ -99,10 +106,13 @@ class RemoteWorker : public Worker
 			Worker::resetStats();
 
 			pingMicroSecs = 0;
+			rateLimitShare = 0;
 
 			numWorkersDone = 0;
 			numWorkersDoneWithError = 0;
 
+			std::unique_lock<std::mutex> lock(liveLatencyMutex); // L O C K (scoped)
+
 			liveLatency = {};
 		}
 
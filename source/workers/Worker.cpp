@@ -67,7 +67,8 @@ void Worker::incNumWorkersDoneWithError()
 }
 
 /**
- * Check if this worker has been friendly asked to interrupt itself.
+ * Check if this worker has been friendly asked to interrupt itself. Also resets the phase stats if
+ * the end of the warmup period has been signaled.
  *
  * @throw WorkerInterruptedException if friendly ask to interrupt has been received.
  */
@@ -75,6 +76,9 @@ void Worker::checkInterruptionRequest()
 {
 	IF_UNLIKELY(isInterruptionRequested)
 		throw WorkerInterruptedException("Received friendly request to interrupt execution.");
+
+	IF_UNLIKELY(isWarmupEndRequested)
+		resetStatsAfterWarmup();
 }
 
 /**
@@ -91,6 +95,9 @@ void Worker::checkInterruptionRequest(std::function<void()> func)
 		func();
 		throw WorkerInterruptedException("Received friendly request to interrupt execution.");
 	}
+
+	IF_UNLIKELY(isWarmupEndRequested)
+		resetStatsAfterWarmup();
 }
 
 /**
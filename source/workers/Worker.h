@@ -5,10 +5,15 @@
 #define WORKERS_WORKER_H_
 
 #include <iostream>
+#include "FileLatStats.h"
+#include "IOBatchStats.h"
 #include "LatencyHistogram.h"
 #include "LiveLatency.h"
 #include "LiveOps.h"
+#include "OpenLoopStats.h"
 #include "ProgArgs.h"
+#include "ResourceStats.h"
+#include "SlowOpsStats.h"
 #include "WorkersSharedData.h"
 
 
@@ -45,6 +50,11 @@ class Worker
 		UInt64Vec elapsedUSecVec; /* Microsecs. Only valid when phase completed successfully. For
 			LocalWorker: finish of only thread; for RemoteWorker: finish of each worker on host */
 		std::atomic_bool isInterruptionRequested{false}; // set true to request self-termination
+		std::atomic_bool isWarmupEndRequested{false}; // set true to request stats reset by worker
+		bool isWarmupEnded{false}; // true after stats reset at end of warmup period
+		bool isFinishingPhase{false}; /* true when finishPhase() froze the stats, so warmup end can't
+			be applied anymore (only accessed with workersSharedData mutex locked) */
+		std::chrono::steady_clock::time_point warmupEndT; // time of stats reset (if isWarmupEnded)
 		AtomicLiveOps atomicLiveOps; // done in current phase
 		AtomicLiveOps atomicLiveOpsReadMix; // done in current phase
 		AtomicLiveOps oldAtomicLiveOps; // copy of old atomicLiveOps for diff stats
@@ -58,6 +68,15 @@ class Worker
 		LatencyHistogram iopsLatHistoReadMix; // ops latency histogram (valid only at phase end)
 		LatencyHistogram entriesLatHisto; // entry latency histogram (valid only at phase end)
 		LatencyHistogram entriesLatHistoReadMix; // entry lat histogram (valid only at phase end)
+		LatencyHistogram iopsRespLatHisto; /* open-loop ops latency from intended issue time,
+			incl. rwmix reads (valid only at phase end) */
+		LatencyHistogram entriesRespLatHisto; /* open-loop entry latency from intended issue time,
+			incl. rwmix reads (valid only at phase end) */
+		IOBatchStats ioBatchStats; // async submit/reap batching (valid only at phase end)
+		OpenLoopStats openLoopStats; // open-loop backlog (valid only at phase end)
+		SlowOpsStats slowOps; // slowest ops of this worker (valid only at phase end)
+		FileLatStats fileLatStats; // file open/xfer/close breakdown (valid only at phase end)
+		ResourceStats resourceStats; // thread cpu time, faults etc (valid only at phase end)
 
 		virtual void run() = 0;
 		virtual void cleanup() {}; // cleanup immediately after run() (other workers still running)
@@ -85,11 +104,28 @@ class Worker
 			{ return entriesLatHisto; }
 		const LatencyHistogram& getEntriesLatencyHistogramReadMix() const
 			{ return entriesLatHistoReadMix; }
+		const LatencyHistogram& getIOPSRespLatencyHistogram() const
+			{ return iopsRespLatHisto; }
+		const LatencyHistogram& getEntriesRespLatencyHistogram() const
+			{ return entriesRespLatHisto; }
+		const IOBatchStats& getIOBatchStats() const
+			{ return ioBatchStats; }
+		const OpenLoopStats& getOpenLoopStats() const
+			{ return openLoopStats; }
+		const SlowOpsStats& getSlowOpsStats() const
+			{ return slowOps; }
+		const FileLatStats& getFileLatStats() const
+			{ return fileLatStats; }
+		const ResourceStats& getResourceStats() const
+			{ return resourceStats; }
 
 		virtual void resetStats()
 		{
 			phaseFinished = false;
 			workerGotPhaseWork = true;
+			isWarmupEndRequested = false;
+			isWarmupEnded = false;
+			isFinishingPhase = false;
 
 			elapsedUSecVec.resize(0);
 			atomicLiveOps.setToZero();
@@ -99,10 +135,54 @@ class Worker
 			stoneWallTriggered = false;
 			stoneWallOps.setToZero();
 			stoneWallOpsReadMix.setToZero();
-			iopsLatHisto.reset();
-			iopsLatHistoReadMix.reset();
-			entriesLatHisto.reset();
-			entriesLatHistoReadMix.reset();
+
+			// live percentiles only for local workers (remote workers get them from the service)
+			const bool useLiveLatHistos =
+				progArgs->getShowLatency() && progArgs->getHostsVec().empty();
+
+			iopsLatHisto.reset(progArgs->getLatencyHistoDigits(), useLiveLatHistos);
+			iopsLatHistoReadMix.reset(progArgs->getLatencyHistoDigits(), useLiveLatHistos);
+			entriesLatHisto.reset(progArgs->getLatencyHistoDigits(), useLiveLatHistos);
+			entriesLatHistoReadMix.reset(progArgs->getLatencyHistoDigits(), useLiveLatHistos);
+			iopsRespLatHisto.reset(progArgs->getLatencyHistoDigits(), false);
+			entriesRespLatHisto.reset(progArgs->getLatencyHistoDigits(), false);
+			ioBatchStats.setToZero();
+			openLoopStats.setToZero();
+			slowOps.reset(progArgs->getNumSlowOps() );
+
+			if(progArgs->getShowFileLatBreakdown() )
+				fileLatStats.reset(progArgs->getLatencyHistoDigits() );
+
+			resourceStats.setToZero();
+		}
+
+		/**
+		 * Reset the counters and histograms of the current phase at the end of the warmup period,
+		 * so that the phase results only cover the time after warmup. Only to be called by the
+		 * worker thread itself, because it doesn't synchronize with the recording of new values.
+		 * (Live latency values are not touched, so the live stats thread can continue to drain
+		 * them.)
+		 */
+		void resetStatsAfterWarmup()
+		{
+			isWarmupEndRequested = false;
+			isWarmupEnded = true;
+			warmupEndT = std::chrono::steady_clock::now();
+
+			atomicLiveOps.setToZero();
+			atomicLiveOpsReadMix.setToZero();
+
+			iopsLatHisto.resetTotals();
+			iopsLatHistoReadMix.resetTotals();
+			entriesLatHisto.resetTotals();
+			entriesLatHistoReadMix.resetTotals();
+			iopsRespLatHisto.resetTotals();
+			entriesRespLatHisto.resetTotals();
+			ioBatchStats.setToZero();
+			openLoopStats.setToZero();
+			slowOps.setToZero();
+			fileLatStats.resetTotals();
+			resourceStats.startPhase();
 		}
 
 		/**
@@ -148,6 +228,11 @@ class Worker
 
 			entriesLatHistoReadMix.addAndResetAverageLiveMicroSec(
 				outLiveLatency.numAvgEntriesLatReadMixValues, outLiveLatency.avgEntriesLatReadMixMicrosSecsSum);
+
+			iopsLatHisto.addAndSwitchLiveHisto(outLiveLatency.ioLatHisto);
+			iopsLatHistoReadMix.addAndSwitchLiveHisto(outLiveLatency.ioLatReadMixHisto);
+			entriesLatHisto.addAndSwitchLiveHisto(outLiveLatency.entriesLatHisto);
+			entriesLatHistoReadMix.addAndSwitchLiveHisto(outLiveLatency.entriesLatReadMixHisto);
 		}
 
 		/**
@@ -166,22 +251,34 @@ class Worker
 		 */
 		void getAndResetDiffStats(LiveOps& outLiveOpsDiff, LiveOps& outLiveOpsReadMixDiff)
 		{
-			outLiveOpsDiff.numEntriesDone = atomicLiveOps.numEntriesDone -
-				oldAtomicLiveOps.numEntriesDone.exchange(atomicLiveOps.numEntriesDone);
-			outLiveOpsDiff.numBytesDone = atomicLiveOps.numBytesDone -
-				oldAtomicLiveOps.numBytesDone.exchange(atomicLiveOps.numBytesDone);
-			outLiveOpsDiff.numIOPSDone = atomicLiveOps.numIOPSDone -
-				oldAtomicLiveOps.numIOPSDone.exchange(atomicLiveOps.numIOPSDone);
+			outLiveOpsDiff.numEntriesDone = getAndResetDiff(
+				atomicLiveOps.numEntriesDone, oldAtomicLiveOps.numEntriesDone);
+			outLiveOpsDiff.numBytesDone = getAndResetDiff(
+				atomicLiveOps.numBytesDone, oldAtomicLiveOps.numBytesDone);
+			outLiveOpsDiff.numIOPSDone = getAndResetDiff(
+				atomicLiveOps.numIOPSDone, oldAtomicLiveOps.numIOPSDone);
+
+			outLiveOpsReadMixDiff.numEntriesDone = getAndResetDiff(
+				atomicLiveOpsReadMix.numEntriesDone, oldAtomicLiveOpsReadMix.numEntriesDone);
+			outLiveOpsReadMixDiff.numBytesDone = getAndResetDiff(
+				atomicLiveOpsReadMix.numBytesDone, oldAtomicLiveOpsReadMix.numBytesDone);
+			outLiveOpsReadMixDiff.numIOPSDone = getAndResetDiff(
+				atomicLiveOpsReadMix.numIOPSDone, oldAtomicLiveOpsReadMix.numIOPSDone);
+		}
 
-			outLiveOpsReadMixDiff.numEntriesDone = atomicLiveOpsReadMix.numEntriesDone -
-				oldAtomicLiveOpsReadMix.numEntriesDone.exchange(
-					atomicLiveOpsReadMix.numEntriesDone);
-			outLiveOpsReadMixDiff.numBytesDone = atomicLiveOpsReadMix.numBytesDone -
-				oldAtomicLiveOpsReadMix.numBytesDone.exchange(
-					atomicLiveOpsReadMix.numBytesDone);
-			outLiveOpsReadMixDiff.numIOPSDone = atomicLiveOpsReadMix.numIOPSDone -
-				oldAtomicLiveOpsReadMix.numIOPSDone.exchange(
-						atomicLiveOpsReadMix.numIOPSDone);
+		/**
+		 * Store current value in old value and return the difference.
+		 *
+		 * @return difference between current and old value; the current value if the counter was
+		 * 	reset at the end of the warmup period in the meantime.
+		 */
+		static uint64_t getAndResetDiff(const std::atomic_uint_fast64_t& current,
+			std::atomic_uint_fast64_t& old)
+		{
+			const uint64_t currentVal = current;
+			const uint64_t oldVal = old.exchange(currentVal);
+
+			return (currentVal >= oldVal) ? (currentVal - oldVal) : currentVal;
 		}
 
 		/**
@@ -213,6 +310,20 @@ class Worker
 			return workerGotPhaseWork;
 		}
 
+		bool getIsFinishingPhase() const
+		{
+			return isFinishingPhase;
+		}
+
+		/**
+		 * Ask the worker to reset its stats at the end of the warmup period. Workers check this
+		 * together with the interruption request.
+		 */
+		void requestWarmupEnd()
+		{
+			isWarmupEndRequested = true;
+		}
+
 		/**
 		 * Friendly ask for the worker to terminate ifself. Workers check this in regular intervals.
 		 */
@@ -128,6 +128,49 @@ void WorkerManager::checkPhaseTimeLimit()
 	}
 }
 
+/**
+ * Check if the user-defined warmup period of the current phase is over and ask workers to reset
+ * their stats if it is. The CPU utilization baseline gets reset here. Phases in which a worker
+ * finished before the end of the warmup period are not affected.
+ *
+ * This is a no-op in master mode, because services handle the warmup period of their workers.
+ */
+void WorkerManager::checkPhaseWarmupEnd()
+{
+	if(!progArgs.getWarmupSecs() || !progArgs.getHostsVec().empty() )
+		return;
+
+	std::chrono::seconds elapsedDurationSecs =
+					std::chrono::duration_cast<std::chrono::seconds>
+					(std::chrono::steady_clock::now() - workersSharedData.phaseStartT);
+	size_t elapsedSecs = elapsedDurationSecs.count();
+
+	if(elapsedSecs < progArgs.getWarmupSecs() )
+		return;
+
+	std::unique_lock<std::mutex> lock(workersSharedData.mutex); // L O C K (scoped)
+
+	if(workersSharedData.isWarmupEndTriggered)
+		return;
+
+	workersSharedData.isWarmupEndTriggered = true;
+
+	if(workersSharedData.numWorkersDone || workersSharedData.numWorkersDoneWithError)
+		return; // phase is (partially) done already, so results include warmup
+
+	for(Worker* worker : workerVec)
+		if(worker->getIsFinishingPhase() )
+			return; // worker stats are frozen already, so results include warmup
+
+	LOGGER(Log_DEBUG, "Warmup period ended. Resetting stats." << std::endl);
+
+	for(Worker* worker : workerVec)
+		worker->requestWarmupEnd();
+
+	workersSharedData.cpuUtilFirstDone.update();
+	workersSharedData.cpuUtilLastDone.update();
+}
+
 /**
  * Prepare a new set of threads according to the number given in progArgs.
  * (Also initializes basics of workersSharedData and set workersSharedData.phaseStartT to now.)
@@ -263,6 +306,13 @@ void WorkerManager::waitForWorkersDone()
 
 		checkPhaseTimeLimitUnlocked();
 
+		if(!workersDone)
+		{
+			lock.unlock(); // U N L O C K
+			checkPhaseWarmupEnd();
+			lock.lock(); // L O C K
+		}
+
 	} while(!workersDone);
 
 }
@@ -316,14 +366,61 @@ void WorkerManager::startNextPhase(BenchPhase newBenchPhase, std::string* benchI
 
 	workersSharedData.currentBenchPhase = newBenchPhase;
 
+	initSharedRateLimitersUnlocked();
+
 	workersSharedData.cpuUtilFirstDone.update();
 	workersSharedData.cpuUtilLastDone.update();
+	ResourceStats::resetProcPeakRSS();
+	workersSharedData.isWarmupEndTriggered = false;
 	workersSharedData.phaseStartT = std::chrono::steady_clock::now();
     workersSharedData.phaseStartLocalT = std::chrono::system_clock::now();
 
 	workersSharedData.condition.notify_all();
 }
 
+/**
+ * Reset the host-wide rate limiters (limit scope host/global) and the host shares of the global
+ * limit balancer (master of limit scope global) for the next phase.
+ *
+ * Note: Caller must hold workersSharedData mutex and workers must be idle.
+ */
+void WorkerManager::initSharedRateLimitersUnlocked()
+{
+	workersSharedData.readRateLimiter.initStart(progArgs.getLimitReadBps(),
+		progArgs.getLimitReadIOPS(), progArgs.getLimitRefillUSec(), progArgs.getUseLimitSpin() );
+	workersSharedData.writeRateLimiter.initStart(progArgs.getLimitWriteBps(),
+		progArgs.getLimitWriteIOPS(), progArgs.getLimitRefillUSec(), progArgs.getUseLimitSpin() );
+
+	if(progArgs.getLimitScope() != ARG_LIMITSCOPE_GLOBAL)
+		return;
+
+	// global limit of this phase (rwmix reader threads count as part of the write phase)
+
+	uint64_t globalLimitBps = 0;
+	uint64_t globalLimitIOPS = 0;
+
+	if(workersSharedData.currentBenchPhase == BenchPhase_CREATEFILES)
+	{
+		globalLimitBps = progArgs.getLimitWriteBps();
+		globalLimitIOPS = progArgs.getLimitWriteIOPS();
+
+		if(progArgs.getNumRWMixReadThreads() )
+		{
+			globalLimitBps += progArgs.getLimitReadBps();
+			globalLimitIOPS += progArgs.getLimitReadIOPS();
+		}
+	}
+	else
+	if(workersSharedData.currentBenchPhase == BenchPhase_READFILES)
+	{
+		globalLimitBps = progArgs.getLimitReadBps();
+		globalLimitIOPS = progArgs.getLimitReadIOPS();
+	}
+
+	workersSharedData.rateLimitBalancer.initStart(progArgs.getHostsVec().size(), globalLimitBps,
+		globalLimitIOPS);
+}
+
 /**
  * Returns the total number of entries to be read/written and number of bytes to be read/written in
  * the given benchmark phase.
@@ -334,6 +431,14 @@ void WorkerManager::startNextPhase(BenchPhase newBenchPhase, std::string* benchI
 void WorkerManager::getPhaseNumEntriesAndBytes(const ProgArgs& progArgs, BenchPhase benchPhase,
 	BenchPathType benchPathType, size_t& outNumEntriesPerWorker, uint64_t& outNumBytesPerWorker)
 {
+	if(benchPhase == BenchPhase_REPLAY)
+	{ // replay mode: ops log totals (workers get ops by path, so this is only an even split)
+		const size_t numDataSetThreads = progArgs.getNumDataSetThreads();
+
+		outNumEntriesPerWorker = progArgs.getReplayOps().getNumEntryOps() / numDataSetThreads;
+		outNumBytesPerWorker = progArgs.getReplayOps().getNumBytesTotal() / numDataSetThreads;
+	}
+	else
 	if(benchPathType == BenchPathType_DIR)
 	{
 		if(progArgs.getBenchMode() == BenchMode_NETBENCH)
@@ -24,6 +24,7 @@ class WorkerManager
 		bool checkWorkersDone(size_t* outNumWorkersDone);
 		void checkPhaseTimeLimitUnlocked();
 		void checkPhaseTimeLimit();
+		void checkPhaseWarmupEnd();
 
 		void startNextPhase(BenchPhase newBenchPhase, std::string* benchID = NULL);
 
@@ -41,6 +42,7 @@ class WorkerManager
 		WorkersSharedData workersSharedData;
 
 		void interruptAndNotifyWorkersUnlocked();
+		void initSharedRateLimitersUnlocked();
 
 		// inliners
 	public:
@@ -16,6 +16,8 @@
 #include "CPUUtil.h"
 #include "Common.h"
 #include "S3UploadStore.h"
+#include "toolkits/RateLimitBalancer.h"
+#include "toolkits/RateLimiterShared.h"
 
 
 class Worker; // forward declaration for WorkerVec;
@@ -56,6 +58,11 @@ class WorkersSharedData
 			(protected by mutex, change signaled by condition) */
 		CPUUtil cpuUtilFirstDone; // 1st update() by WorkerManager, 2nd update() by first finisher
 		CPUUtil cpuUtilLastDone; // 1st update() by WorkerManager, 2nd update() by last finisher
+		bool isWarmupEndTriggered{false}; /* true after warmup end of current phase was handled
+			(protected by mutex) */
+		RateLimiterShared readRateLimiter; // read limit of all threads if limit scope not thread
+		RateLimiterShared writeRateLimiter; // write limit of all threads if limit scope not thread
+		RateLimitBalancer rateLimitBalancer; // master: host shares of global limit
 
 		void incNumWorkersDoneUnlocked(bool triggerStoneWall);
 